@@ -0,0 +1,154 @@
+/*
+   @file    LSM6DSV16X_9Axis_Fusion.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X library to compute an absolute
+            orientation from the accelerometer, the gyroscope and a LIS2MDL
+            magnetometer connected to the sensor hub.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+#include <LSM6DSV16XFusion.h>
+
+#define SENSOR_ODR 480.0f // In Hertz
+#define FIFO_BUFFER 32 // FIFO words read per loop
+#define BENCH_UPDATES 1000 // Filter updates timed at startup
+
+// LIS2MDL magnetometer connected to the LSM6DSV16X sensor hub lines
+#define LIS2MDL_ADDRESS     0x1E
+#define LIS2MDL_CFG_REG_A   0x60
+#define LIS2MDL_CFG_REG_C   0x62
+#define LIS2MDL_OUTX_L_REG  0x68
+#define LIS2MDL_SENSITIVITY 1.5f // mGauss/LSB
+
+LSM6DSV16XSensor AccGyr(&Wire);
+LSM6DSV16XFusion Fusion(SENSOR_ODR);
+LSM6DSV16X_FIFO_Word_t words[FIFO_BUFFER];
+uint8_t status = 0;
+unsigned long last_print = 0;
+
+void setup()
+{
+  float acc_sensitivity = 0.0f;
+  float gyro_sensitivity = 0.0f;
+
+  Serial.begin(115200);
+  Wire.begin();
+  Wire.setClock(400000);
+
+  // Initialize LSM6DSV16X.
+  AccGyr.begin();
+  status |= AccGyr.Enable_X();
+  status |= AccGyr.Enable_G();
+  status |= AccGyr.Set_X_ODR(SENSOR_ODR);
+  status |= AccGyr.Set_G_ODR(SENSOR_ODR);
+  status |= AccGyr.Set_X_FS(4);
+  status |= AccGyr.Set_G_FS(2000);
+  status |= AccGyr.Get_X_Sensitivity(&acc_sensitivity);
+  status |= AccGyr.Get_G_Sensitivity(&gyro_sensitivity);
+
+  // Configure the magnetometer: temperature compensation, 100 Hz continuous mode, BDU.
+  status |= AccGyr.SH_Write_Reg(LIS2MDL_ADDRESS, LIS2MDL_CFG_REG_A, 0x8C);
+  status |= AccGyr.SH_Write_Reg(LIS2MDL_ADDRESS, LIS2MDL_CFG_REG_C, 0x10);
+  status |= AccGyr.SH_Set_Slave(0, LIS2MDL_ADDRESS, LIS2MDL_OUTX_L_REG, 6);
+  status |= AccGyr.FIFO_SH_Set_Batch(0, 1);
+  status |= AccGyr.SH_Enable(120.0f, 1);
+
+  // Batch all the sensors, the filter runs once per gyroscope sample
+  status |= AccGyr.FIFO_Set_X_BDR(SENSOR_ODR);
+  status |= AccGyr.FIFO_Set_G_BDR(SENSOR_ODR);
+  status |= AccGyr.FIFO_Set_Mode(LSM6DSV16X_STREAM_MODE);
+
+  status |= Fusion.Set_Sensitivity(acc_sensitivity, gyro_sensitivity, LIS2MDL_SENSITIVITY);
+  status |= Fusion.Set_Mag_Slave(0);
+
+  if (status != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init/configure");
+    while (1);
+  }
+  Serial.println("LSM6DSV16X 9-Axis Fusion Demo");
+
+  Benchmark();
+
+  // Rotate the device in all directions to calibrate the magnetometer
+  Serial.println("Calibrating magnetometer for 15 s, rotate the device...");
+  Fusion.Start_Mag_Calibration();
+  last_print = millis();
+  while (millis() - last_print < 15000) {
+    Process_FIFO();
+  }
+  if (Fusion.Stop_Mag_Calibration() != LSM6DSV16X_OK) {
+    Serial.println("Magnetometer calibration failed, using the raw data");
+  }
+  Fusion.Reset();
+}
+
+void loop()
+{
+  float quat[4];
+
+  Process_FIFO();
+
+  if (millis() - last_print >= 100) {
+    last_print = millis();
+    Fusion.Get_Quaternion(quat);
+
+    Serial.print("Quaternion (x, y, z, w): ");
+    Serial.print(quat[0], 4);
+    Serial.print(", ");
+    Serial.print(quat[1], 4);
+    Serial.print(", ");
+    Serial.print(quat[2], 4);
+    Serial.print(", ");
+    Serial.println(quat[3], 4);
+  }
+}
+
+void Process_FIFO()
+{
+  uint16_t num_words = 0;
+  uint8_t updated = 0;
+
+  if (AccGyr.FIFO_Get_Words(words, FIFO_BUFFER, &num_words) != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to read FIFO");
+    while (1);
+  }
+
+  for (uint16_t i = 0; i < num_words; i++) {
+    Fusion.Process_Word(&words[i], &updated);
+  }
+}
+
+void Benchmark()
+{
+  float acc[3] = {0.0f, 0.0f, 1000.0f};
+  float gyro[3] = {1000.0f, -500.0f, 250.0f};
+  float mag[3] = {200.0f, 0.0f, -400.0f};
+  unsigned long start;
+  unsigned long elapsed;
+
+  start = micros();
+  for (uint16_t i = 0; i < BENCH_UPDATES; i++) {
+    Fusion.Update(acc, gyro, mag);
+  }
+  elapsed = micros() - start;
+  Fusion.Reset();
+
+  Serial.print("Filter update: ");
+  Serial.print((float)elapsed / BENCH_UPDATES, 2);
+  Serial.print(" us");
+#ifdef F_CPU
+  Serial.print(", ");
+  Serial.print((float)elapsed * (F_CPU / 1000000UL) / BENCH_UPDATES, 0);
+  Serial.print(" cycles");
+#endif
+  Serial.println();
+}
@@ -0,0 +1,85 @@
+/*
+   @file    LSM6DSV16X_Activity_Power_Manager.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X activity/inactivity power manager
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+ *******************************************************************************
+*/
+
+#include <LSM6DSV16XSensor.h>
+
+#define INT1_pin PA4
+#define ACTIVE_ODR 240.0f // In Hertz
+#define SLEEP_ODR 15.0f // In Hertz
+
+LSM6DSV16XSensor LSM6DSV16X(&Wire);
+
+//Interrupts.
+volatile int mems_event = 0;
+
+void INT1Event_cb();
+void Activity_cb(LSM6DSV16X_Activity_State_t State);
+
+void setup()
+{
+
+  // Initlialize serial.
+  Serial.begin(115200);
+  delay(1000);
+
+  // Initlialize Led.
+  pinMode(LED_BUILTIN, OUTPUT);
+
+  // Initlialize i2c.
+  Wire.begin();
+
+  // Enable INT1 pin.
+  attachInterrupt(INT1_pin, INT1Event_cb, RISING);
+
+  // Initlialize components.
+  LSM6DSV16X.begin();
+  LSM6DSV16X.Enable_X();
+  LSM6DSV16X.Enable_G();
+  LSM6DSV16X.Set_G_ODR(ACTIVE_ODR);
+
+  // Batch both sensors in FIFO.
+  LSM6DSV16X.FIFO_Set_X_BDR(ACTIVE_ODR);
+  LSM6DSV16X.FIFO_Set_G_BDR(ACTIVE_ODR);
+  LSM6DSV16X.FIFO_Set_Mode(LSM6DSV16X_STREAM_MODE);
+
+  // Go to sleep after about 4 s without motion (2 * 512 / ODR), put the gyroscope to sleep.
+  LSM6DSV16X.Set_Activity_Callback(Activity_cb);
+  LSM6DSV16X.Enable_Activity_Power_Manager(LSM6DSV16X_INT1_PIN, ACTIVE_ODR, SLEEP_ODR);
+  LSM6DSV16X.Set_Wake_Up_Threshold(2);
+  LSM6DSV16X.Set_Sleep_Duration(2);
+}
+
+void loop()
+{
+  if (mems_event) {
+    mems_event = 0;
+    LSM6DSV16X.Service_Activity_Power_Manager();
+  }
+}
+
+void Activity_cb(LSM6DSV16X_Activity_State_t State)
+{
+  if (State == LSM6DSV16X_INACTIVITY_STATE) {
+    digitalWrite(LED_BUILTIN, LOW);
+    Serial.println("Inactivity: low ODR");
+  } else {
+    digitalWrite(LED_BUILTIN, HIGH);
+    Serial.println("Activity: full ODR");
+  }
+}
+
+void INT1Event_cb()
+{
+  mems_event = 1;
+}
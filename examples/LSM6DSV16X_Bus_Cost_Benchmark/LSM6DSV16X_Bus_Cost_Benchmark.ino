@@ -0,0 +1,402 @@
+/*
+   @file    LSM6DSV16X_Bus_Cost_Benchmark.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to measure the bus cost of every LSM6DSV16X library API.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+#include <LSM6DSV16XEventDispatcher.h>
+
+// Every public API of LSM6DSV16XSensor (but the constructors, begin(), end() and the
+// IO_Read/IO_Write bus callbacks) and the event dispatcher service are run once, and
+// their bus traffic is printed as one CSV row:
+// api,hot,reads,writes,read_bytes,write_bytes,transactions,bytes,i2c_400khz_us,spi_10mhz_us
+// The "api" column is unique, so that it can be used as the key of the row.
+// The "hot" column flags the APIs used in the sampling/FIFO drain path,
+// so that a CI gate can compare only those rows against a stored baseline.
+#define I2C_MODEL_CLOCK 400000U
+#define SPI_MODEL_CLOCK 10000000U
+
+// The API name is the row key, BENCH_AS gives another key to a repeated API
+#define BENCH(hot, call) Bench(#call, hot, (call))
+#define BENCH_AS(key, hot, call) Bench(#key, hot, (call))
+
+LSM6DSV16XSensor AccGyr(&Wire);
+LSM6DSV16XEventDispatcher Dispatcher(&AccGyr);
+
+void Bench(const char *name, uint8_t hot, LSM6DSV16XStatusTypeDef ret);
+void On_Activity(LSM6DSV16X_Activity_State_t State);
+void On_FIFO_Loss(uint32_t Lost, const LSM6DSV16X_FIFO_Stats_t *Stats);
+void On_Event(LSM6DSV16X_Event_t Event, const LSM6DSV16X_Event_Sources_t *Sources, void *Context);
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial) {
+    yield();
+  }
+
+  Wire.begin();
+
+  if (AccGyr.begin() != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init");
+    while (1);
+  }
+
+  Run_Benchmark();
+}
+
+void loop()
+{
+}
+
+void Run_Benchmark()
+{
+  uint8_t u8 = 0;
+  uint16_t u16 = 0;
+  uint32_t u32 = 0;
+  int16_t raw[3];
+  int16_t raw2[3];
+  uint8_t sh_data[6];
+  uint8_t sflp_state[LSM6DSV16X_SFLP_STATE_SIZE];
+  uint8_t xl_offset_state[LSM6DSV16X_XL_OFFSET_STATE_SIZE];
+  int32_t axes[3];
+  int32_t axes2[3];
+  float value = 0.0f;
+  float vec[4];
+  float vec2[3];
+  float hdr[3 * 8];
+  float offset[3] = {0.0f, 0.0f, 0.0f};
+  float thermal_xl_offset[3];
+  float thermal_xl_gain[3];
+  float thermal_g_offset[3];
+  float thermal_g_gain[3];
+  LSM6DSV16X_Thermal_Model_t thermal = {25.0f, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+  LSM6DSV16X_Self_Test_Result_t self_test;
+  LSM6DSV16X_Config_Image_t config_image;
+  LSM6DSV16X_Event_Status_t events;
+  LSM6DSV16X_Activity_State_t activity;
+  LSM6DSV16X_FIFO_Stats_t fifo_stats;
+  lsm6dsv16x_mlc_status_mainpage_t mlc_status;
+  lsm6dsv16x_mlc_out_t mlc_out;
+  LSM6DSV16X_FIFO_Word_t words[8];
+  LSM6DSV16X_QVAR_Sample_t qvar_sample;
+  uint8_t sources[7];
+#if LSM6DSV16X_LATENCY_TRACE
+  LSM6DSV16X_Latency_Stats_t latency;
+#endif
+
+  Serial.println("api,hot,reads,writes,read_bytes,write_bytes,transactions,bytes,i2c_400khz_us,spi_10mhz_us");
+
+  AccGyr.Reset_Bus_Stats();
+
+  BENCH(0, AccGyr.ReadID(&u8));
+
+  BENCH(0, AccGyr.Enable_X());
+  BENCH(0, AccGyr.Set_X_ODR(120.0f));
+  BENCH(0, AccGyr.Set_X_FS(4));
+  BENCH(0, AccGyr.Set_X_Power_Mode(LSM6DSV16X_XL_HIGH_PERFORMANCE_MD));
+  BENCH(0, AccGyr.Get_X_ODR(&value));
+  BENCH(0, AccGyr.Get_X_FS(&axes[0]));
+  BENCH(0, AccGyr.Get_X_Sensitivity(&value));
+  BENCH(1, AccGyr.Get_X_AxesRaw(raw));
+  BENCH(1, AccGyr.Get_X_Axes(axes));
+  BENCH(1, AccGyr.Get_X_DRDY_Status(&u8));
+  BENCH(1, AccGyr.Get_X_Event_Status(&events));
+  BENCH(0, AccGyr.Set_X_Filter_Mode(0, 0));
+  BENCH(0, AccGyr.Enable_X_Dual_Channel());
+  BENCH(1, AccGyr.Get_X_Dual_AxesRaw(raw, raw2));
+  BENCH(1, AccGyr.Get_X_Dual_Axes(vec, vec2));
+  BENCH(1, AccGyr.Get_X_HDR_Axes(vec));
+  BENCH(0, AccGyr.Disable_X_Dual_Channel());
+
+  BENCH(0, AccGyr.Enable_G());
+  BENCH(0, AccGyr.Set_G_ODR(120.0f));
+  BENCH(0, AccGyr.Set_G_FS(2000));
+  BENCH(0, AccGyr.Set_G_Power_Mode(LSM6DSV16X_GY_HIGH_PERFORMANCE_MD));
+  BENCH(0, AccGyr.Get_G_ODR(&value));
+  BENCH(0, AccGyr.Get_G_FS(&axes[0]));
+  BENCH(0, AccGyr.Get_G_Sensitivity(&value));
+  BENCH(1, AccGyr.Get_G_AxesRaw(raw));
+  BENCH(1, AccGyr.Get_G_Axes(axes));
+  BENCH(1, AccGyr.Get_G_DRDY_Status(&u8));
+  BENCH(0, AccGyr.Set_G_Filter_Mode(0, 0));
+
+  BENCH(1, AccGyr.Get_XG_AxesRaw(raw, raw2));
+  BENCH(1, AccGyr.Get_XG_Axes(axes, axes2));
+  BENCH_AS(Get_XG_Axes_Temperature, 1, AccGyr.Get_XG_Axes(axes, axes2, &value));
+  BENCH(1, AccGyr.Get_Temperature_Raw(raw));
+  BENCH(1, AccGyr.Get_Temperature(&value));
+
+  BENCH(0, AccGyr.Check_Thermal_Model(&thermal));
+  BENCH_AS(Get_Thermal_Correction, 1, (AccGyr.Get_Thermal_Correction(&thermal, 25.0f, thermal_xl_offset, thermal_xl_gain, thermal_g_offset, thermal_g_gain), LSM6DSV16X_OK));
+  BENCH(0, AccGyr.Enable_Thermal_Compensation(&thermal));
+  BENCH(0, AccGyr.Disable_Thermal_Compensation());
+
+  BENCH(0, AccGyr.Enable_6D_Orientation(LSM6DSV16X_INT1_PIN));
+  BENCH(0, AccGyr.Set_6D_Orientation_Threshold(0));
+  BENCH(1, AccGyr.Get_6D_Orientation_XL(&u8));
+  BENCH(1, AccGyr.Get_6D_Orientation_XH(&u8));
+  BENCH(1, AccGyr.Get_6D_Orientation_YL(&u8));
+  BENCH(1, AccGyr.Get_6D_Orientation_YH(&u8));
+  BENCH(1, AccGyr.Get_6D_Orientation_ZL(&u8));
+  BENCH(1, AccGyr.Get_6D_Orientation_ZH(&u8));
+  BENCH(0, AccGyr.Disable_6D_Orientation());
+  BENCH(0, AccGyr.Enable_Free_Fall_Detection(LSM6DSV16X_INT1_PIN));
+  BENCH(0, AccGyr.Set_Free_Fall_Threshold(3));
+  BENCH(0, AccGyr.Set_Free_Fall_Duration(3));
+  BENCH(0, AccGyr.Disable_Free_Fall_Detection());
+  BENCH(0, AccGyr.Enable_Wake_Up_Detection(LSM6DSV16X_INT1_PIN));
+  BENCH(0, AccGyr.Set_Wake_Up_Threshold(63));
+  BENCH(0, AccGyr.Set_Wake_Up_Duration(0));
+  BENCH(0, AccGyr.Disable_Wake_Up_Detection());
+  BENCH(0, AccGyr.Set_Activity_Callback(On_Activity));
+  BENCH(0, AccGyr.Enable_Activity_Power_Manager(LSM6DSV16X_INT1_PIN, 120.0f, 15.0f));
+  BENCH(0, AccGyr.Set_Sleep_Duration(0));
+  BENCH(1, AccGyr.Service_Activity_Power_Manager());
+  BENCH(1, AccGyr.Get_Activity_State(&activity));
+  BENCH(0, AccGyr.Disable_Activity_Power_Manager());
+  BENCH(0, AccGyr.Enable_Single_Tap_Detection(LSM6DSV16X_INT1_PIN));
+  BENCH(0, AccGyr.Set_Tap_Threshold(8));
+  BENCH(0, AccGyr.Set_Tap_Shock_Time(2));
+  BENCH(0, AccGyr.Set_Tap_Quiet_Time(1));
+  BENCH(0, AccGyr.Set_Tap_Duration_Time(7));
+  BENCH(0, AccGyr.Disable_Single_Tap_Detection());
+  BENCH(0, AccGyr.Enable_Double_Tap_Detection(LSM6DSV16X_INT1_PIN));
+  BENCH(0, AccGyr.Disable_Double_Tap_Detection());
+  BENCH(0, AccGyr.Enable_Pedometer(LSM6DSV16X_INT1_PIN));
+  BENCH(1, AccGyr.Get_Step_Count(&u16));
+  BENCH(0, AccGyr.Step_Counter_Reset());
+  BENCH(0, AccGyr.Disable_Pedometer());
+  BENCH(0, AccGyr.Enable_Tilt_Detection(LSM6DSV16X_INT1_PIN));
+  BENCH(0, AccGyr.Disable_Tilt_Detection());
+  BENCH(0, AccGyr.Enable_Significant_Motion(LSM6DSV16X_INT1_PIN));
+  BENCH(0, AccGyr.Disable_Significant_Motion());
+  BENCH(0, AccGyr.Route_Interrupt(LSM6DSV16X_INT1_PIN, LSM6DSV16X_INT_DRDY_XL));
+  BENCH(0, AccGyr.Unroute_Interrupt(LSM6DSV16X_INT1_PIN, LSM6DSV16X_INT_DRDY_XL));
+  BENCH(0, AccGyr.Get_Interrupt_Routing(LSM6DSV16X_INT1_PIN, &u32));
+  BENCH(0, AccGyr.Begin_Interrupt_Routing());
+  BENCH_AS(Enable_Free_Fall_Detection_Deferred, 0, AccGyr.Enable_Free_Fall_Detection(LSM6DSV16X_INT1_PIN));
+  BENCH_AS(Enable_Wake_Up_Detection_Deferred, 0, AccGyr.Enable_Wake_Up_Detection(LSM6DSV16X_INT1_PIN));
+  BENCH_AS(Enable_Double_Tap_Detection_Deferred, 0, AccGyr.Enable_Double_Tap_Detection(LSM6DSV16X_INT1_PIN));
+  BENCH(0, AccGyr.End_Interrupt_Routing());
+
+  // Every event registered, so that the dispatcher reads its widest burst
+  for (uint8_t i = 0; i < LSM6DSV16X_EVENT_NUMBER; i++) {
+    Dispatcher.Set_Callback((LSM6DSV16X_Event_t)i, On_Event, NULL);
+  }
+  AccGyr.Reset_Bus_Stats();
+  BENCH_AS(Dispatcher_Service_Now, 1, Dispatcher.Service_Now(&u16));
+
+  BENCH_AS(Disable_Free_Fall_Detection_Deferred, 0, AccGyr.Disable_Free_Fall_Detection());
+  BENCH_AS(Disable_Wake_Up_Detection_Deferred, 0, AccGyr.Disable_Wake_Up_Detection());
+  BENCH_AS(Disable_Double_Tap_Detection_Deferred, 0, AccGyr.Disable_Double_Tap_Detection());
+
+  BENCH(0, AccGyr.FIFO_Set_X_BDR(120.0f));
+  BENCH(0, AccGyr.FIFO_Set_G_BDR(120.0f));
+  BENCH(0, AccGyr.FIFO_Set_Watermark_Level(64));
+  BENCH(0, AccGyr.FIFO_Set_Stop_On_Fth(0));
+  BENCH(0, AccGyr.FIFO_Set_INT1_FIFO_Full(0));
+  BENCH(0, AccGyr.FIFO_Set_INT2_FIFO_Full(0));
+  BENCH(0, AccGyr.FIFO_Set_INT1_FIFO_Threshold(0));
+  BENCH(0, AccGyr.FIFO_Set_INT2_FIFO_Threshold(0));
+  BENCH(0, AccGyr.FIFO_Set_INT1_Batch_Counter(0));
+  BENCH(0, AccGyr.FIFO_Set_INT2_Batch_Counter(0));
+  BENCH(0, AccGyr.FIFO_Set_Batch_Counter(LSM6DSV16X_XL_BATCH_EVENT, 0));
+  BENCH(0, AccGyr.FIFO_Set_Loss_Callback(On_FIFO_Loss));
+  BENCH(0, AccGyr.FIFO_Enable_Config_Tracking());
+  BENCH(1, AccGyr.FIFO_Get_Config_Sensitivity(0, &vec[0], &vec[1]));
+  BENCH(0, AccGyr.FIFO_Disable_Config_Tracking());
+  BENCH(0, AccGyr.FIFO_Set_Temperature_BDR(1.875f));
+  BENCH(0, AccGyr.FIFO_Set_X_Dual_Batch(0));
+  BENCH_AS(FIFO_Set_Timestamp_Batch_On, 0, AccGyr.FIFO_Set_Timestamp_Batch(1));
+  BENCH_AS(FIFO_Set_Mode_Stream, 0, AccGyr.FIFO_Set_Mode(LSM6DSV16X_STREAM_MODE));
+  BENCH_AS(FIFO_Mark_Interrupt, 1, (AccGyr.FIFO_Mark_Interrupt(), LSM6DSV16X_OK));
+  BENCH(1, AccGyr.FIFO_Get_Num_Samples(&u16));
+  BENCH(1, AccGyr.FIFO_Get_Full_Status(&u8));
+  BENCH(1, AccGyr.FIFO_Get_Tag(&u8));
+  BENCH(1, AccGyr.FIFO_Get_Data(sh_data));
+  BENCH(1, AccGyr.FIFO_Get_X_Axes(axes));
+  BENCH(1, AccGyr.FIFO_Get_G_Axes(axes));
+  BENCH(1, AccGyr.FIFO_Get_Words(words, 8, &u16));
+  BENCH(1, AccGyr.FIFO_Get_Batch_Frame(words, 8, &u16, &u8));
+  BENCH(1, AccGyr.FIFO_Get_Status(&u16, &u8));
+  BENCH(1, AccGyr.FIFO_Get_Status_Regs(sources));
+  BENCH(0, AccGyr.FIFO_Get_Stats(&fifo_stats));
+  BENCH(0, AccGyr.FIFO_Reset_Stats());
+
+  // The decoders do not access the bus, they are run on synthetic words
+  memset(words, 0, sizeof(words));
+  words[0].Tag = 0x02; // XL_NC_TAG
+  BENCH(1, AccGyr.FIFO_Decode_X_Axes(&words[0], vec));
+  BENCH(1, AccGyr.FIFO_Decode_X_HDR(words, 1, hdr, 8, &u16));
+  words[0].Tag = 0x01; // GY_NC_TAG
+  BENCH(1, AccGyr.FIFO_Decode_G_Axes(&words[0], vec));
+  words[0].Tag = 0x03; // TEMPERATURE_TAG
+  BENCH(1, AccGyr.FIFO_Decode_Temperature(&words[0], &value));
+  words[0].Tag = 0x04; // TIMESTAMP_TAG
+  BENCH(1, AccGyr.FIFO_Decode_Timestamp(&words[0], &u32));
+  words[0].Tag = 0x1D; // XL_DUAL_CORE
+  BENCH(1, AccGyr.FIFO_Decode_X_Dual_Axes(&words[0], vec));
+  words[0].Tag = 0x13; // SFLP_GAME_ROTATION_VECTOR_TAG
+  BENCH(1, AccGyr.FIFO_Decode_Rotation_Vector(&words[0], vec));
+  words[0].Tag = 0x17; // SFLP_GRAVITY_VECTOR_TAG
+  BENCH(1, AccGyr.FIFO_Decode_Gravity_Vector(&words[0], vec));
+  words[0].Tag = 0x16; // SFLP_GYROSCOPE_BIAS_TAG
+  BENCH(1, AccGyr.FIFO_Decode_Gyroscope_Bias(&words[0], vec));
+  BENCH(1, AccGyr.FIFO_Get_SH_Slave(0x0E, &u8));
+
+  BENCH_AS(FIFO_Set_Timestamp_Batch_Off, 0, AccGyr.FIFO_Set_Timestamp_Batch(0));
+  BENCH_AS(FIFO_Set_Mode_Bypass, 0, AccGyr.FIFO_Set_Mode(LSM6DSV16X_BYPASS_MODE));
+
+  BENCH(0, AccGyr.FIFO_Arm_Capture(LSM6DSV16X_CAPTURE_WAKE_UP, LSM6DSV16X_INT1_PIN, LSM6DSV16X_CAPTURE_PRE_TRIGGER, 32));
+  BENCH(1, AccGyr.FIFO_Get_Capture_Status(&u8));
+  BENCH(1, AccGyr.FIFO_Read_Capture(words, 8, &u16));
+  BENCH(0, AccGyr.FIFO_Disarm_Capture());
+
+  BENCH(0, AccGyr.QVAR_Enable());
+  BENCH(1, AccGyr.QVAR_GetStatus(&u8));
+  BENCH(1, AccGyr.QVAR_GetData(&value));
+  BENCH(1, AccGyr.QVAR_Get_Sample(&qvar_sample));
+  BENCH(0, AccGyr.QVAR_GetImpedance(&u16));
+  BENCH(0, AccGyr.QVAR_SetImpedance(2400));
+  BENCH(0, AccGyr.QVAR_Disable());
+
+  BENCH(1, AccGyr.Get_MLC_Status(&mlc_status));
+  BENCH(1, AccGyr.Get_MLC_Output(&mlc_out));
+
+  BENCH(0, AccGyr.SH_Set_Pull_Up(1));
+  BENCH(0, AccGyr.SH_Write_Reg(0x1E, 0x60, 0x8C));
+  BENCH(0, AccGyr.SH_Read_Reg(0x1E, 0x4F, &u8, 1));
+  BENCH(0, AccGyr.SH_Set_Slave(0, 0x1E, 0x68, 6));
+  BENCH(0, AccGyr.SH_Enable(120.0f, 1));
+  BENCH_AS(FIFO_SH_Set_Batch_On, 0, AccGyr.FIFO_SH_Set_Batch(0, 1));
+  BENCH(1, AccGyr.SH_Get_Data(sh_data, 6));
+  BENCH_AS(FIFO_SH_Set_Batch_Off, 0, AccGyr.FIFO_SH_Set_Batch(0, 0));
+  BENCH(0, AccGyr.SH_Disable());
+
+  BENCH(0, AccGyr.Enable_Rotation_Vector());
+  BENCH(0, AccGyr.Enable_Gravity_Vector());
+  BENCH(0, AccGyr.Enable_Gyroscope_Bias());
+  BENCH(1, AccGyr.FIFO_Get_Rotation_Vector(vec));
+  BENCH(1, AccGyr.FIFO_Get_Gravity_Vector(vec));
+  BENCH(1, AccGyr.FIFO_Get_Gyroscope_Bias(vec));
+  BENCH(0, AccGyr.Reset_SFLP());
+  BENCH(0, AccGyr.Enable_SFLP(120.0f, LSM6DSV16X_SFLP_OUT_ALL));
+  BENCH(0, AccGyr.Get_SFLP_Outputs(&u8));
+  BENCH(0, AccGyr.Get_SFLP_Gyroscope_Bias(vec));
+  BENCH(0, AccGyr.Set_SFLP_Gyroscope_Bias(vec));
+  BENCH(0, AccGyr.Restore_SFLP_Gyroscope_Bias());
+  BENCH(0, AccGyr.Get_SFLP_State(sflp_state, sizeof(sflp_state)));
+  BENCH(0, AccGyr.Restore_SFLP_State(sflp_state, sizeof(sflp_state)));
+  BENCH(0, AccGyr.Disable_SFLP());
+  BENCH(0, AccGyr.Disable_Rotation_Vector());
+  BENCH(0, AccGyr.Disable_Gravity_Vector());
+  BENCH(0, AccGyr.Disable_Gyroscope_Bias());
+  BENCH_AS(FIFO_Set_Mode_Bypass_After_SFLP, 0, AccGyr.FIFO_Set_Mode(LSM6DSV16X_BYPASS_MODE));
+
+  BENCH(0, AccGyr.Set_X_User_Offset(offset));
+  BENCH(0, AccGyr.Get_X_User_Offset(offset));
+  BENCH(0, AccGyr.Get_X_Offset_State(xl_offset_state, sizeof(xl_offset_state)));
+  BENCH(0, AccGyr.Restore_X_Offset_State(xl_offset_state, sizeof(xl_offset_state)));
+  BENCH(0, AccGyr.Start_X_Offset_Calibration());
+  BENCH(1, AccGyr.Service_X_Offset_Calibration(&u8));
+  BENCH(0, AccGyr.Stop_X_Offset_Calibration());
+
+  BENCH(0, AccGyr.Run_Self_Test(&self_test));
+
+  BENCH(0, AccGyr.Enable_Timestamp());
+  BENCH(1, AccGyr.Get_Timestamp(&u32));
+  BENCH(0, AccGyr.Get_Timestamp_Resolution(&value));
+  BENCH(0, AccGyr.Disable_Timestamp());
+  BENCH(0, AccGyr.Get_Config_Image(&config_image));
+  BENCH(0, AccGyr.Set_Config_Image(&config_image));
+
+  BENCH(1, AccGyr.Begin_Bus_Transaction());
+  BENCH(1, AccGyr.Read_Reg(LSM6DSV16X_CTRL1, &u8));
+  BENCH(0, AccGyr.Write_Reg(LSM6DSV16X_CTRL1, u8));
+  BENCH(1, AccGyr.Read_Regs(LSM6DSV16X_WAKE_UP_SRC, sources, sizeof(sources)));
+  BENCH(1, AccGyr.End_Bus_Transaction());
+
+#if LSM6DSV16X_LATENCY_TRACE
+  BENCH(0, AccGyr.Get_Latency_Stats(LSM6DSV16X_LATENCY_BUS_TRANSFER, &latency));
+  BENCH(0, AccGyr.Reset_Latency_Stats());
+#endif
+
+  BENCH(0, AccGyr.Disable_X());
+  BENCH(0, AccGyr.Disable_G());
+
+  Serial.println("END");
+}
+
+void Bench(const char *name, uint8_t hot, LSM6DSV16XStatusTypeDef ret)
+{
+  LSM6DSV16X_Bus_Stats_t stats;
+  float i2c_us = 0.0f;
+  float spi_us = 0.0f;
+
+  AccGyr.Get_Bus_Stats(&stats);
+  AccGyr.Get_Bus_Wire_Time(&stats, LSM6DSV16X_I2C_BUS, I2C_MODEL_CLOCK, &i2c_us);
+  AccGyr.Get_Bus_Wire_Time(&stats, LSM6DSV16X_SPI_BUS, SPI_MODEL_CLOCK, &spi_us);
+
+  // Strip the "AccGyr." prefix and the argument list from the API name
+  const char *api = strchr(name, '.');
+  api = (api != NULL) ? (api + 1) : name;
+  while ((*api != '\0') && (*api != '(')) {
+    Serial.print(*api);
+    api++;
+  }
+
+  Serial.print(",");
+  Serial.print(hot);
+  Serial.print(",");
+  Serial.print(stats.ReadTransactions);
+  Serial.print(",");
+  Serial.print(stats.WriteTransactions);
+  Serial.print(",");
+  Serial.print(stats.ReadBytes);
+  Serial.print(",");
+  Serial.print(stats.WriteBytes);
+  Serial.print(",");
+  Serial.print(stats.ReadTransactions + stats.WriteTransactions);
+  Serial.print(",");
+  Serial.print(stats.ReadBytes + stats.WriteBytes);
+  Serial.print(",");
+  Serial.print(i2c_us, 1);
+  Serial.print(",");
+  Serial.println(spi_us, 1);
+
+  if (ret != LSM6DSV16X_OK) {
+    Serial.print("# error returned by ");
+    Serial.println(name);
+  }
+
+  AccGyr.Reset_Bus_Stats();
+}
+
+void On_Activity(LSM6DSV16X_Activity_State_t State)
+{
+  (void)State;
+}
+
+void On_FIFO_Loss(uint32_t Lost, const LSM6DSV16X_FIFO_Stats_t *Stats)
+{
+  (void)Lost;
+  (void)Stats;
+}
+
+void On_Event(LSM6DSV16X_Event_t Event, const LSM6DSV16X_Event_Sources_t *Sources, void *Context)
+{
+  (void)Event;
+  (void)Sources;
+  (void)Context;
+}
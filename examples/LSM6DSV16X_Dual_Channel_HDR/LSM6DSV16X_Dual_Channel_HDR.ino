@@ -0,0 +1,83 @@
+/*
+   @file    LSM6DSV16X_Dual_Channel_HDR.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X library to read the accelerometer at
+            2 g and at 16 g at the same time, with a high dynamic range output
+            taking each axis from the 16 g channel when the 2 g one saturates.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+
+#define SENSOR_ODR 960.0f // In Hertz
+#define IMPACT_MG 2500.0f // Peak reported as an impact
+
+LSM6DSV16XSensor AccGyr(&Wire);
+float peak = 0.0f;
+uint32_t last_print = 0;
+
+void setup()
+{
+  uint8_t status = 0;
+
+  Serial.begin(115200);
+  Wire.begin();
+
+  AccGyr.begin();
+  status |= AccGyr.Enable_X();
+  status |= AccGyr.Set_X_ODR(SENSOR_ODR);
+  // Fine resolution at rest, the second channel covers the impacts
+  status |= AccGyr.Set_X_FS(2);
+  status |= AccGyr.Enable_X_Dual_Channel();
+
+  if (status != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init/configure");
+    while (1);
+  }
+  Serial.println("LSM6DSV16X Dual Channel HDR Demo");
+}
+
+void loop()
+{
+  float acceleration[3];
+  float magnitude;
+  uint8_t drdy = 0;
+
+  AccGyr.Get_X_DRDY_Status(&drdy);
+  if (drdy == 0) {
+    return;
+  }
+
+  // Both channels are read with a single burst
+  if (AccGyr.Get_X_HDR_Axes(acceleration) != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to read data");
+    while (1);
+  }
+
+  magnitude = sqrtf(acceleration[0] * acceleration[0] + acceleration[1] * acceleration[1] + acceleration[2] * acceleration[2]);
+  if (magnitude > peak) {
+    peak = magnitude;
+  }
+
+  if (millis() - last_print > 500) {
+    last_print = millis();
+    Serial.print("Acc[mg]: ");
+    Serial.print(acceleration[0]);
+    Serial.print(", ");
+    Serial.print(acceleration[1]);
+    Serial.print(", ");
+    Serial.print(acceleration[2]);
+    Serial.print(" Peak[mg]: ");
+    Serial.print(peak);
+    Serial.println(peak > IMPACT_MG ? " impact" : "");
+    peak = 0.0f;
+  }
+}
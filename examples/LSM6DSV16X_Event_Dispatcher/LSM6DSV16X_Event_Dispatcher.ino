@@ -0,0 +1,105 @@
+/*
+   @file    LSM6DSV16X_Event_Dispatcher.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X event dispatcher with several detections
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+#include <LSM6DSV16XEventDispatcher.h>
+
+#define INT1_pin PA4 // MCU input pin connected to sensor INT1 output pin
+#define INT2_pin PA5 // MCU input pin connected to sensor INT2 output pin
+
+LSM6DSV16XSensor AccGyr(&Wire);
+LSM6DSV16XEventDispatcher Dispatcher(&AccGyr);
+uint16_t steps = 0;
+
+// Both pins share the dispatcher, a single service reads all the sources
+void INT1Event_cb()
+{
+  Dispatcher.Mark_Interrupt();
+}
+
+void INT2Event_cb()
+{
+  Dispatcher.Mark_Interrupt();
+}
+
+void on_double_tap(LSM6DSV16X_Event_t Event, const LSM6DSV16X_Event_Sources_t *Sources, void *Context)
+{
+  Serial.println("Double Tap Detected!");
+}
+
+void on_free_fall(LSM6DSV16X_Event_t Event, const LSM6DSV16X_Event_Sources_t *Sources, void *Context)
+{
+  Serial.println("Free Fall Detected!");
+}
+
+void on_6d(LSM6DSV16X_Event_t Event, const LSM6DSV16X_Event_Sources_t *Sources, void *Context)
+{
+  // D6D_SRC is part of the snapshot, no need to read the orientation again
+  Serial.print("6D Orientation changed, D6D_SRC = 0x");
+  Serial.println(Sources->D6DSrc, HEX);
+}
+
+void on_tilt(LSM6DSV16X_Event_t Event, const LSM6DSV16X_Event_Sources_t *Sources, void *Context)
+{
+  Serial.println("Tilt Detected!");
+}
+
+void on_step(LSM6DSV16X_Event_t Event, const LSM6DSV16X_Event_Sources_t *Sources, void *Context)
+{
+  uint16_t *count = (uint16_t *)Context;
+  (*count)++;
+  Serial.print("Step Detected! Steps: ");
+  Serial.println(*count);
+}
+
+void setup()
+{
+  uint8_t status = 0;
+
+  Serial.begin(115200);
+  Wire.begin();
+
+  attachInterrupt(INT1_pin, INT1Event_cb, RISING);
+  attachInterrupt(INT2_pin, INT2Event_cb, RISING);
+
+  AccGyr.begin();
+  status |= AccGyr.Enable_X();
+  // Write the routing of all the detections in a single pass
+  status |= AccGyr.Begin_Interrupt_Routing();
+  status |= AccGyr.Enable_Double_Tap_Detection(LSM6DSV16X_INT1_PIN);
+  status |= AccGyr.Enable_Free_Fall_Detection(LSM6DSV16X_INT1_PIN);
+  status |= AccGyr.Enable_6D_Orientation(LSM6DSV16X_INT1_PIN);
+  status |= AccGyr.Enable_Tilt_Detection(LSM6DSV16X_INT2_PIN);
+  status |= AccGyr.Enable_Pedometer(LSM6DSV16X_INT2_PIN);
+  status |= AccGyr.End_Interrupt_Routing();
+
+  status |= Dispatcher.Set_Callback(LSM6DSV16X_EVENT_DOUBLE_TAP, on_double_tap, NULL);
+  status |= Dispatcher.Set_Callback(LSM6DSV16X_EVENT_FREE_FALL, on_free_fall, NULL);
+  status |= Dispatcher.Set_Callback(LSM6DSV16X_EVENT_6D_ORIENTATION, on_6d, NULL);
+  status |= Dispatcher.Set_Callback(LSM6DSV16X_EVENT_TILT, on_tilt, NULL);
+  status |= Dispatcher.Set_Callback(LSM6DSV16X_EVENT_STEP, on_step, &steps);
+
+  if (status != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init/configure");
+    while (1);
+  }
+  Serial.println("LSM6DSV16X Event Dispatcher Demo");
+}
+
+void loop()
+{
+  uint16_t events;
+
+  // No bus access unless an interrupt was marked
+  Dispatcher.Service(&events);
+}
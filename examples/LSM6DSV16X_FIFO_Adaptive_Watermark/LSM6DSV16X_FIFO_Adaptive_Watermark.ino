@@ -0,0 +1,99 @@
+/*
+   @file    LSM6DSV16X_FIFO_Adaptive_Watermark.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X library to drain the FIFO on its
+            threshold interrupt with a watermark adapted at runtime, waking
+            the MCU as rarely as the latency bound allows.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+#include <LSM6DSV16XWatermark.h>
+
+#define SENSOR_ODR 480.0f // In Hertz
+#define MAX_LATENCY_US 50000 // Longest wait of a sample in the FIFO
+#define FIFO_MAX_WORDS 320 // Above the largest watermark, the interrupt is a level
+#define REPORT_INTERVAL 5000 // In ms
+#define INT1_pin PA4 // MCU input pin connected to sensor INT1 output pin
+
+LSM6DSV16XSensor AccGyr(&Wire);
+LSM6DSV16XWatermark controller(&AccGyr);
+LSM6DSV16X_FIFO_Word_t words[FIFO_MAX_WORDS];
+volatile uint8_t thresholdFlag = 0;
+unsigned long last_report = 0;
+
+void INT1_thresholdEvent_cb()
+{
+  controller.Mark_Interrupt();
+  thresholdFlag = 1;
+}
+
+void setup()
+{
+  uint8_t status = 0;
+
+  Serial.begin(115200);
+  Wire.begin();
+
+  attachInterrupt(INT1_pin, INT1_thresholdEvent_cb, RISING);
+
+  AccGyr.begin();
+  status |= AccGyr.Enable_X();
+  status |= AccGyr.Enable_G();
+  status |= AccGyr.Set_X_ODR(SENSOR_ODR);
+  status |= AccGyr.Set_G_ODR(SENSOR_ODR);
+  status |= AccGyr.FIFO_Set_X_BDR(SENSOR_ODR);
+  status |= AccGyr.FIFO_Set_G_BDR(SENSOR_ODR);
+
+  // The FIFO keeps filling above the watermark, so the controller can measure the latency
+  status |= AccGyr.FIFO_Set_INT1_FIFO_Threshold(1);
+  status |= AccGyr.FIFO_Set_Mode(LSM6DSV16X_STREAM_MODE);
+
+  status |= controller.Set_Latency_Bound(MAX_LATENCY_US);
+  status |= controller.Start(16);
+
+  if (status != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init/configure");
+    while (1);
+  }
+  Serial.println("LSM6DSV16X FIFO Adaptive Watermark Demo");
+}
+
+void loop()
+{
+  uint16_t num_words = 0;
+  LSM6DSV16X_Watermark_Info_t info;
+
+  if (thresholdFlag != 0) {
+    thresholdFlag = 0;
+    if (controller.Drain(words, FIFO_MAX_WORDS, &num_words) != LSM6DSV16X_OK) {
+      Serial.println("LSM6DSV16X Sensor failed to read FIFO");
+      while (1);
+    }
+  }
+
+  if (millis() - last_report >= REPORT_INTERVAL) {
+    last_report = millis();
+    controller.Get_Info(&info);
+    Serial.print("watermark: ");
+    Serial.print(info.Watermark);
+    Serial.print(" words/s: ");
+    Serial.print(info.WordRate, 0);
+    Serial.print(" interrupts/s: ");
+    Serial.print(info.InterruptRate, 1);
+    Serial.print(" wake latency: ");
+    Serial.print(info.WakeLatencyUs);
+    Serial.print(" us bus: ");
+    Serial.print(info.BusUsPerWord, 1);
+    Serial.print(" us/word overruns: ");
+    Serial.println(info.Overruns);
+  }
+}
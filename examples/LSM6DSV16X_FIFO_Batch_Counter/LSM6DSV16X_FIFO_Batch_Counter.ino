@@ -0,0 +1,114 @@
+/*
+   @file    LSM6DSV16X_FIFO_Batch_Counter.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X library to drain the FIFO once per
+            frame of accelerometer samples with the batch counter interrupt,
+            whatever other data is batched in the FIFO.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+
+#define SENSOR_ODR 960.0f // In Hertz
+#define FRAME_SAMPLES 64 // Accelerometer samples per frame
+#define FIFO_MAX_WORDS 160 // Frame samples plus the gyroscope and timestamp words
+#define INT1_pin PA4 // MCU input pin connected to sensor INT1 output pin
+
+LSM6DSV16XSensor AccGyr(&Wire);
+LSM6DSV16X_FIFO_Word_t words[FIFO_MAX_WORDS];
+volatile uint16_t frames_pending = 0;
+float frame[FRAME_SAMPLES][3];
+uint16_t frame_samples = 0;
+
+void INT1_batchCounterEvent_cb()
+{
+  frames_pending++;
+}
+
+void setup()
+{
+  uint8_t status = 0;
+
+  Serial.begin(115200);
+  Wire.begin();
+
+  attachInterrupt(INT1_pin, INT1_batchCounterEvent_cb, RISING);
+
+  AccGyr.begin();
+  status |= AccGyr.Enable_X();
+  status |= AccGyr.Enable_G();
+  status |= AccGyr.Set_X_ODR(SENSOR_ODR);
+  status |= AccGyr.Set_G_ODR(SENSOR_ODR);
+  status |= AccGyr.FIFO_Set_X_BDR(SENSOR_ODR);
+  status |= AccGyr.FIFO_Set_G_BDR(SENSOR_ODR);
+  status |= AccGyr.Enable_Timestamp();
+  status |= AccGyr.FIFO_Set_Timestamp_Batch(8);
+
+  // One interrupt every FRAME_SAMPLES accelerometer samples
+  status |= AccGyr.FIFO_Set_Batch_Counter(LSM6DSV16X_XL_BATCH_EVENT, FRAME_SAMPLES);
+  status |= AccGyr.FIFO_Set_INT1_Batch_Counter(1);
+  status |= AccGyr.FIFO_Set_Mode(LSM6DSV16X_STREAM_MODE);
+
+  if (status != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init/configure");
+    while (1);
+  }
+  Serial.println("LSM6DSV16X FIFO Batch Counter Demo");
+}
+
+void loop()
+{
+  uint16_t num_words;
+  uint8_t complete = 0;
+
+  if (frames_pending == 0) {
+    return;
+  }
+
+  if (AccGyr.FIFO_Get_Batch_Frame(words, FIFO_MAX_WORDS, &num_words, &complete) != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to read FIFO");
+    while (1);
+  }
+
+  // Other words (gyroscope, timestamps) are interleaved in the frame
+  for (uint16_t i = 0; i < num_words; i++) {
+    if (AccGyr.FIFO_Decode_X_Axes(&words[i], frame[frame_samples]) == LSM6DSV16X_OK) {
+      frame_samples++;
+    }
+  }
+
+  if (complete) {
+    noInterrupts();
+    frames_pending--;
+    interrupts();
+
+    Process_Frame();
+    frame_samples = 0;
+  }
+}
+
+void Process_Frame()
+{
+  float mean[3] = {0.0f, 0.0f, 0.0f};
+
+  for (uint16_t i = 0; i < frame_samples; i++) {
+    mean[0] += frame[i][0];
+    mean[1] += frame[i][1];
+    mean[2] += frame[i][2];
+  }
+
+  Serial.print("Frame mean [mg]: ");
+  Serial.print(mean[0] / frame_samples);
+  Serial.print(", ");
+  Serial.print(mean[1] / frame_samples);
+  Serial.print(", ");
+  Serial.println(mean[2] / frame_samples);
+}
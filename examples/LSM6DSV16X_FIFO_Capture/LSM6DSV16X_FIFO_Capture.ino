@@ -0,0 +1,98 @@
+/*
+   @file    LSM6DSV16X_FIFO_Capture.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X library to capture a high-rate
+            accelerometer snapshot around a wake-up (shock) event.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+
+#define CAPTURE_ODR 1920.0f // In Hertz
+#define CAPTURE_DEPTH 200 // FIFO words kept around the event
+#define INT1_pin PA4 // MCU input pin connected to sensor INT1 output pin
+
+LSM6DSV16XSensor AccGyr(&Wire);
+LSM6DSV16X_FIFO_Word_t words[CAPTURE_DEPTH];
+volatile uint8_t mems_event = 0;
+uint8_t status = 0;
+
+void setup()
+{
+  Serial.begin(115200);
+  Wire.begin();
+
+  // Enable INT1 pin.
+  attachInterrupt(INT1_pin, INT1_Event_cb, RISING);
+
+  // Initialize LSM6DSV16X.
+  AccGyr.begin();
+  status |= AccGyr.Enable_X();
+
+  // Keep the samples that precede a wake-up event, then fill up to the depth
+  status |= AccGyr.FIFO_Arm_Capture(LSM6DSV16X_CAPTURE_WAKE_UP, LSM6DSV16X_INT1_PIN, LSM6DSV16X_CAPTURE_PRE_TRIGGER, CAPTURE_DEPTH);
+
+  // Raise the ODR after arming, the trigger setup selects its own default
+  status |= AccGyr.Set_X_ODR(CAPTURE_ODR);
+  status |= AccGyr.Set_X_FS(16);
+  status |= AccGyr.Set_Wake_Up_Threshold(20);
+  status |= AccGyr.FIFO_Set_X_BDR(CAPTURE_ODR);
+
+  if (status != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init/configure");
+    while (1);
+  }
+  Serial.println("LSM6DSV16X FIFO Capture Demo");
+}
+
+void loop()
+{
+  uint8_t ready = 0;
+  uint16_t num_words = 0;
+  float sensitivity = 0.0f;
+
+  if (mems_event) {
+    if (AccGyr.FIFO_Get_Capture_Status(&ready) != LSM6DSV16X_OK) {
+      Serial.println("LSM6DSV16X Sensor failed to get capture status");
+      while (1);
+    }
+
+    if (ready) {
+      mems_event = 0;
+
+      // Drain the stopped FIFO, the capture is re-armed for the next event
+      if (AccGyr.FIFO_Read_Capture(words, CAPTURE_DEPTH, &num_words) != LSM6DSV16X_OK) {
+        Serial.println("LSM6DSV16X Sensor failed to read capture");
+        while (1);
+      }
+      AccGyr.Get_X_Sensitivity(&sensitivity);
+
+      Serial.print("Capture: ");
+      Serial.print(num_words);
+      Serial.println(" words");
+
+      for (uint16_t i = 0; i < num_words; i++) {
+        // Print the accelerometer samples only (tag 2)
+        if (words[i].Tag == 2) {
+          int16_t *raw = (int16_t *)words[i].Data;
+          char report[48];
+          snprintf(report, sizeof(report), "%d %d %d\r\n", (int)(raw[0] * sensitivity), (int)(raw[1] * sensitivity), (int)(raw[2] * sensitivity));
+          Serial.print(report);
+        }
+      }
+    }
+  }
+}
+
+void INT1_Event_cb()
+{
+  mems_event = 1;
+}
@@ -0,0 +1,88 @@
+/*
+   @file    LSM6DSV16X_FIFO_Config_Change.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X library to change the full scale
+            and the output data rate while the FIFO is streaming, converting
+            every sample with the configuration it was produced with.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+
+#define FIFO_MAX_WORDS 64
+#define SWITCH_PERIOD_MS 2000 // Time between two configuration changes
+
+LSM6DSV16XSensor AccGyr(&Wire);
+LSM6DSV16X_FIFO_Word_t words[FIFO_MAX_WORDS];
+const int32_t full_scales[] = {2, 4, 8, 16};
+const float odrs[] = {120.0f, 480.0f};
+uint8_t step = 0;
+uint32_t last_switch = 0;
+
+void setup()
+{
+  uint8_t status = 0;
+
+  Serial.begin(115200);
+  Wire.begin();
+
+  AccGyr.begin();
+  status |= AccGyr.Enable_X();
+  status |= AccGyr.Set_X_ODR(odrs[0]);
+  status |= AccGyr.Set_X_FS(full_scales[0]);
+  status |= AccGyr.FIFO_Set_X_BDR(odrs[0]);
+  // Snapshot the configuration before streaming, then follow every change
+  status |= AccGyr.FIFO_Enable_Config_Tracking();
+  status |= AccGyr.FIFO_Set_Mode(LSM6DSV16X_STREAM_MODE);
+
+  if (status != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init/configure");
+    while (1);
+  }
+  Serial.println("LSM6DSV16X FIFO Config Change Demo");
+}
+
+void loop()
+{
+  uint16_t num_words;
+  float acceleration[3];
+
+  if (millis() - last_switch > SWITCH_PERIOD_MS) {
+    last_switch = millis();
+    step++;
+    // The FIFO is not flushed: older samples keep their former scale
+    AccGyr.Set_X_FS(full_scales[step % 4]);
+    AccGyr.Set_X_ODR(odrs[(step / 4) % 2]);
+    AccGyr.FIFO_Set_X_BDR(odrs[(step / 4) % 2]);
+  }
+
+  if (AccGyr.FIFO_Get_Words(words, FIFO_MAX_WORDS, &num_words) != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to read FIFO");
+    while (1);
+  }
+
+  for (uint16_t i = 0; i < num_words; i++) {
+    if (words[i].Tag == 5) { // CFG_CHANGE
+      Serial.print("Configuration change, epoch ");
+      Serial.println(words[i].Cfg);
+      continue;
+    }
+    if (AccGyr.FIFO_Decode_X_Axes(&words[i], acceleration) == LSM6DSV16X_OK) {
+      Serial.print("Acc[mg]: ");
+      Serial.print(acceleration[0]);
+      Serial.print(", ");
+      Serial.print(acceleration[1]);
+      Serial.print(", ");
+      Serial.println(acceleration[2]);
+    }
+  }
+  delay(10);
+}
@@ -0,0 +1,132 @@
+/*
+   @file    LSM6DSV16X_FIFO_Latency.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to measure the FIFO interrupt-to-consume latency of the
+            LSM6DSV16X library. The latency trace must be enabled with the
+            global build flag -DLSM6DSV16X_LATENCY_TRACE=1 (a define in the
+            sketch does not reach the library).
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+
+#define SENSOR_ODR 120.0f // In Hertz
+#define ACC_FS 2 // In g
+#define GYR_FS 2000 // In dps
+#define FIFO_SAMPLE_THRESHOLD 64
+#define FIFO_MAX_WORDS 128
+#define REPORT_INTERVAL 5000 // In ms
+#define INT1_pin PA4 // MCU input pin connected to sensor INT1 output pin
+
+LSM6DSV16XSensor AccGyr(&Wire);
+LSM6DSV16X_FIFO_Word_t words[FIFO_MAX_WORDS];
+volatile uint8_t fullFlag = 0; // FIFO full flag
+uint8_t status = 0;
+unsigned long last_report = 0;
+uint32_t words_read = 0;
+
+void setup()
+{
+
+  Serial.begin(115200);
+  Wire.begin();
+
+  // Enable INT1 pin.
+  attachInterrupt(INT1_pin, INT1_fullEvent_cb, RISING);
+
+  // Initialize LSM6DSV16X.
+  AccGyr.begin();
+  status |= AccGyr.Enable_X();
+  status |= AccGyr.Enable_G();
+
+  // Configure ODR and FS of the acc and gyro
+  status |= AccGyr.Set_X_ODR(SENSOR_ODR);
+  status |= AccGyr.Set_X_FS(ACC_FS);
+  status |= AccGyr.Set_G_ODR(SENSOR_ODR);
+  status |= AccGyr.Set_G_FS(GYR_FS);
+
+  // Configure FIFO BDR for acc and gyro
+  status |= AccGyr.FIFO_Set_X_BDR(SENSOR_ODR);
+  status |= AccGyr.FIFO_Set_G_BDR(SENSOR_ODR);
+
+  // Set FIFO watermark level and stop on it, so that the full interrupt fires at the watermark
+  status |= AccGyr.FIFO_Set_Watermark_Level(FIFO_SAMPLE_THRESHOLD);
+  status |= AccGyr.FIFO_Set_Stop_On_Fth(1);
+  status |= AccGyr.FIFO_Set_INT1_FIFO_Full(1);
+  status |= AccGyr.FIFO_Set_Mode(LSM6DSV16X_STREAM_MODE);
+
+  if (status != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init/configure");
+    while (1);
+  }
+
+  if (AccGyr.Reset_Latency_Stats() != LSM6DSV16X_OK) {
+    Serial.println("Latency trace disabled, build with -DLSM6DSV16X_LATENCY_TRACE=1");
+  }
+
+  Serial.println("LSM6DSV16X FIFO Latency Demo");
+}
+
+void loop()
+{
+  uint16_t num_words = 0;
+
+  if (fullFlag != 0) {
+    fullFlag = 0;
+
+    // Drain the FIFO with burst reads
+    if (AccGyr.FIFO_Get_Words(words, FIFO_MAX_WORDS, &num_words) != LSM6DSV16X_OK) {
+      Serial.println("LSM6DSV16X Sensor failed to read FIFO");
+      while (1);
+    }
+    words_read += num_words;
+  }
+
+  if (millis() - last_report >= REPORT_INTERVAL) {
+    last_report = millis();
+    Print_Latency();
+  }
+}
+
+void Print_Latency()
+{
+  const char *names[LSM6DSV16X_LATENCY_CHANNELS] = {"irq_to_bus", "bus_transfer", "irq_to_read_end"};
+  LSM6DSV16X_Latency_Stats_t stats;
+
+  Serial.print("Words read: ");
+  Serial.println(words_read);
+
+  for (uint8_t i = 0; i < LSM6DSV16X_LATENCY_CHANNELS; i++) {
+    if (AccGyr.Get_Latency_Stats((LSM6DSV16X_Latency_Channel_t)i, &stats) != LSM6DSV16X_OK) {
+      return;
+    }
+
+    Serial.print(names[i]);
+    Serial.print(": n=");
+    Serial.print(stats.Count);
+    Serial.print(" min=");
+    Serial.print(stats.MinUs);
+    Serial.print("us p50=");
+    Serial.print(stats.P50Us);
+    Serial.print("us p99=");
+    Serial.print(stats.P99Us);
+    Serial.print("us max=");
+    Serial.print(stats.MaxUs);
+    Serial.println("us");
+  }
+}
+
+// ISR callback for INT1
+void INT1_fullEvent_cb()
+{
+  AccGyr.FIFO_Mark_Interrupt();
+  fullFlag = 1;
+}
@@ -0,0 +1,104 @@
+/*
+   @file    LSM6DSV16X_FIFO_Loss_Telemetry.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X library to count FIFO overruns and
+            lost samples while draining the FIFO, as telemetry to size the
+            watermark and the drain period.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+
+#define SENSOR_ODR 960.0f // In Hertz
+#define FIFO_WATERMARK 64
+#define NUM_WORDS 32
+#define REPORT_PERIOD_MS 5000
+
+LSM6DSV16XSensor AccGyr(&Wire);
+LSM6DSV16X_FIFO_Word_t words[NUM_WORDS];
+uint32_t drain_period_ms = 50; // Doubled at each report, until samples get lost
+unsigned long last_drain = 0;
+unsigned long last_report = 0;
+volatile uint32_t loss_events = 0;
+
+// Called by the library from the FIFO read that detects the loss
+void FIFO_Loss(uint32_t Lost, const LSM6DSV16X_FIFO_Stats_t *Stats)
+{
+  (void)Lost;
+  (void)Stats;
+  loss_events++;
+}
+
+void setup()
+{
+  uint8_t status = 0;
+
+  Serial.begin(115200);
+  Wire.begin();
+
+  AccGyr.begin();
+  status |= AccGyr.Enable_X();
+  status |= AccGyr.Enable_G();
+  status |= AccGyr.Set_X_ODR(SENSOR_ODR);
+  status |= AccGyr.Set_G_ODR(SENSOR_ODR);
+  status |= AccGyr.FIFO_Set_X_BDR(SENSOR_ODR);
+  status |= AccGyr.FIFO_Set_G_BDR(SENSOR_ODR);
+
+  // Timestamps let the library estimate losses longer than the 2-bit tag counter
+  status |= AccGyr.Enable_Timestamp();
+  status |= AccGyr.FIFO_Set_Timestamp_Batch(8);
+
+  status |= AccGyr.FIFO_Set_Watermark_Level(FIFO_WATERMARK);
+  status |= AccGyr.FIFO_Set_Mode(LSM6DSV16X_STREAM_MODE);
+  status |= AccGyr.FIFO_Set_Loss_Callback(FIFO_Loss);
+
+  if (status != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init/configure");
+    while (1);
+  }
+  Serial.println("LSM6DSV16X FIFO Loss Telemetry Demo");
+}
+
+void loop()
+{
+  uint16_t num_words;
+  LSM6DSV16X_FIFO_Stats_t stats;
+
+  if (millis() - last_drain >= drain_period_ms) {
+    last_drain = millis();
+    do {
+      AccGyr.FIFO_Get_Words(words, NUM_WORDS, &num_words);
+    } while (num_words == NUM_WORDS);
+  }
+
+  if (millis() - last_report >= REPORT_PERIOD_MS) {
+    last_report = millis();
+    AccGyr.FIFO_Get_Stats(&stats);
+
+    Serial.print("drain period: ");
+    Serial.print(drain_period_ms);
+    Serial.print(" ms max level: ");
+    Serial.print(stats.MaxLevel);
+    Serial.print(" watermark hits: ");
+    Serial.print(stats.WatermarkHits);
+    Serial.print(" overruns: ");
+    Serial.print(stats.Overruns);
+    Serial.print(" lost samples: ");
+    Serial.print(stats.LostSamples);
+    Serial.print(" loss events: ");
+    Serial.println(loss_events);
+
+    if (stats.LostSamples == 0) {
+      drain_period_ms *= 2;
+    }
+    AccGyr.FIFO_Reset_Stats();
+  }
+}
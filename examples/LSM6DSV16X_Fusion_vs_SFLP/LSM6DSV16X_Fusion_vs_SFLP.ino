@@ -0,0 +1,124 @@
+/*
+   @file    LSM6DSV16X_Fusion_vs_SFLP.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to compare the library 6-axis orientation filter, run on
+            the high-rate FIFO stream, with the on-chip SFLP game rotation
+            vector.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+#include <LSM6DSV16XFusion.h>
+
+// Up to 7680 Hz can be streamed over SPI, I2C at 400 kHz sustains about 1 kHz
+#define SENSOR_ODR 960.0f // In Hertz
+#define FIFO_BUFFER 64 // FIFO words read per loop
+
+LSM6DSV16XSensor AccGyr(&Wire);
+LSM6DSV16XFusion Fusion(SENSOR_ODR);
+LSM6DSV16X_FIFO_Word_t words[FIFO_BUFFER];
+uint8_t status = 0;
+
+// Comparison statistics
+uint32_t compared = 0;
+float err_sum = 0.0f;
+float err_max = 0.0f;
+uint32_t updates = 0;
+unsigned long filter_us = 0;
+unsigned long last_print = 0;
+
+void setup()
+{
+  float acc_sensitivity = 0.0f;
+  float gyro_sensitivity = 0.0f;
+
+  Serial.begin(115200);
+  Wire.begin();
+  Wire.setClock(400000);
+
+  // Initialize LSM6DSV16X.
+  AccGyr.begin();
+
+  // SFLP game rotation vector at 120 Hz, accelerometer and gyroscope batched at full rate
+  status |= AccGyr.Enable_Rotation_Vector();
+  status |= AccGyr.Set_X_ODR(SENSOR_ODR);
+  status |= AccGyr.Set_G_ODR(SENSOR_ODR);
+  status |= AccGyr.FIFO_Set_X_BDR(SENSOR_ODR);
+  status |= AccGyr.FIFO_Set_G_BDR(SENSOR_ODR);
+  status |= AccGyr.Get_X_Sensitivity(&acc_sensitivity);
+  status |= AccGyr.Get_G_Sensitivity(&gyro_sensitivity);
+  status |= Fusion.Set_Sensitivity(acc_sensitivity, gyro_sensitivity, 1.0f);
+
+  if (status != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init/configure");
+    while (1);
+  }
+  Serial.println("LSM6DSV16X Fusion vs SFLP Demo");
+}
+
+void loop()
+{
+  uint16_t num_words = 0;
+  uint16_t start = 0;
+  uint16_t num_updates = 0;
+  unsigned long t;
+  float sflp[4];
+  float host[4];
+  float dot;
+  float err;
+
+  if (AccGyr.FIFO_Get_Words(words, FIFO_BUFFER, &num_words) != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to read FIFO");
+    while (1);
+  }
+
+  for (uint16_t i = 0; i <= num_words; i++) {
+    // Run the filter on the words preceding each SFLP quaternion and on the last block
+    if (i < num_words && words[i].Tag != 0x13) {
+      continue;
+    }
+
+    t = micros();
+    Fusion.Process_Words(&words[start], i - start, &num_updates);
+    filter_us += micros() - t;
+    updates += num_updates;
+    start = i + 1;
+
+    if (i < num_words && AccGyr.FIFO_Decode_Rotation_Vector(&words[i], sflp) == LSM6DSV16X_OK) {
+      Fusion.Get_Quaternion(host);
+      dot = fabsf(sflp[0] * host[0] + sflp[1] * host[1] + sflp[2] * host[2] + sflp[3] * host[3]);
+      err = 2.0f * acosf(dot > 1.0f ? 1.0f : dot) * 57.29578f;
+      err_sum += err;
+      err_max = (err > err_max) ? err : err_max;
+      compared++;
+    }
+  }
+
+  if (millis() - last_print >= 1000 && compared != 0 && updates != 0) {
+    last_print = millis();
+
+    Serial.print("Updates/s: ");
+    Serial.print(updates);
+    Serial.print(", filter: ");
+    Serial.print((float)filter_us / updates, 2);
+    Serial.print(" us/update, angle to SFLP mean: ");
+    Serial.print(err_sum / compared, 2);
+    Serial.print(" deg, max: ");
+    Serial.print(err_max, 2);
+    Serial.println(" deg");
+
+    compared = 0;
+    err_sum = 0.0f;
+    err_max = 0.0f;
+    updates = 0;
+    filter_us = 0;
+  }
+}
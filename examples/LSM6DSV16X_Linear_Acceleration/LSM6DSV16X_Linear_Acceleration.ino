@@ -0,0 +1,109 @@
+/*
+   @file    LSM6DSV16X_Linear_Acceleration.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X library to convert batches of SFLP
+            game rotation vectors to Euler angles and to remove the gravity
+            from the accelerometer samples.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+#include <LSM6DSV16XOrientation.h>
+
+#define SENSOR_ODR 120.0f // SFLP and accelerometer batch rate, in Hz
+#define FIFO_BUFFER 48 // FIFO words read per loop
+#define BATCH 16 // Samples converted per kernel call
+
+LSM6DSV16XSensor AccGyr(&Wire);
+LSM6DSV16X_FIFO_Word_t words[FIFO_BUFFER];
+
+// One array per component
+float qx[BATCH], qy[BATCH], qz[BATCH], qw[BATCH];
+float ax[BATCH], ay[BATCH], az[BATCH];
+float lx[BATCH], ly[BATCH], lz[BATCH];
+float yaw[BATCH], pitch[BATCH], roll[BATCH];
+
+LSM6DSV16X_Quaternion_SoA_t quat = {qx, qy, qz, qw};
+LSM6DSV16X_Vector_SoA_t acc = {ax, ay, az};
+LSM6DSV16X_Vector_SoA_t linear = {lx, ly, lz};
+LSM6DSV16X_Euler_SoA_t euler = {yaw, pitch, roll};
+
+float last_quat[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+uint16_t count = 0;
+uint8_t status = 0;
+
+void setup()
+{
+  Serial.begin(115200);
+  Wire.begin();
+
+  // Initialize LSM6DSV16X.
+  AccGyr.begin();
+
+  // Game rotation vector and accelerometer in the same FIFO stream
+  status |= AccGyr.Enable_SFLP(SENSOR_ODR, LSM6DSV16X_SFLP_OUT_GAME_ROTATION);
+  status |= AccGyr.FIFO_Set_X_BDR(SENSOR_ODR);
+
+  if (status != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init/configure");
+    while (1);
+  }
+  Serial.println("LSM6DSV16X Linear Acceleration Demo");
+}
+
+void loop()
+{
+  uint16_t num_words = 0;
+  float sample[3];
+
+  if (AccGyr.FIFO_Get_Words(words, FIFO_BUFFER, &num_words) != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to read FIFO");
+    while (1);
+  }
+
+  for (uint16_t i = 0; i < num_words; i++) {
+    if (AccGyr.FIFO_Decode_Rotation_Vector(&words[i], last_quat) == LSM6DSV16X_OK) {
+      continue;
+    }
+    if (AccGyr.FIFO_Decode_X_Axes(&words[i], sample) != LSM6DSV16X_OK) {
+      continue;
+    }
+
+    // Pair each accelerometer sample with the latest orientation
+    qx[count] = last_quat[0];
+    qy[count] = last_quat[1];
+    qz[count] = last_quat[2];
+    qw[count] = last_quat[3];
+    ax[count] = sample[0];
+    ay[count] = sample[1];
+    az[count] = sample[2];
+
+    if (++count == BATCH) {
+      count = 0;
+      LSM6DSV16X_Quaternion_To_Euler_SoA(&quat, &euler, BATCH, LSM6DSV16X_FRAME_NED);
+      LSM6DSV16X_Linear_Acceleration_Earth_SoA(&quat, &acc, &linear, BATCH, LSM6DSV16X_FRAME_NED);
+
+      // Print the last sample of the batch
+      Serial.print("Yaw/Pitch/Roll [deg]: ");
+      Serial.print(yaw[BATCH - 1], 1);
+      Serial.print(", ");
+      Serial.print(pitch[BATCH - 1], 1);
+      Serial.print(", ");
+      Serial.print(roll[BATCH - 1], 1);
+      Serial.print(" North/East/Down [mg]: ");
+      Serial.print(lx[BATCH - 1], 1);
+      Serial.print(", ");
+      Serial.print(ly[BATCH - 1], 1);
+      Serial.print(", ");
+      Serial.println(lz[BATCH - 1], 1);
+    }
+  }
+}
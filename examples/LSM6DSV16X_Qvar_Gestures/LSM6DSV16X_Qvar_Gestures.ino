@@ -0,0 +1,94 @@
+/*
+   @file    LSM6DSV16X_Qvar_Gestures.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X library to stream timestamped Qvar
+            samples on the data-ready interrupt and detect touches, double
+            touches and swipes on the two electrodes.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+#include <LSM6DSV16XQvarGesture.h>
+
+#define SENSOR_ODR 240.0f // In Hertz, the Qvar data rate follows the accelerometer one
+#define INT2_pin PA5 // MCU input pin connected to sensor INT2 output pin
+
+LSM6DSV16XSensor AccGyr(&Wire);
+LSM6DSV16XQvarGesture Gestures;
+volatile uint8_t qvar_ready = 0;
+
+void INT2_qvarDataReady_cb()
+{
+  qvar_ready = 1;
+}
+
+void setup()
+{
+  uint8_t status = 0;
+  float resolution;
+
+  Serial.begin(115200);
+  Wire.begin();
+
+  attachInterrupt(INT2_pin, INT2_qvarDataReady_cb, RISING);
+
+  AccGyr.begin();
+  // The Qvar chain is enabled with the sensors in power-down
+  status |= AccGyr.QVAR_Enable();
+  status |= AccGyr.QVAR_SetImpedance(2400);
+  status |= AccGyr.Set_X_ODR(SENSOR_ODR);
+  status |= AccGyr.Enable_X();
+  status |= AccGyr.Enable_Timestamp();
+  status |= AccGyr.Get_Timestamp_Resolution(&resolution);
+  status |= Gestures.Set_Timestamp_Resolution(resolution);
+
+  if (status != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init/configure");
+    while (1);
+  }
+  Serial.println("LSM6DSV16X Qvar Gestures Demo");
+}
+
+void loop()
+{
+  LSM6DSV16X_QVAR_Sample_t sample;
+  LSM6DSV16X_QVAR_Gesture_t gesture;
+
+  if (qvar_ready == 0) {
+    return;
+  }
+  qvar_ready = 0;
+
+  // Value and timestamp come with a single burst
+  if (AccGyr.QVAR_Get_Sample(&sample) != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to read Qvar");
+    while (1);
+  }
+
+  Gestures.Process_Sample(&sample, &gesture);
+
+  switch (gesture) {
+    case LSM6DSV16X_QVAR_TOUCH:
+      Serial.println("Touch");
+      break;
+    case LSM6DSV16X_QVAR_DOUBLE_TOUCH:
+      Serial.println("Double touch");
+      break;
+    case LSM6DSV16X_QVAR_SWIPE_FORWARD:
+      Serial.println("Swipe forward");
+      break;
+    case LSM6DSV16X_QVAR_SWIPE_BACKWARD:
+      Serial.println("Swipe backward");
+      break;
+    default:
+      break;
+  }
+}
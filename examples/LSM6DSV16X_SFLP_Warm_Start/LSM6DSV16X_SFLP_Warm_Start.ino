@@ -0,0 +1,98 @@
+/*
+   @file    LSM6DSV16X_SFLP_Warm_Start.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X library to save the SFLP gyroscope
+            bias estimate and restart the SFLP from it, without waiting for
+            the filter to converge again.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+
+#define FIFO_BUFFER 16 // FIFO words read per loop
+#define CONVERGE_TIME 20000 // Time before saving the state, in ms
+
+LSM6DSV16XSensor AccGyr(&Wire);
+LSM6DSV16X_FIFO_Word_t words[FIFO_BUFFER];
+
+// To be kept in non-volatile memory (EEPROM, flash) across power cycles
+uint8_t saved_state[LSM6DSV16X_SFLP_STATE_SIZE];
+
+uint8_t status = 0;
+uint8_t restarted = 0;
+unsigned long start_time = 0;
+
+void setup()
+{
+  Serial.begin(115200);
+  Wire.begin();
+
+  // Initialize LSM6DSV16X.
+  AccGyr.begin();
+
+  // Game rotation vector and gyroscope bias at 120 Hz
+  status |= AccGyr.Enable_SFLP(120.0f, LSM6DSV16X_SFLP_OUT_GAME_ROTATION | LSM6DSV16X_SFLP_OUT_GYRO_BIAS);
+
+  if (status != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init/configure");
+    while (1);
+  }
+  Serial.println("LSM6DSV16X SFLP Warm Start Demo");
+  Serial.println("Keep the device still while the gyroscope bias converges...");
+  start_time = millis();
+}
+
+void loop()
+{
+  uint16_t num_words = 0;
+  float gbias[3];
+  float quat[4];
+
+  if (AccGyr.FIFO_Get_Words(words, FIFO_BUFFER, &num_words) != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to read FIFO");
+    while (1);
+  }
+
+  for (uint16_t i = 0; i < num_words; i++) {
+    if (AccGyr.FIFO_Decode_Gyroscope_Bias(&words[i], gbias) == LSM6DSV16X_OK) {
+      Serial.print("Gyroscope bias [mdps]: ");
+      Serial.print(gbias[0], 1);
+      Serial.print(", ");
+      Serial.print(gbias[1], 1);
+      Serial.print(", ");
+      Serial.println(gbias[2], 1);
+    } else if (AccGyr.FIFO_Decode_Rotation_Vector(&words[i], quat) == LSM6DSV16X_OK) {
+      // Rotation vector available for the application
+    }
+  }
+
+  if (!restarted && millis() - start_time > CONVERGE_TIME) {
+    restarted = 1;
+
+    // Save the converged state, e.g. before entering a low-power mode
+    if (AccGyr.Get_SFLP_State(saved_state, sizeof(saved_state)) != LSM6DSV16X_OK) {
+      Serial.println("LSM6DSV16X Sensor failed to save the SFLP state");
+      while (1);
+    }
+
+    // Wake up: the filter restarts from the saved bias instead of zero
+    Serial.println("Restarting the SFLP from the saved state");
+    status |= AccGyr.Disable_SFLP();
+    status |= AccGyr.Reset_SFLP();
+    status |= AccGyr.FIFO_Set_Mode(LSM6DSV16X_BYPASS_MODE);
+    status |= AccGyr.Restore_SFLP_State(saved_state, sizeof(saved_state));
+
+    if (status != LSM6DSV16X_OK) {
+      Serial.println("LSM6DSV16X Sensor failed to restore the SFLP state");
+      while (1);
+    }
+  }
+}
@@ -0,0 +1,67 @@
+/*
+   @file    LSM6DSV16X_Self_Test.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X library to run the accelerometer
+            and gyroscope self-test and check the results against the
+            datasheet limits.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+
+LSM6DSV16XSensor AccGyr(&Wire);
+LSM6DSV16X_Self_Test_Result_t result;
+
+void print_delta(const char *name, float *delta)
+{
+  Serial.print(name);
+  Serial.print(delta[0], 0);
+  Serial.print(", ");
+  Serial.print(delta[1], 0);
+  Serial.print(", ");
+  Serial.println(delta[2], 0);
+}
+
+void setup()
+{
+  unsigned long start;
+  LSM6DSV16XStatusTypeDef ret;
+
+  Serial.begin(115200);
+  Wire.begin();
+
+  // Initialize LSM6DSV16X.
+  AccGyr.begin();
+  AccGyr.Enable_X();
+  AccGyr.Enable_G();
+
+  Serial.println("LSM6DSV16X Self-Test Demo, keep the device still");
+
+  start = millis();
+  ret = AccGyr.Run_Self_Test(&result);
+
+  Serial.print("Duration [ms]: ");
+  Serial.println(millis() - start);
+  print_delta("XL delta [mg]: ", result.XLDelta);
+  print_delta("G delta [mdps]: ", result.GDelta);
+  Serial.print("XL: ");
+  Serial.println(result.XLPass ? "PASS" : "FAIL");
+  Serial.print("G: ");
+  Serial.println(result.GPass ? "PASS" : "FAIL");
+
+  if (ret != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Self-Test failed");
+  }
+}
+
+void loop()
+{
+}
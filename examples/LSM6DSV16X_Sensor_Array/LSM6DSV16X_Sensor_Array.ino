@@ -0,0 +1,107 @@
+/*
+   @file    LSM6DSV16X_Sensor_Array.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X library to acquire several sensors
+            sharing the same SPI bus and merge their FIFO data in a single
+            stream ordered by timestamp.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+#include <LSM6DSV16XArray.h>
+
+#define NUM_SENSORS 4
+#define SPI_SPEED 8000000 // Shared by all the sensors
+#define NUM_RECORDS 32
+
+// Chip select of each sensor
+const int cs_pins[NUM_SENSORS] = {10, 9, 8, 7};
+
+LSM6DSV16XSensor *imu[NUM_SENSORS];
+LSM6DSV16XArray imu_array;
+LSM6DSV16X_Array_Record_t records[NUM_RECORDS];
+unsigned long last_stats = 0;
+
+void setup()
+{
+  uint8_t index;
+
+  Serial.begin(115200);
+  SPI.begin();
+
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    imu[i] = new LSM6DSV16XSensor(&SPI, cs_pins[i], SPI_SPEED);
+    if (imu[i]->begin() != LSM6DSV16X_OK || imu_array.Add_Sensor(imu[i], &index) != LSM6DSV16X_OK) {
+      Serial.println("LSM6DSV16X Sensor failed to init");
+      while (1);
+    }
+  }
+
+  // Configure the first sensor with the usual API
+  imu[0]->Enable_X();
+  imu[0]->Enable_G();
+  imu[0]->Set_X_ODR(240.0f);
+  imu[0]->Set_G_ODR(240.0f);
+  imu[0]->FIFO_Set_X_BDR(240.0f);
+  imu[0]->FIFO_Set_G_BDR(240.0f);
+  imu[0]->FIFO_Set_Mode(LSM6DSV16X_STREAM_MODE);
+
+  // Copy the configuration to the others and start all of them together
+  if (imu_array.Clone_Configuration(0) != LSM6DSV16X_OK || imu_array.Start() != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X array failed to configure");
+    while (1);
+  }
+
+  imu_array.Set_Schedule(LSM6DSV16X_ARRAY_FILL_LEVEL);
+  Serial.println("LSM6DSV16X Sensor Array Demo");
+}
+
+void loop()
+{
+  uint16_t num_words = 0;
+  uint16_t num_records = 0;
+  LSM6DSV16X_Array_Stats_t stats;
+
+  imu_array.Service(&num_words);
+  imu_array.Get_Records(records, NUM_RECORDS, &num_records);
+
+  for (uint16_t i = 0; i < num_records; i++) {
+    // Records come in timestamp order, whatever the sensor
+    if (records[i].Tag == 0x02) { // Accelerometer
+      Serial.print(records[i].Timestamp);
+      Serial.print(" IMU");
+      Serial.print(records[i].Sensor);
+      Serial.print(" XL raw: ");
+      Serial.print((int16_t)(records[i].Data[1] << 8 | records[i].Data[0]));
+      Serial.print(", ");
+      Serial.print((int16_t)(records[i].Data[3] << 8 | records[i].Data[2]));
+      Serial.print(", ");
+      Serial.println((int16_t)(records[i].Data[5] << 8 | records[i].Data[4]));
+    }
+  }
+
+  if (millis() - last_stats > 5000) {
+    last_stats = millis();
+    for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+      imu_array.Get_Stats(i, &stats);
+      Serial.print("IMU");
+      Serial.print(i);
+      Serial.print(" records: ");
+      Serial.print(stats.Records);
+      Serial.print(" overruns: ");
+      Serial.print(stats.Overruns);
+      Serial.print(" dropped: ");
+      Serial.print(stats.Dropped);
+      Serial.print(" forced: ");
+      Serial.println(stats.Forced);
+    }
+  }
+}
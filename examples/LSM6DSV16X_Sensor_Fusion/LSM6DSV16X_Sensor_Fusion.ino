@@ -14,6 +14,7 @@
  *******************************************************************************
 */
 #include <LSM6DSV16XSensor.h>
+#include <LSM6DSV16XOrientation.h>
 
 #define ALGO_FREQ  120U /* Algorithm frequency 120Hz */
 #define ALGO_PERIOD  (1000U / ALGO_FREQ) /* Algorithm period [ms] */
@@ -25,6 +26,7 @@ uint32_t k = 0;
 
 uint8_t tag = 0;
 float quaternions[4] = {0};
+LSM6DSV16X_Euler_t euler;
 
 void setup()
 {
@@ -67,15 +69,26 @@ void loop()
       if (tag == 0x13u) {
         AccGyr.FIFO_Get_Rotation_Vector(&quaternions[0]);
 
-        // Print Quaternion data
+        // Convert to heading, pitch and roll in the North-East-Down convention
+        LSM6DSV16X_Quaternion_To_Euler((LSM6DSV16X_Quaternion_t *)quaternions, &euler, 1, LSM6DSV16X_FRAME_NED);
+
+        // Print Quaternion data (x, y, z, w)
         Serial.print("Quaternion: ");
-        Serial.print(quaternions[3], 4);
+        Serial.print(quaternions[0], 4);
         Serial.print(", ");
-        Serial.print(-quaternions[1], 4);
+        Serial.print(quaternions[1], 4);
         Serial.print(", ");
-        Serial.print(quaternions[0], 4);
+        Serial.print(quaternions[2], 4);
+        Serial.print(", ");
+        Serial.print(quaternions[3], 4);
+
+        // Print Euler angles [deg]
+        Serial.print(" Yaw/Pitch/Roll: ");
+        Serial.print(euler.Yaw, 2);
+        Serial.print(", ");
+        Serial.print(euler.Pitch, 2);
         Serial.print(", ");
-        Serial.println(quaternions[2], 4);
+        Serial.println(euler.Roll, 2);
 
         // Compute the elapsed time within loop cycle and wait
         elapsedTime = millis() - startTime;
@@ -0,0 +1,97 @@
+/*
+   @file    LSM6DSV16X_Sensor_Hub.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X sensor hub to read an external
+            LIS2MDL magnetometer and batch its data in the FIFO together
+            with the accelerometer and gyroscope data.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+
+#define SENSOR_ODR 120.0f // In Hertz
+#define FIFO_BUFFER 32 // FIFO words read per loop
+
+// LIS2MDL magnetometer connected to the LSM6DSV16X sensor hub lines
+#define LIS2MDL_ADDRESS     0x1E
+#define LIS2MDL_WHO_AM_I    0x4F
+#define LIS2MDL_CFG_REG_A   0x60
+#define LIS2MDL_CFG_REG_C   0x62
+#define LIS2MDL_OUTX_L_REG  0x68
+#define LIS2MDL_SENSITIVITY 1.5f // mGauss/LSB
+
+LSM6DSV16XSensor AccGyr(&Wire);
+LSM6DSV16X_FIFO_Word_t words[FIFO_BUFFER];
+uint8_t status = 0;
+
+void setup()
+{
+  uint8_t who_am_i = 0;
+
+  Serial.begin(115200);
+  Wire.begin();
+
+  // Initialize LSM6DSV16X.
+  AccGyr.begin();
+
+  // Check the magnetometer with a one-shot read.
+  status |= AccGyr.SH_Read_Reg(LIS2MDL_ADDRESS, LIS2MDL_WHO_AM_I, &who_am_i, 1);
+  if (status != LSM6DSV16X_OK || who_am_i != 0x40) {
+    Serial.println("LIS2MDL not found on the sensor hub");
+    while (1);
+  }
+
+  // Configure the magnetometer: temperature compensation, 100 Hz continuous mode, BDU.
+  status |= AccGyr.SH_Write_Reg(LIS2MDL_ADDRESS, LIS2MDL_CFG_REG_A, 0x8C);
+  status |= AccGyr.SH_Write_Reg(LIS2MDL_ADDRESS, LIS2MDL_CFG_REG_C, 0x10);
+
+  // Read the magnetometer output registers at each cycle and batch them.
+  status |= AccGyr.SH_Set_Slave(0, LIS2MDL_ADDRESS, LIS2MDL_OUTX_L_REG, 6);
+  status |= AccGyr.FIFO_SH_Set_Batch(0, 1);
+
+  status |= AccGyr.Enable_X();
+  status |= AccGyr.Enable_G();
+  status |= AccGyr.Set_X_ODR(SENSOR_ODR);
+  status |= AccGyr.Set_G_ODR(SENSOR_ODR);
+  status |= AccGyr.FIFO_Set_X_BDR(SENSOR_ODR);
+  status |= AccGyr.FIFO_Set_G_BDR(SENSOR_ODR);
+  status |= AccGyr.SH_Enable(SENSOR_ODR, 1);
+  status |= AccGyr.FIFO_Set_Mode(LSM6DSV16X_STREAM_MODE);
+
+  if (status != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init/configure");
+    while (1);
+  }
+  Serial.println("LSM6DSV16X Sensor Hub Demo");
+}
+
+void loop()
+{
+  uint16_t num_words = 0;
+  uint8_t slave = 0;
+
+  if (AccGyr.FIFO_Get_Words(words, FIFO_BUFFER, &num_words) != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to read FIFO");
+    while (1);
+  }
+
+  for (uint16_t i = 0; i < num_words; i++) {
+    // Print the magnetometer samples only
+    if (AccGyr.FIFO_Get_SH_Slave(words[i].Tag, &slave) == LSM6DSV16X_OK && slave == 0) {
+      int16_t *raw = (int16_t *)words[i].Data;
+      char report[48];
+      snprintf(report, sizeof(report), "Mag[mG]: %d %d %d\r\n", (int)(raw[0] * LIS2MDL_SENSITIVITY), (int)(raw[1] * LIS2MDL_SENSITIVITY), (int)(raw[2] * LIS2MDL_SENSITIVITY));
+      Serial.print(report);
+    }
+  }
+
+  delay(100);
+}
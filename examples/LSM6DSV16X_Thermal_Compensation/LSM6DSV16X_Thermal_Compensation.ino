@@ -0,0 +1,119 @@
+/*
+   @file    LSM6DSV16X_Thermal_Compensation.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X library to batch the temperature in
+            the FIFO and correct the gyroscope zero-rate drift with it, while
+            fitting the drift of the board when it is kept still.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+
+#define SENSOR_ODR 120.0f // In Hertz
+#define TEMPERATURE_BDR 1.875f // In Hertz
+#define FIFO_MAX_WORDS 128
+
+LSM6DSV16XSensor AccGyr(&Wire);
+LSM6DSV16X_FIFO_Word_t words[FIFO_MAX_WORDS];
+
+// Drift of this board, to be replaced with the slopes printed below
+LSM6DSV16X_Thermal_Model_t model = {
+  25.0f,                // Reference [degC]
+  {0.0f, 0.0f, 0.0f},   // XLOffset [mg/degC]
+  {0.0f, 0.0f, 0.0f},   // XLSensitivity [1/degC]
+  {0.0f, 0.0f, 0.0f},   // GOffset [mdps/degC]
+  {0.0f, 0.0f, 0.0f}    // GSensitivity [1/degC]
+};
+
+// Least-squares fit of the residual gyroscope output against the temperature
+float gyro_sum[3];
+uint16_t gyro_count = 0;
+float fit_n = 0.0f, fit_t = 0.0f, fit_tt = 0.0f;
+float fit_g[3], fit_tg[3];
+
+void setup()
+{
+  uint8_t status = 0;
+
+  Serial.begin(115200);
+  Wire.begin();
+
+  AccGyr.begin();
+  status |= AccGyr.Enable_G();
+  status |= AccGyr.Set_G_ODR(SENSOR_ODR);
+  status |= AccGyr.FIFO_Set_G_BDR(SENSOR_ODR);
+  status |= AccGyr.FIFO_Set_Temperature_BDR(TEMPERATURE_BDR);
+  status |= AccGyr.Enable_Thermal_Compensation(&model);
+  status |= AccGyr.FIFO_Set_Mode(LSM6DSV16X_STREAM_MODE);
+
+  if (status != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init/configure");
+    while (1);
+  }
+  Serial.println("LSM6DSV16X Thermal Compensation Demo");
+  Serial.println("Keep the board still while the temperature changes");
+}
+
+void loop()
+{
+  uint16_t num_words;
+  float angular_rate[3];
+  float temperature;
+
+  if (AccGyr.FIFO_Get_Words(words, FIFO_MAX_WORDS, &num_words) != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to read FIFO");
+    while (1);
+  }
+
+  for (uint16_t i = 0; i < num_words; i++) {
+    // The gyroscope words are already corrected at the last batched temperature
+    if (AccGyr.FIFO_Decode_G_Axes(&words[i], angular_rate) == LSM6DSV16X_OK) {
+      for (uint8_t j = 0; j < 3; j++) {
+        gyro_sum[j] += angular_rate[j];
+      }
+      gyro_count++;
+    } else if (AccGyr.FIFO_Decode_Temperature(&words[i], &temperature) == LSM6DSV16X_OK && gyro_count > 0) {
+      Fit_Point(temperature);
+    }
+  }
+  delay(100);
+}
+
+void Fit_Point(float temperature)
+{
+  float dt = temperature - model.Reference;
+  float det;
+
+  fit_n += 1.0f;
+  fit_t += dt;
+  fit_tt += dt * dt;
+  for (uint8_t j = 0; j < 3; j++) {
+    float mean = gyro_sum[j] / gyro_count;
+    fit_g[j] += mean;
+    fit_tg[j] += dt * mean;
+    gyro_sum[j] = 0.0f;
+  }
+  gyro_count = 0;
+
+  Serial.print("T[degC]: ");
+  Serial.print(temperature);
+
+  det = fit_n * fit_tt - fit_t * fit_t;
+  if (det > 1.0f) {
+    // Residual slope, to be added to model.GOffset
+    Serial.print(" Residual drift [mdps/degC]: ");
+    for (uint8_t j = 0; j < 3; j++) {
+      Serial.print((fit_n * fit_tg[j] - fit_t * fit_g[j]) / det);
+      Serial.print(j < 2 ? ", " : "");
+    }
+  }
+  Serial.println();
+}
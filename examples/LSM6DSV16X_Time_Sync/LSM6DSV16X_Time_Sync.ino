@@ -0,0 +1,113 @@
+/*
+   @file    LSM6DSV16X_Time_Sync.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X library to map the timestamps of
+            several sensors on the host clock, so that their samples can be
+            aligned in a common timebase.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+#include <LSM6DSV16XArray.h>
+#include <LSM6DSV16XTimeSync.h>
+
+#define NUM_SENSORS 2
+#define SPI_SPEED 8000000 // Shared by all the sensors
+#define NUM_RECORDS 32
+#define SYNC_PERIOD_MS 1000
+
+// Chip select of each sensor
+const int cs_pins[NUM_SENSORS] = {10, 9};
+
+LSM6DSV16XSensor *imu[NUM_SENSORS];
+LSM6DSV16XArray imu_array;
+LSM6DSV16XTimeSync time_sync;
+LSM6DSV16X_Array_Record_t records[NUM_RECORDS];
+unsigned long last_sync = 0;
+unsigned long last_info = 0;
+
+void setup()
+{
+  uint8_t index;
+
+  Serial.begin(115200);
+  SPI.begin();
+
+  // The same index is used in the array and in the synchronizer
+  for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+    imu[i] = new LSM6DSV16XSensor(&SPI, cs_pins[i], SPI_SPEED);
+    if (imu[i]->begin() != LSM6DSV16X_OK || imu_array.Add_Sensor(imu[i], &index) != LSM6DSV16X_OK
+        || time_sync.Add_Sensor(imu[i], &index) != LSM6DSV16X_OK) {
+      Serial.println("LSM6DSV16X Sensor failed to init");
+      while (1);
+    }
+  }
+
+  imu[0]->Enable_X();
+  imu[0]->Set_X_ODR(120.0f);
+  imu[0]->FIFO_Set_X_BDR(120.0f);
+  imu[0]->FIFO_Set_Mode(LSM6DSV16X_STREAM_MODE);
+
+  if (imu_array.Clone_Configuration(0) != LSM6DSV16X_OK || imu_array.Start() != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X array failed to configure");
+    while (1);
+  }
+
+  // First sync point, the offset is known from now on
+  time_sync.Sample_All();
+  last_sync = millis();
+
+  Serial.println("LSM6DSV16X Time Sync Demo");
+}
+
+void loop()
+{
+  uint16_t num_words = 0;
+  uint16_t num_records = 0;
+  uint32_t host_us;
+  LSM6DSV16X_Time_Sync_Info_t info;
+
+  // Periodic sync points let the fit follow the drift of each sensor clock
+  if (millis() - last_sync >= SYNC_PERIOD_MS) {
+    last_sync = millis();
+    time_sync.Sample_All();
+  }
+
+  imu_array.Service(&num_words);
+  imu_array.Get_Records(records, NUM_RECORDS, &num_records);
+
+  for (uint16_t i = 0; i < num_records; i++) {
+    if (records[i].Tag == 0x02 // Accelerometer
+        && time_sync.To_Host_Time(records[i].Sensor, records[i].Timestamp, &host_us) == LSM6DSV16X_OK) {
+      Serial.print(host_us);
+      Serial.print(" us IMU");
+      Serial.print(records[i].Sensor);
+      Serial.print(" XL raw z: ");
+      Serial.println((int16_t)(records[i].Data[5] << 8 | records[i].Data[4]));
+    }
+  }
+
+  if (millis() - last_info > 10000) {
+    last_info = millis();
+    for (uint8_t i = 0; i < NUM_SENSORS; i++) {
+      time_sync.Get_Info(i, &info);
+      Serial.print("IMU");
+      Serial.print(i);
+      Serial.print(" tick: ");
+      Serial.print(info.Resolution, 5);
+      Serial.print(" us skew: ");
+      Serial.print(info.SkewPpm, 1);
+      Serial.print(" ppm residual: ");
+      Serial.print(info.ResidualUs, 1);
+      Serial.println(" us");
+    }
+  }
+}
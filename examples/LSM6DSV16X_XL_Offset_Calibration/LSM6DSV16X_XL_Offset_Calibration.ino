@@ -0,0 +1,96 @@
+/*
+   @file    LSM6DSV16X_XL_Offset_Calibration.ino
+   @author  LSM6DSV16X library contributors
+   @brief   Example to use the LSM6DSV16X library to estimate the accelerometer
+            offset while the device is still and to program it in the user
+            offset registers, so that the output and FIFO data are corrected
+            by the sensor.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XSensor.h>
+
+LSM6DSV16XSensor AccGyr(&Wire);
+
+// To be kept in non-volatile memory (EEPROM, flash) across power cycles
+uint8_t saved_offset[LSM6DSV16X_XL_OFFSET_STATE_SIZE];
+uint8_t saved = 0;
+
+void setup()
+{
+  uint8_t status = 0;
+
+  Serial.begin(115200);
+  Wire.begin();
+
+  // Initialize LSM6DSV16X.
+  AccGyr.begin();
+  status |= AccGyr.Enable_X();
+  status |= AccGyr.Set_X_ODR(120.0f);
+
+  if (status != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to init/configure");
+    while (1);
+  }
+  Serial.println("LSM6DSV16X Accelerometer Offset Calibration Demo");
+
+  // A valid saved offset is restored instead of calibrating again
+  if (saved && AccGyr.Restore_X_Offset_State(saved_offset, sizeof(saved_offset)) == LSM6DSV16X_OK) {
+    Serial.println("Offset restored");
+    return;
+  }
+
+  Serial.println("Put the device still on a level surface...");
+  if (AccGyr.Start_X_Offset_Calibration() != LSM6DSV16X_OK) {
+    Serial.println("LSM6DSV16X Sensor failed to start the calibration");
+    while (1);
+  }
+}
+
+void loop()
+{
+  uint8_t done = 0;
+  float offset[3];
+  int32_t acceleration[3];
+
+  if (!saved) {
+    AccGyr.Service_X_Offset_Calibration(&done);
+    if (!done) {
+      return;
+    }
+
+    if (AccGyr.Stop_X_Offset_Calibration() != LSM6DSV16X_OK) {
+      Serial.println("LSM6DSV16X Sensor failed to program the offset");
+      while (1);
+    }
+
+    AccGyr.Get_X_User_Offset(offset);
+    Serial.print("Offset [mg]: ");
+    Serial.print(offset[0], 1);
+    Serial.print(", ");
+    Serial.print(offset[1], 1);
+    Serial.print(", ");
+    Serial.println(offset[2], 1);
+
+    AccGyr.Get_X_Offset_State(saved_offset, sizeof(saved_offset));
+    saved = 1;
+  }
+
+  // The data are now corrected by the sensor
+  AccGyr.Get_X_Axes(acceleration);
+  Serial.print("Acc[mg]: ");
+  Serial.print(acceleration[0]);
+  Serial.print(", ");
+  Serial.print(acceleration[1]);
+  Serial.print(", ");
+  Serial.println(acceleration[2]);
+  delay(500);
+}
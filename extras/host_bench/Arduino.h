@@ -0,0 +1,55 @@
+/*
+   @file    Arduino.h
+   @author  LSM6DSV16X library contributors
+   @brief   Minimal host stand-in of the Arduino core, enough to build the
+            library on a PC for the host benchmarks. No bus is attached.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#ifndef __HOST_ARDUINO_H__
+#define __HOST_ARDUINO_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+
+#define HIGH 0x1
+#define LOW  0x0
+#define INPUT  0x0
+#define OUTPUT 0x1
+#define MSBFIRST 1
+#define SPI_MODE3 3
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+inline unsigned long micros()
+{
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline unsigned long millis()
+{
+  return micros() / 1000UL;
+}
+
+inline void delay(unsigned long ms)
+{
+  unsigned long start = millis();
+  while (millis() - start < ms);
+}
+
+#endif /* __HOST_ARDUINO_H__ */
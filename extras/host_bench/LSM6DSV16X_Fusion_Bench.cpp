@@ -0,0 +1,124 @@
+/*
+   @file    LSM6DSV16X_Fusion_Bench.cpp
+   @author  LSM6DSV16X library contributors
+   @brief   Host benchmark of the LSM6DSV16XFusion update, in nanoseconds and
+            in CPU cycles per update (x86 time stamp counter).
+            The LSM6DSV16X_9Axis_Fusion example measures the same on the target.
+
+            Build and run from the library root directory:
+              gcc -O2 -Iextras/host_bench -Isrc -c src/lsm6dsv16x_reg.c -o lsm6dsv16x_reg.o
+              g++ -O2 -std=gnu++11 -Iextras/host_bench -Isrc extras/host_bench/LSM6DSV16X_Fusion_Bench.cpp \
+                  src/LSM6DSV16XFusion.cpp src/LSM6DSV16XSensor.cpp lsm6dsv16x_reg.o -o fusion_bench
+              ./fusion_bench
+            Add -DLSM6DSV16X_FUSION_MAHONY=1 (and -DLSM6DSV16X_FUSION_FIXED_POINT=1)
+            to the g++ line to measure the other filter variants.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#include <LSM6DSV16XFusion.h>
+#include <stdio.h>
+#if defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+  #define BENCH_CYCLES() __rdtsc()
+#endif
+
+#define BENCH_UPDATES 1000000UL
+#define BENCH_BATCH   32U
+
+typedef void (*Bench_Step_t)(LSM6DSV16XFusion *Fusion, uint32_t Index);
+
+static float acc[3] = {0.0f, 0.0f, 1000.0f};
+static float gyro[3] = {1000.0f, -500.0f, 250.0f};
+static float mag[3] = {200.0f, 0.0f, -400.0f};
+static LSM6DSV16X_FIFO_Word_t words[2 * BENCH_BATCH];
+
+static void Step_MARG(LSM6DSV16XFusion *Fusion, uint32_t Index)
+{
+  (void)Index;
+  Fusion->Update(acc, gyro, mag);
+}
+
+static void Step_IMU(LSM6DSV16XFusion *Fusion, uint32_t Index)
+{
+  (void)Index;
+  Fusion->Update(acc, gyro, NULL);
+}
+
+/* One call every BENCH_BATCH updates, so that the batch path is timed per update */
+static void Step_Words(LSM6DSV16XFusion *Fusion, uint32_t Index)
+{
+  uint16_t updates;
+
+  if ((Index % BENCH_BATCH) == 0U) {
+    Fusion->Process_Words(words, 2U * BENCH_BATCH, &updates);
+  }
+}
+
+static void Put_Word(LSM6DSV16X_FIFO_Word_t *Word, uint8_t Tag, int16_t X, int16_t Y, int16_t Z)
+{
+  Word->Tag = Tag;
+  Word->Cnt = 0;
+  Word->Cfg = 0;
+  Word->Data[0] = (uint8_t)X;
+  Word->Data[1] = (uint8_t)((uint16_t)X >> 8);
+  Word->Data[2] = (uint8_t)Y;
+  Word->Data[3] = (uint8_t)((uint16_t)Y >> 8);
+  Word->Data[4] = (uint8_t)Z;
+  Word->Data[5] = (uint8_t)((uint16_t)Z >> 8);
+}
+
+static void Run(const char *Name, Bench_Step_t Step)
+{
+  LSM6DSV16XFusion fusion(960.0f);
+  std::chrono::steady_clock::time_point start;
+  double ns;
+#ifdef BENCH_CYCLES
+  unsigned long long cycles;
+#endif
+
+  /* Warm up the caches and the branch predictors */
+  for (uint32_t i = 0; i < BENCH_UPDATES / 10U; i++) {
+    Step(&fusion, i);
+  }
+  fusion.Reset();
+
+  start = std::chrono::steady_clock::now();
+#ifdef BENCH_CYCLES
+  cycles = BENCH_CYCLES();
+#endif
+  for (uint32_t i = 0; i < BENCH_UPDATES; i++) {
+    Step(&fusion, i);
+  }
+#ifdef BENCH_CYCLES
+  cycles = BENCH_CYCLES() - cycles;
+#endif
+  ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+  printf("%s: %.1f ns", Name, ns / BENCH_UPDATES);
+#ifdef BENCH_CYCLES
+  printf(", %.0f cycles", (double)cycles / BENCH_UPDATES);
+#endif
+  printf(" per update\n");
+}
+
+int main()
+{
+  for (uint16_t i = 0; i < BENCH_BATCH; i++) {
+    Put_Word(&words[2U * i], 0x02, 0, 0, 16384);          /* XL_NC_TAG, 1 g at 2 g full scale */
+    Put_Word(&words[2U * i + 1U], 0x01, 875, -437, 218);  /* GY_NC_TAG */
+  }
+
+  Run("9-axis update", Step_MARG);
+  Run("6-axis update", Step_IMU);
+  Run("6-axis FIFO words", Step_Words);
+
+  return 0;
+}
@@ -0,0 +1,38 @@
+/*
+   @file    SPI.h
+   @author  LSM6DSV16X library contributors
+   @brief   Host stand-in of the Arduino SPI bus, nothing is attached:
+            every byte read is 0.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#ifndef __HOST_SPI_H__
+#define __HOST_SPI_H__
+
+#include "Arduino.h"
+
+class SPISettings {
+  public:
+    SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+class SPIClass {
+  public:
+    void begin() {}
+    void beginTransaction(SPISettings) {}
+    void endTransaction() {}
+    uint8_t transfer(uint8_t)
+    {
+      return 0;
+    }
+};
+
+#endif /* __HOST_SPI_H__ */
@@ -0,0 +1,48 @@
+/*
+   @file    Wire.h
+   @author  LSM6DSV16X library contributors
+   @brief   Host stand-in of the Arduino I2C bus, nothing is attached:
+            transmissions fail and no byte is ever available.
+ *******************************************************************************
+   Copyright (c) 2026, LSM6DSV16X library contributors
+   All rights reserved.
+
+   This software component is licensed under BSD 3-Clause license,
+   the "License"; You may not use this file except in compliance with the
+   License. You may obtain a copy of the License at:
+                          opensource.org/licenses/BSD-3-Clause
+
+ *******************************************************************************
+*/
+#ifndef __HOST_WIRE_H__
+#define __HOST_WIRE_H__
+
+#include "Arduino.h"
+
+class TwoWire {
+  public:
+    void begin() {}
+    void beginTransmission(uint8_t) {}
+    size_t write(uint8_t)
+    {
+      return 1;
+    }
+    uint8_t endTransmission(bool = true)
+    {
+      return 2;
+    }
+    uint8_t requestFrom(uint8_t, uint8_t)
+    {
+      return 0;
+    }
+    int available()
+    {
+      return 0;
+    }
+    int read()
+    {
+      return -1;
+    }
+};
+
+#endif /* __HOST_WIRE_H__ */
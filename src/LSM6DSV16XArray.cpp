@@ -0,0 +1,385 @@
+/**
+ ******************************************************************************
+ * @file    LSM6DSV16XArray.cpp
+ * @author  LSM6DSV16X library contributors
+ * @version V1.0.0
+ * @date    October 2026
+ * @brief   Implementation of the LSM6DSV16X sensor array manager.
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; COPYRIGHT(c) 2026 LSM6DSV16X library contributors</center></h2>
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of the copyright holder nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************
+ */
+
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "LSM6DSV16XArray.h"
+
+
+/* Class Implementation ------------------------------------------------------*/
+
+/** Constructor
+ */
+LSM6DSV16XArray::LSM6DSV16XArray()
+{
+  num_sensors = 0U;
+  schedule = LSM6DSV16X_ARRAY_ROUND_ROBIN;
+  next_sensor = 0U;
+  (void)memset((void *)queue_head, 0x0, sizeof(queue_head));
+  (void)memset((void *)queue_count, 0x0, sizeof(queue_count));
+  (void)memset((void *)timestamp_valid, 0x0, sizeof(timestamp_valid));
+  (void)memset((void *)timestamp_zero, 0x0, sizeof(timestamp_zero));
+  (void)memset((void *)stats, 0x0, sizeof(stats));
+}
+
+/**
+ * @brief  Add a sensor to the array, the sensor must already be initialized with begin()
+ * @param  Sensor pointer to the sensor
+ * @param  Index pointer where the index of the sensor in the array is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XArray::Add_Sensor(LSM6DSV16XSensor *Sensor, uint8_t *Index)
+{
+  if (Sensor == NULL || num_sensors >= LSM6DSV16X_ARRAY_MAX_SENSORS) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  sensor[num_sensors] = Sensor;
+  *Index = num_sensors;
+  num_sensors++;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Copy the configuration of one sensor to all the others
+ * @note   The source is read once, then each sensor is written with one burst per
+ *         register block. Embedded functions are not copied.
+ * @param  Source index of the configured sensor
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XArray::Clone_Configuration(uint8_t Source)
+{
+  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
+  LSM6DSV16X_Config_Image_t image;
+
+  if (Source >= num_sensors) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  (void)sensor[Source]->Begin_Bus_Transaction();
+  ret = sensor[Source]->Get_Config_Image(&image);
+  (void)sensor[Source]->End_Bus_Transaction();
+
+  for (uint8_t i = 0U; i < num_sensors && ret == LSM6DSV16X_OK; i++) {
+    if (i == Source) {
+      continue;
+    }
+    (void)sensor[i]->Begin_Bus_Transaction();
+    ret = sensor[i]->Set_Config_Image(&image);
+    (void)sensor[i]->End_Bus_Transaction();
+  }
+
+  return ret;
+}
+
+/**
+ * @brief  Select how the FIFOs are drained by Service
+ * @param  Schedule round-robin or fullest FIFO first
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XArray::Set_Schedule(LSM6DSV16X_Array_Schedule_t Schedule)
+{
+  schedule = Schedule;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Start the acquisition: timestamps are batched in every FIFO, the FIFOs are
+ *         flushed and the timestamp counters are restarted back to back
+ * @note   A timestamp word is batched with every sample, the records take the last timestamp
+ *         read before them and are not interpolated: the timestamp decimation must stay at 1.
+ *         The counters are read after the restart and the values are subtracted from the
+ *         timestamps, so that every sensor counts from Start even if a counter was not cleared.
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XArray::Start()
+{
+  uint8_t fifo_ctrl4[LSM6DSV16X_ARRAY_MAX_SENSORS];
+
+  for (uint8_t i = 0U; i < num_sensors; i++) {
+    (void)sensor[i]->Begin_Bus_Transaction();
+    if (sensor[i]->FIFO_Set_Timestamp_Batch(1) != LSM6DSV16X_OK
+        || sensor[i]->Disable_Timestamp() != LSM6DSV16X_OK
+        || sensor[i]->Read_Reg(LSM6DSV16X_FIFO_CTRL4, &fifo_ctrl4[i]) != LSM6DSV16X_OK
+        || sensor[i]->Write_Reg(LSM6DSV16X_FIFO_CTRL4, fifo_ctrl4[i] & 0xF8U) != LSM6DSV16X_OK) { /* Bypass mode */
+      (void)sensor[i]->End_Bus_Transaction();
+      return LSM6DSV16X_ERROR;
+    }
+    (void)sensor[i]->End_Bus_Transaction();
+  }
+
+  /* Restart the counters as close as possible to each other */
+  for (uint8_t i = 0U; i < num_sensors; i++) {
+    if (sensor[i]->Enable_Timestamp() != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  for (uint8_t i = 0U; i < num_sensors; i++) {
+    if (sensor[i]->Get_Timestamp(&timestamp_zero[i]) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  for (uint8_t i = 0U; i < num_sensors; i++) {
+    if (sensor[i]->Write_Reg(LSM6DSV16X_FIFO_CTRL4, fifo_ctrl4[i]) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+    queue_head[i] = 0U;
+    queue_count[i] = 0U;
+    timestamp_valid[i] = 0U;
+  }
+
+  next_sensor = 0U;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Drain the FIFO of one sensor, selected with the current schedule
+ * @param  NumWords pointer where the number of FIFO words read is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XArray::Service(uint16_t *NumWords)
+{
+  uint8_t index = 0U;
+  uint16_t level;
+  uint16_t best = 0U;
+  uint8_t overrun;
+
+  *NumWords = 0U;
+
+  if (num_sensors == 0U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (schedule == LSM6DSV16X_ARRAY_FILL_LEVEL) {
+    for (uint8_t i = 0U; i < num_sensors; i++) {
+      if (sensor[i]->FIFO_Get_Status(&level, &overrun) != LSM6DSV16X_OK) {
+        return LSM6DSV16X_ERROR;
+      }
+      /* Overrun first, then the highest level */
+      if (overrun != 0U) {
+        level = 0xFFFFU;
+      }
+      if (level > best) {
+        best = level;
+        index = i;
+      }
+    }
+
+    if (best == 0U) {
+      return LSM6DSV16X_OK;
+    }
+  } else {
+    index = next_sensor;
+    next_sensor = (uint8_t)((next_sensor + 1U) % num_sensors);
+  }
+
+  return Drain(index, NumWords);
+}
+
+/**
+ * @brief  Get the records of all the sensors merged in timestamp order
+ * @note   A record is released only when every sensor has delivered a timestamp
+ *         at least as recent, so that later drains cannot produce older records.
+ *         When a sensor is not drained the queues of the others fill up: a full queue
+ *         makes the oldest records be released anyway until it is half empty, so that
+ *         its FIFO keeps being drained, and the Forced counters report the records that
+ *         may be out of order.
+ * @param  Records array where the records are written
+ * @param  MaxRecords size of the Records array
+ * @param  NumRecords pointer where the number of records written is stored
+ * @param  Flush 1 to release all the buffered records, e.g. at the end of the acquisition
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XArray::Get_Records(LSM6DSV16X_Array_Record_t *Records, uint16_t MaxRecords, uint16_t *NumRecords, uint8_t Flush)
+{
+  uint32_t horizon = 0U;
+  uint32_t oldest = 0U;
+  uint8_t best;
+  uint8_t ready = 1U;
+  uint8_t stalled = LSM6DSV16X_ARRAY_MAX_SENSORS;
+
+  *NumRecords = 0U;
+
+  /* Oldest of the last timestamps: nothing older can still be in a FIFO */
+  for (uint8_t i = 0U; i < num_sensors && Flush == 0U; i++) {
+    if (timestamp_valid[i] == 0U) {
+      ready = 0U;
+      break;
+    }
+    if (i == 0U || (int32_t)(last_timestamp[i] - horizon) < 0) {
+      horizon = last_timestamp[i];
+    }
+  }
+
+  /* K-way merge of the sensor queues */
+  while (*NumRecords < MaxRecords) {
+    best = LSM6DSV16X_ARRAY_MAX_SENSORS;
+    for (uint8_t i = 0U; i < num_sensors; i++) {
+      if (queue_count[i] == 0U) {
+        continue;
+      }
+      if (stalled == LSM6DSV16X_ARRAY_MAX_SENSORS && queue_count[i] == LSM6DSV16X_ARRAY_QUEUE_SIZE) {
+        stalled = i;
+      }
+      if (best == LSM6DSV16X_ARRAY_MAX_SENSORS || (int32_t)(queue[i][queue_head[i]].Timestamp - oldest) < 0) {
+        best = i;
+        oldest = queue[i][queue_head[i]].Timestamp;
+      }
+    }
+
+    if (best == LSM6DSV16X_ARRAY_MAX_SENSORS) {
+      break;
+    }
+
+    if (Flush == 0U && (ready == 0U || (int32_t)(oldest - horizon) > 0)) {
+      /* Stalled by a sensor that is behind: release the oldest records until the full queue is half empty */
+      if (stalled == LSM6DSV16X_ARRAY_MAX_SENSORS || queue_count[stalled] <= LSM6DSV16X_ARRAY_QUEUE_SIZE / 2U) {
+        break;
+      }
+      stats[best].Forced++;
+    }
+
+    Records[*NumRecords] = queue[best][queue_head[best]];
+    (*NumRecords)++;
+    queue_head[best] = (uint16_t)((queue_head[best] + 1U) % LSM6DSV16X_ARRAY_QUEUE_SIZE);
+    queue_count[best]--;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the acquisition counters of a sensor
+ * @param  Index index of the sensor
+ * @param  Stats pointer where the counters are written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XArray::Get_Stats(uint8_t Index, LSM6DSV16X_Array_Stats_t *Stats)
+{
+  if (Index >= num_sensors) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  *Stats = stats[Index];
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Reset the acquisition counters of all the sensors
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XArray::Reset_Stats()
+{
+  (void)memset((void *)stats, 0x0, sizeof(stats));
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Move the FIFO words of a sensor to its queue, tagging them with the last timestamp
+ * @note   No more words than the free queue slots are read, the rest stays in the FIFO
+ * @param  Index index of the sensor
+ * @param  NumWords pointer where the number of FIFO words read is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XArray::Drain(uint8_t Index, uint16_t *NumWords)
+{
+  LSM6DSV16X_FIFO_Word_t words[LSM6DSV16X_ARRAY_DRAIN_WORDS];
+  LSM6DSV16X_Array_Record_t *record;
+  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
+  uint16_t level = 0U;
+  uint16_t chunk;
+  uint16_t read;
+  uint8_t overrun = 0U;
+
+  (void)sensor[Index]->Begin_Bus_Transaction();
+
+  ret = sensor[Index]->FIFO_Get_Status(&level, &overrun);
+  if (overrun != 0U) {
+    stats[Index].Overruns++;
+  }
+
+  while (ret == LSM6DSV16X_OK && level > 0U) {
+    chunk = LSM6DSV16X_ARRAY_QUEUE_SIZE - queue_count[Index];
+    chunk = (chunk < LSM6DSV16X_ARRAY_DRAIN_WORDS) ? chunk : LSM6DSV16X_ARRAY_DRAIN_WORDS;
+    chunk = (chunk < level) ? chunk : level;
+    if (chunk == 0U) {
+      break;
+    }
+
+    ret = sensor[Index]->FIFO_Get_Words(words, chunk, &read);
+    if (ret != LSM6DSV16X_OK || read == 0U) {
+      break;
+    }
+
+    for (uint16_t i = 0U; i < read; i++) {
+      if (sensor[Index]->FIFO_Decode_Timestamp(&words[i], &last_timestamp[Index]) == LSM6DSV16X_OK) {
+        last_timestamp[Index] -= timestamp_zero[Index];
+        timestamp_valid[Index] = 1U;
+        continue;
+      }
+
+      if (timestamp_valid[Index] == 0U) {
+        stats[Index].Dropped++;
+        continue;
+      }
+
+      record = &queue[Index][(queue_head[Index] + queue_count[Index]) % LSM6DSV16X_ARRAY_QUEUE_SIZE];
+      record->Timestamp = last_timestamp[Index];
+      record->Sensor = Index;
+      record->Tag = words[i].Tag;
+      record->Cnt = words[i].Cnt;
+      (void)memcpy((void *)record->Data, (void *)words[i].Data, sizeof(record->Data));
+      queue_count[Index]++;
+      stats[Index].Records++;
+    }
+
+    *NumWords += read;
+    level -= read;
+  }
+
+  (void)sensor[Index]->End_Bus_Transaction();
+
+  return ret;
+}
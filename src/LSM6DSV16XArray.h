@@ -0,0 +1,131 @@
+/**
+ ******************************************************************************
+ * @file    LSM6DSV16XArray.h
+ * @author  LSM6DSV16X library contributors
+ * @version V1.0.0
+ * @date    October 2026
+ * @brief   Manager of several LSM6DSV16X sensors sharing a bus.
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; COPYRIGHT(c) 2026 LSM6DSV16X library contributors</center></h2>
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of the copyright holder nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************
+ */
+
+
+/* Prevent recursive inclusion -----------------------------------------------*/
+
+#ifndef __LSM6DSV16XArray_H__
+#define __LSM6DSV16XArray_H__
+
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "LSM6DSV16XSensor.h"
+
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Sensors managed by an array */
+#ifndef LSM6DSV16X_ARRAY_MAX_SENSORS
+  #define LSM6DSV16X_ARRAY_MAX_SENSORS  8U
+#endif
+
+/* Records buffered per sensor waiting for the merge */
+#ifndef LSM6DSV16X_ARRAY_QUEUE_SIZE
+  #define LSM6DSV16X_ARRAY_QUEUE_SIZE  32U
+#endif
+
+/* FIFO words read per burst while draining a sensor */
+#define LSM6DSV16X_ARRAY_DRAIN_WORDS  16U
+
+
+/* Typedefs ------------------------------------------------------------------*/
+
+typedef enum {
+  LSM6DSV16X_ARRAY_ROUND_ROBIN, /* One sensor per Service call, in turn */
+  LSM6DSV16X_ARRAY_FILL_LEVEL   /* The sensor with the fullest FIFO first */
+} LSM6DSV16X_Array_Schedule_t;
+
+typedef struct {
+  uint32_t Timestamp; /* Last timestamp word read before the sample, counted from Start [LSB, 21.75 us typ.] */
+  uint8_t Sensor;     /* Index returned by Add_Sensor */
+  uint8_t Tag;
+  uint8_t Cnt;
+  uint8_t Data[6];
+} LSM6DSV16X_Array_Record_t;
+
+typedef struct {
+  uint32_t Records;   /* Records queued for the merge */
+  uint32_t Overruns;  /* Drains that found the FIFO overrun flag set */
+  uint32_t Dropped;   /* Samples discarded because no timestamp was read yet */
+  uint32_t Forced;    /* Records released before every sensor caught up because a queue was full */
+} LSM6DSV16X_Array_Stats_t;
+
+
+/* Class Declaration ---------------------------------------------------------*/
+
+/**
+ * Owns several LSM6DSV16X sensors on the same bus: clones the configuration
+ * of one sensor to the others, drains their FIFOs with the selected schedule
+ * and merges the samples in a single stream ordered by timestamp.
+ */
+class LSM6DSV16XArray {
+  public:
+    LSM6DSV16XArray();
+    LSM6DSV16XStatusTypeDef Add_Sensor(LSM6DSV16XSensor *Sensor, uint8_t *Index);
+    LSM6DSV16XStatusTypeDef Clone_Configuration(uint8_t Source);
+    LSM6DSV16XStatusTypeDef Set_Schedule(LSM6DSV16X_Array_Schedule_t Schedule);
+    LSM6DSV16XStatusTypeDef Start();
+    LSM6DSV16XStatusTypeDef Service(uint16_t *NumWords);
+    LSM6DSV16XStatusTypeDef Get_Records(LSM6DSV16X_Array_Record_t *Records, uint16_t MaxRecords, uint16_t *NumRecords, uint8_t Flush = 0);
+    LSM6DSV16XStatusTypeDef Get_Stats(uint8_t Index, LSM6DSV16X_Array_Stats_t *Stats);
+    LSM6DSV16XStatusTypeDef Reset_Stats();
+
+  private:
+    LSM6DSV16XStatusTypeDef Drain(uint8_t Index, uint16_t *NumWords);
+
+    LSM6DSV16XSensor *sensor[LSM6DSV16X_ARRAY_MAX_SENSORS];
+    uint8_t num_sensors;
+    LSM6DSV16X_Array_Schedule_t schedule;
+    uint8_t next_sensor;
+
+    /* Per-sensor ring of timestamped records */
+    LSM6DSV16X_Array_Record_t queue[LSM6DSV16X_ARRAY_MAX_SENSORS][LSM6DSV16X_ARRAY_QUEUE_SIZE];
+    uint16_t queue_head[LSM6DSV16X_ARRAY_MAX_SENSORS];
+    uint16_t queue_count[LSM6DSV16X_ARRAY_MAX_SENSORS];
+
+    /* Last timestamp word read from each FIFO */
+    uint32_t last_timestamp[LSM6DSV16X_ARRAY_MAX_SENSORS];
+    uint8_t timestamp_valid[LSM6DSV16X_ARRAY_MAX_SENSORS];
+
+    /* Counter value read right after the restart, subtracted from every timestamp */
+    uint32_t timestamp_zero[LSM6DSV16X_ARRAY_MAX_SENSORS];
+
+    LSM6DSV16X_Array_Stats_t stats[LSM6DSV16X_ARRAY_MAX_SENSORS];
+};
+
+#endif /* __LSM6DSV16XArray_H__ */
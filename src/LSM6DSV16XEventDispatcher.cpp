@@ -0,0 +1,289 @@
+/**
+ ******************************************************************************
+ * @file    LSM6DSV16XEventDispatcher.cpp
+ * @author  LSM6DSV16X library contributors
+ * @version V1.0.0
+ * @date    October 2026
+ * @brief   Interrupt event dispatcher for the LSM6DSV16X.
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; COPYRIGHT(c) 2026 LSM6DSV16X library contributors</center></h2>
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of the copyright holder nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************
+ */
+
+
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "LSM6DSV16XEventDispatcher.h"
+
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Main page registers holding the source of each event */
+#define LSM6DSV16X_EVENT_SRC_FIRST  LSM6DSV16X_WAKE_UP_SRC
+#define LSM6DSV16X_EVENT_SRC_LAST   LSM6DSV16X_MLC_STATUS_MAINPAGE
+
+
+/* Class Implementation ------------------------------------------------------*/
+
+/* Source register of each event, in LSM6DSV16X_Event_t order */
+static const uint8_t event_reg[LSM6DSV16X_EVENT_NUMBER] = {
+  LSM6DSV16X_TAP_SRC,                   /* SINGLE_TAP */
+  LSM6DSV16X_TAP_SRC,                   /* DOUBLE_TAP */
+  LSM6DSV16X_WAKE_UP_SRC,               /* FREE_FALL */
+  LSM6DSV16X_WAKE_UP_SRC,               /* WAKE_UP */
+  LSM6DSV16X_WAKE_UP_SRC,               /* SLEEP_CHANGE */
+  LSM6DSV16X_D6D_SRC,                   /* 6D_ORIENTATION */
+  LSM6DSV16X_EMB_FUNC_STATUS_MAINPAGE,  /* TILT */
+  LSM6DSV16X_EMB_FUNC_STATUS_MAINPAGE,  /* STEP */
+  LSM6DSV16X_EMB_FUNC_STATUS_MAINPAGE,  /* SIGNIFICANT_MOTION */
+  LSM6DSV16X_MLC_STATUS_MAINPAGE,       /* MLC */
+  LSM6DSV16X_FSM_STATUS_MAINPAGE,       /* FSM */
+  LSM6DSV16X_FIFO_STATUS2,              /* FIFO_WATERMARK */
+  LSM6DSV16X_FIFO_STATUS2,              /* FIFO_FULL */
+  LSM6DSV16X_FIFO_STATUS2               /* FIFO_OVERRUN */
+};
+
+/** Constructor
+ * @param Sensor pointer to the sensor, already initialized with begin()
+ */
+LSM6DSV16XEventDispatcher::LSM6DSV16XEventDispatcher(LSM6DSV16XSensor *Sensor) : sensor(Sensor)
+{
+  for (uint8_t i = 0; i < LSM6DSV16X_EVENT_NUMBER; i++) {
+    callback[i] = NULL;
+    context[i] = NULL;
+  }
+  fifo_burst = 0U;
+  src_first = 0U;
+  src_last = 0U;
+  irq_pending = 0U;
+  memset(&sources, 0, sizeof(sources));
+}
+
+/**
+ * @brief  Register the handler of an event
+ * @note   The event must also be enabled and routed to INT1 or INT2 on the sensor
+ * @param  Event event to be handled
+ * @param  Callback function called from Service when the event is found, NULL to remove it
+ * @param  Context pointer passed to the callback
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XEventDispatcher::Set_Callback(LSM6DSV16X_Event_t Event, LSM6DSV16X_Event_Callback_t Callback, void *Context)
+{
+  if ((uint8_t)Event >= LSM6DSV16X_EVENT_NUMBER) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  callback[Event] = Callback;
+  context[Event] = Context;
+  Update_Burst();
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Read the event sources and call the handlers, if an interrupt was marked
+ * @note   Returns without bus access when no interrupt is pending, so it can be
+ *         called on every pass of the main loop or from an RTOS task woken by the ISR
+ * @param  Events pointer where the mask of the events found is written, bit n for event n
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XEventDispatcher::Service(uint16_t *Events)
+{
+  uint8_t pending;
+
+  /* Clear before reading, so that an interrupt raised during the burst is serviced next time */
+  noInterrupts();
+  pending = irq_pending;
+  irq_pending = 0;
+  interrupts();
+
+  if (pending == 0U) {
+    *Events = 0U;
+    return LSM6DSV16X_OK;
+  }
+
+  return Service_Now(Events);
+}
+
+/**
+ * @brief  Read the event sources and call the handlers, whether or not an interrupt was marked
+ * @note   Reading the source registers clears the latched interrupts
+ * @param  Events pointer where the mask of the events found is written, bit n for event n
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XEventDispatcher::Service_Now(uint16_t *Events)
+{
+  uint8_t fifo[2] = {0};
+  uint8_t src[LSM6DSV16X_EVENT_SRC_LAST - LSM6DSV16X_EVENT_SRC_FIRST + 1] = {0};
+  uint16_t found;
+
+  *Events = 0U;
+
+  /* Through the sensor, so that the overrun cleared by the read is still accounted */
+  if (fifo_burst != 0U && sensor->FIFO_Get_Status_Regs(fifo) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (src_last != 0U
+      && sensor->Read_Regs(src_first, &src[src_first - LSM6DSV16X_EVENT_SRC_FIRST], src_last - src_first + 1U) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  sources.FifoStatus1 = fifo[0];
+  sources.FifoStatus2 = fifo[1];
+  sources.WakeUpSrc = src[LSM6DSV16X_WAKE_UP_SRC - LSM6DSV16X_EVENT_SRC_FIRST];
+  sources.TapSrc = src[LSM6DSV16X_TAP_SRC - LSM6DSV16X_EVENT_SRC_FIRST];
+  sources.D6DSrc = src[LSM6DSV16X_D6D_SRC - LSM6DSV16X_EVENT_SRC_FIRST];
+  sources.StatusMaster = src[LSM6DSV16X_STATUS_MASTER_MAINPAGE - LSM6DSV16X_EVENT_SRC_FIRST];
+  sources.EmbFuncStatus = src[LSM6DSV16X_EMB_FUNC_STATUS_MAINPAGE - LSM6DSV16X_EVENT_SRC_FIRST];
+  sources.FsmStatus = src[LSM6DSV16X_FSM_STATUS_MAINPAGE - LSM6DSV16X_EVENT_SRC_FIRST];
+  sources.MlcStatus = src[LSM6DSV16X_MLC_STATUS_MAINPAGE - LSM6DSV16X_EVENT_SRC_FIRST];
+
+  found = Decode();
+
+  /* Handlers see the same snapshot, none of them needs to read the sensor again */
+  for (uint8_t i = 0; i < LSM6DSV16X_EVENT_NUMBER; i++) {
+    if ((found & (1U << i)) != 0U && callback[i] != NULL) {
+      callback[i]((LSM6DSV16X_Event_t)i, &sources, context[i]);
+    }
+  }
+
+  *Events = found;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the source registers read by the last service
+ * @param  Sources pointer where the registers are written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XEventDispatcher::Get_Sources(LSM6DSV16X_Event_Sources_t *Sources)
+{
+  *Sources = sources;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Compute the registers to be read from the registered handlers
+ * @note   A single burst from the lowest to the highest source register is cheaper
+ *         than one transaction per register, even with a few unused bytes in between
+ */
+void LSM6DSV16XEventDispatcher::Update_Burst()
+{
+  fifo_burst = 0U;
+  src_first = 0U;
+  src_last = 0U;
+
+  for (uint8_t i = 0; i < LSM6DSV16X_EVENT_NUMBER; i++) {
+    uint8_t reg = event_reg[i];
+
+    if (callback[i] == NULL) {
+      continue;
+    }
+
+    if (reg == LSM6DSV16X_FIFO_STATUS2) {
+      fifo_burst = 1U;
+      continue;
+    }
+
+    if (src_last == 0U || reg < src_first) {
+      src_first = reg;
+    }
+    if (reg > src_last) {
+      src_last = reg;
+    }
+  }
+}
+
+/**
+ * @brief  Find the events set in the last snapshot
+ * @retval mask of the events found, bit n for event n
+ */
+uint16_t LSM6DSV16XEventDispatcher::Decode()
+{
+  lsm6dsv16x_fifo_status2_t fifo_status2;
+  lsm6dsv16x_wake_up_src_t wake_up_src;
+  lsm6dsv16x_tap_src_t tap_src;
+  lsm6dsv16x_d6d_src_t d6d_src;
+  lsm6dsv16x_emb_func_status_mainpage_t emb_func_status;
+  uint16_t found = 0U;
+
+  memcpy(&fifo_status2, &sources.FifoStatus2, 1);
+  memcpy(&wake_up_src, &sources.WakeUpSrc, 1);
+  memcpy(&tap_src, &sources.TapSrc, 1);
+  memcpy(&d6d_src, &sources.D6DSrc, 1);
+  memcpy(&emb_func_status, &sources.EmbFuncStatus, 1);
+
+  if (tap_src.single_tap != 0U) {
+    found |= 1U << LSM6DSV16X_EVENT_SINGLE_TAP;
+  }
+  if (tap_src.double_tap != 0U) {
+    found |= 1U << LSM6DSV16X_EVENT_DOUBLE_TAP;
+  }
+  if (wake_up_src.ff_ia != 0U) {
+    found |= 1U << LSM6DSV16X_EVENT_FREE_FALL;
+  }
+  if (wake_up_src.wu_ia != 0U) {
+    found |= 1U << LSM6DSV16X_EVENT_WAKE_UP;
+  }
+  if (wake_up_src.sleep_change_ia != 0U) {
+    found |= 1U << LSM6DSV16X_EVENT_SLEEP_CHANGE;
+  }
+  if (d6d_src.d6d_ia != 0U) {
+    found |= 1U << LSM6DSV16X_EVENT_6D_ORIENTATION;
+  }
+  if (emb_func_status.is_tilt != 0U) {
+    found |= 1U << LSM6DSV16X_EVENT_TILT;
+  }
+  if (emb_func_status.is_step_det != 0U) {
+    found |= 1U << LSM6DSV16X_EVENT_STEP;
+  }
+  if (emb_func_status.is_sigmot != 0U) {
+    found |= 1U << LSM6DSV16X_EVENT_SIGNIFICANT_MOTION;
+  }
+  if (sources.MlcStatus != 0U) {
+    found |= 1U << LSM6DSV16X_EVENT_MLC;
+  }
+  if (sources.FsmStatus != 0U) {
+    found |= 1U << LSM6DSV16X_EVENT_FSM;
+  }
+  if (fifo_status2.fifo_wtm_ia != 0U) {
+    found |= 1U << LSM6DSV16X_EVENT_FIFO_WATERMARK;
+  }
+  if (fifo_status2.fifo_full_ia != 0U) {
+    found |= 1U << LSM6DSV16X_EVENT_FIFO_FULL;
+  }
+  if (fifo_status2.fifo_ovr_ia != 0U || fifo_status2.fifo_ovr_latched != 0U) {
+    found |= 1U << LSM6DSV16X_EVENT_FIFO_OVERRUN;
+  }
+
+  return found;
+}
@@ -0,0 +1,137 @@
+/**
+ ******************************************************************************
+ * @file    LSM6DSV16XEventDispatcher.h
+ * @author  LSM6DSV16X library contributors
+ * @version V1.0.0
+ * @date    October 2026
+ * @brief   Interrupt event dispatcher for the LSM6DSV16X.
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; COPYRIGHT(c) 2026 LSM6DSV16X library contributors</center></h2>
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of the copyright holder nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************
+ */
+
+
+
+/* Prevent recursive inclusion -----------------------------------------------*/
+
+#ifndef __LSM6DSV16XEventDispatcher_H__
+#define __LSM6DSV16XEventDispatcher_H__
+
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "LSM6DSV16XSensor.h"
+
+
+/* Typedefs ------------------------------------------------------------------*/
+
+typedef enum {
+  LSM6DSV16X_EVENT_SINGLE_TAP,
+  LSM6DSV16X_EVENT_DOUBLE_TAP,
+  LSM6DSV16X_EVENT_FREE_FALL,
+  LSM6DSV16X_EVENT_WAKE_UP,
+  LSM6DSV16X_EVENT_SLEEP_CHANGE,
+  LSM6DSV16X_EVENT_6D_ORIENTATION,
+  LSM6DSV16X_EVENT_TILT,
+  LSM6DSV16X_EVENT_STEP,
+  LSM6DSV16X_EVENT_SIGNIFICANT_MOTION,
+  LSM6DSV16X_EVENT_MLC,
+  LSM6DSV16X_EVENT_FSM,
+  LSM6DSV16X_EVENT_FIFO_WATERMARK,
+  LSM6DSV16X_EVENT_FIFO_FULL,
+  LSM6DSV16X_EVENT_FIFO_OVERRUN,
+  LSM6DSV16X_EVENT_NUMBER
+} LSM6DSV16X_Event_t;
+
+/* Source registers read by the last service, 0 when not part of the burst */
+typedef struct {
+  uint8_t FifoStatus1;        /* FIFO_STATUS1 (0x1B), FIFO level [7:0] */
+  uint8_t FifoStatus2;        /* FIFO_STATUS2 (0x1C) */
+  uint8_t WakeUpSrc;          /* WAKE_UP_SRC (0x45) */
+  uint8_t TapSrc;             /* TAP_SRC (0x46) */
+  uint8_t D6DSrc;             /* D6D_SRC (0x47) */
+  uint8_t StatusMaster;       /* STATUS_MASTER_MAINPAGE (0x48) */
+  uint8_t EmbFuncStatus;      /* EMB_FUNC_STATUS_MAINPAGE (0x49) */
+  uint8_t FsmStatus;          /* FSM_STATUS_MAINPAGE (0x4A), one bit per FSM */
+  uint8_t MlcStatus;          /* MLC_STATUS_MAINPAGE (0x4B), one bit per MLC */
+} LSM6DSV16X_Event_Sources_t;
+
+typedef void (*LSM6DSV16X_Event_Callback_t)(LSM6DSV16X_Event_t Event, const LSM6DSV16X_Event_Sources_t *Sources, void *Context);
+
+
+/* Class Declaration ---------------------------------------------------------*/
+
+/**
+ * Reads the interrupt sources of an LSM6DSV16X once per interrupt and calls the
+ * handler registered for each event found. Only the registers covering the
+ * registered events are read: FIFO_STATUS1..2 and one burst within 0x45..0x4B,
+ * all in the main page, so no bank switch is needed.
+ */
+class LSM6DSV16XEventDispatcher {
+  public:
+    LSM6DSV16XEventDispatcher(LSM6DSV16XSensor *Sensor);
+    LSM6DSV16XStatusTypeDef Set_Callback(LSM6DSV16X_Event_t Event, LSM6DSV16X_Event_Callback_t Callback, void *Context);
+    LSM6DSV16XStatusTypeDef Service(uint16_t *Events);
+    LSM6DSV16XStatusTypeDef Service_Now(uint16_t *Events);
+    LSM6DSV16XStatusTypeDef Get_Sources(LSM6DSV16X_Event_Sources_t *Sources);
+
+    /**
+     * @brief Record the arrival of an INT1 or INT2 interrupt, to be called from the ISR.
+     */
+    void Mark_Interrupt()
+    {
+      irq_pending = 1;
+    }
+
+    /**
+     * @brief Check whether an interrupt is waiting to be serviced.
+     */
+    uint8_t Is_Pending()
+    {
+      return irq_pending;
+    }
+
+  private:
+    void Update_Burst();
+    uint16_t Decode();
+
+    LSM6DSV16XSensor *sensor;
+
+    LSM6DSV16X_Event_Callback_t callback[LSM6DSV16X_EVENT_NUMBER];
+    void *context[LSM6DSV16X_EVENT_NUMBER];
+
+    /* Registers read on service */
+    uint8_t fifo_burst;
+    uint8_t src_first;
+    uint8_t src_last;       /* 0 when no source register is needed */
+
+    volatile uint8_t irq_pending;
+    LSM6DSV16X_Event_Sources_t sources;
+};
+
+#endif /* __LSM6DSV16XEventDispatcher_H__ */
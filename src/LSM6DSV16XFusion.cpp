@@ -0,0 +1,1023 @@
+/**
+ ******************************************************************************
+ * @file    LSM6DSV16XFusion.cpp
+ * @author  LSM6DSV16X library contributors
+ * @version V1.0.0
+ * @date    October 2026
+ * @brief   Implementation of the LSM6DSV16X orientation filter.
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; COPYRIGHT(c) 2026 LSM6DSV16X library contributors</center></h2>
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of the copyright holder nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************
+ */
+
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "LSM6DSV16XFusion.h"
+#include <math.h>
+
+
+/* Defines -------------------------------------------------------------------*/
+
+#define LSM6DSV16X_FUSION_MDPS_TO_RADS  (3.14159265f / 180000.0f)
+#define LSM6DSV16X_FUSION_SH_TAG        0x0EU /* SENSORHUB_SLAVE0_TAG */
+
+
+/* Private functions ---------------------------------------------------------*/
+
+static void Word_To_Raw(const LSM6DSV16X_FIFO_Word_t *Word, int16_t raw[3])
+{
+  raw[0] = (int16_t)((uint16_t)Word->Data[1] << 8 | Word->Data[0]);
+  raw[1] = (int16_t)((uint16_t)Word->Data[3] << 8 | Word->Data[2]);
+  raw[2] = (int16_t)((uint16_t)Word->Data[5] << 8 | Word->Data[4]);
+}
+
+#if LSM6DSV16X_FUSION_FIXED_POINT
+/* Integer square root, 32 iterations */
+static uint32_t Isqrt(uint64_t x)
+{
+  uint64_t res = 0U;
+  uint64_t bit = 1ULL << 62;
+
+  while (bit != 0U) {
+    if (x >= res + bit) {
+      x -= res + bit;
+      res = (res >> 1) + bit;
+    } else {
+      res >>= 1;
+    }
+    bit >>= 2;
+  }
+
+  return (uint32_t)res;
+}
+#endif
+
+
+/* Class Implementation ------------------------------------------------------*/
+/** Constructor
+ * @param SampleRate gyroscope batch data rate [Hz], one update is run per gyroscope sample
+ * @param Beta filter gain, higher values trust more the accelerometer and the magnetometer
+ */
+LSM6DSV16XFusion::LSM6DSV16XFusion(float SampleRate, float Beta)
+{
+  beta = Beta;
+  sample_period = (SampleRate > 0.0f) ? 1.0f / SampleRate : 0.0f;
+  acc_sensitivity = LSM6DSV16X_ACC_SENSITIVITY_FS_2G;
+  gyro_sensitivity = LSM6DSV16X_GYRO_SENSITIVITY_FS_2000DPS;
+  mag_sensitivity = 1.5f;
+  mag_tag = LSM6DSV16X_FUSION_SH_TAG;
+  sens_source = NULL;
+  sens_cfg = 0U;
+  mag_cal_running = 0U;
+  batch_len = 0U;
+  thermal_enabled = 0U;
+  temperature = 25.0f;
+#if LSM6DSV16X_FUSION_MAHONY
+  ki = 0.0f;
+#endif
+
+  for (uint8_t i = 0U; i < 3U; i++) {
+    mag_cal.HardIron[i] = 0.0f;
+    for (uint8_t j = 0U; j < 3U; j++) {
+      mag_cal.SoftIron[i][j] = (i == j) ? 1.0f : 0.0f;
+    }
+  }
+
+  Update_Conversion();
+  Reset();
+}
+
+/**
+ * @brief  Reset the orientation to the identity and discard the buffered samples
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Reset()
+{
+  q0 = 1.0f;
+  q1 = 0.0f;
+  q2 = 0.0f;
+  q3 = 0.0f;
+  acc_valid = 0U;
+  mag_valid = 0U;
+  batch_len = 0U;
+#if LSM6DSV16X_FUSION_MAHONY
+  integral[0] = 0.0f;
+  integral[1] = 0.0f;
+  integral[2] = 0.0f;
+#endif
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Set the filter sample rate
+ * @param  SampleRate gyroscope batch data rate [Hz]
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Set_Sample_Rate(float SampleRate)
+{
+  if (SampleRate <= 0.0f) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  sample_period = 1.0f / SampleRate;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Set the filter gain
+ * @param  Beta filter gain (Madgwick), twice the proportional gain (Mahony)
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Set_Beta(float Beta)
+{
+  if (Beta < 0.0f) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  beta = Beta;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Set the integral gain of the Mahony filter, which estimates the gyroscope bias
+ * @note   Not used by the Madgwick filter and by the fixed-point batch update
+ * @param  Ki integral gain, 0 to disable the integral feedback
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Set_Integral_Gain(float Ki)
+{
+#if LSM6DSV16X_FUSION_MAHONY
+  if (Ki < 0.0f) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  ki = Ki;
+  if (ki == 0.0f) {
+    integral[0] = 0.0f;
+    integral[1] = 0.0f;
+    integral[2] = 0.0f;
+  }
+
+  return LSM6DSV16X_OK;
+#else
+  (void)Ki;
+  return LSM6DSV16X_ERROR;
+#endif
+}
+
+/**
+ * @brief  Set the conversion factors of the raw FIFO data
+ * @param  AccSensitivity accelerometer sensitivity [mg/LSB]
+ * @param  GyroSensitivity gyroscope sensitivity [mdps/LSB]
+ * @param  MagSensitivity magnetometer sensitivity [mgauss/LSB]
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Set_Sensitivity(float AccSensitivity, float GyroSensitivity, float MagSensitivity)
+{
+  if (AccSensitivity <= 0.0f || GyroSensitivity <= 0.0f || MagSensitivity <= 0.0f) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  acc_sensitivity = AccSensitivity;
+  gyro_sensitivity = GyroSensitivity;
+  mag_sensitivity = MagSensitivity;
+  Update_Conversion();
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Take the accelerometer and gyroscope sensitivities from the FIFO configuration tracking
+ * @note   Each word is converted with the configuration it was produced with, see
+ *         FIFO_Enable_Config_Tracking. The filter waits for the first accelerometer
+ *         sample after a configuration change.
+ * @param  Sensor pointer to the sensor the words are read from, NULL to use Set_Sensitivity
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Set_Sensitivity_Source(LSM6DSV16XSensor *Sensor)
+{
+  sens_source = Sensor;
+  if (sens_source == NULL) {
+    return LSM6DSV16X_OK;
+  }
+
+  /* The next word loads the sensitivities of its configuration */
+  sens_cfg = 0U;
+  return Update_Config(0U);
+}
+
+/**
+ * @brief  Set the drift model of the accelerometer and gyroscope axes with the temperature
+ * @note   The temperature is taken from the temperature words of the FIFO stream
+ *         (see FIFO_Set_Temperature_BDR) or set with Set_Temperature.
+ *         The model is checked with LSM6DSV16XSensor::Check_Thermal_Model.
+ * @param  Model pointer to the drift model, NULL to disable the thermal correction
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Set_Thermal_Model(const LSM6DSV16X_Thermal_Model_t *Model)
+{
+  if (Model == NULL) {
+    thermal_enabled = 0U;
+  } else {
+    if (LSM6DSV16XSensor::Check_Thermal_Model(Model) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+    thermal_model = *Model;
+    thermal_enabled = 1U;
+  }
+  Update_Conversion();
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Set the temperature of the next samples, when it is not batched in the FIFO
+ * @param  Temperature sensor temperature [degC]
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Set_Temperature(float Temperature)
+{
+  temperature = Temperature;
+  Update_Conversion();
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Set the sensor hub slave which reads the magnetometer
+ * @param  Slave slave index (0 to 3)
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Set_Mag_Slave(uint8_t Slave)
+{
+  if (Slave >= LSM6DSV16X_SH_MAX_SLAVES) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  mag_tag = LSM6DSV16X_FUSION_SH_TAG + Slave;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Set the magnetometer hard-iron and soft-iron calibration
+ * @note   The soft-iron matrix can also include the rotation from the magnetometer
+ *         axes to the LSM6DSV16X axes
+ * @param  Calibration pointer to the calibration to be applied
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Set_Mag_Calibration(const LSM6DSV16X_Mag_Calibration_t *Calibration)
+{
+  mag_cal = *Calibration;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the magnetometer hard-iron and soft-iron calibration
+ * @param  Calibration pointer where the calibration is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Get_Mag_Calibration(LSM6DSV16X_Mag_Calibration_t *Calibration)
+{
+  *Calibration = mag_cal;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Start the magnetometer calibration, the device must then be rotated in all directions
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Start_Mag_Calibration()
+{
+  for (uint8_t i = 0U; i < 3U; i++) {
+    mag_min[i] = 3.4e38f;
+    mag_max[i] = -3.4e38f;
+  }
+
+  mag_cal_running = 1U;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Stop the magnetometer calibration and apply the estimated hard-iron offset and soft-iron scale
+ * @note   The off-diagonal soft-iron terms are cleared
+ * @retval 0 in case of success, an error code otherwise (not enough rotation seen)
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Stop_Mag_Calibration()
+{
+  float radius[3];
+  float avg_radius = 0.0f;
+
+  if (mag_cal_running == 0U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  mag_cal_running = 0U;
+
+  for (uint8_t i = 0U; i < 3U; i++) {
+    radius[i] = (mag_max[i] - mag_min[i]) / 2.0f;
+    if (!(radius[i] > 0.0f)) {
+      return LSM6DSV16X_ERROR;
+    }
+    avg_radius += radius[i] / 3.0f;
+  }
+
+  for (uint8_t i = 0U; i < 3U; i++) {
+    mag_cal.HardIron[i] = (mag_max[i] + mag_min[i]) / 2.0f;
+    for (uint8_t j = 0U; j < 3U; j++) {
+      mag_cal.SoftIron[i][j] = (i == j) ? avg_radius / radius[i] : 0.0f;
+    }
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Process a decoded FIFO word
+ * @note   The accelerometer and magnetometer words are buffered, each gyroscope
+ *         word runs one filter update with the last buffered samples
+ * @param  Word pointer to the FIFO word
+ * @param  Updated pointer where 1 is written if a new quaternion is available, 0 otherwise
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Process_Word(const LSM6DSV16X_FIFO_Word_t *Word, uint8_t *Updated)
+{
+  int16_t raw[3];
+  float value[3];
+
+  *Updated = 0U;
+
+  if (sens_source != NULL && Word->Cfg != sens_cfg) {
+    if (Update_Config(Word->Cfg) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  Word_To_Raw(Word, raw);
+
+  switch (Word->Tag) {
+    case 2: /* XL_NC_TAG */
+      acc_raw[0] = raw[0];
+      acc_raw[1] = raw[1];
+      acc_raw[2] = raw[2];
+      acc[0] = (float)raw[0] * acc_scale[0] - acc_offset[0];
+      acc[1] = (float)raw[1] * acc_scale[1] - acc_offset[1];
+      acc[2] = (float)raw[2] * acc_scale[2] - acc_offset[2];
+      acc_valid = 1U;
+      break;
+
+    case 3: /* TEMPERATURE_TAG */
+      (void)Set_Temperature(lsm6dsv16x_from_lsb_to_celsius(raw[0]));
+      break;
+
+    case 1: /* GY_NC_TAG */
+      if (acc_valid == 0U) {
+        break;
+      }
+      value[0] = (float)raw[0] * gyro_scale[0] - gyro_offset[0];
+      value[1] = (float)raw[1] * gyro_scale[1] - gyro_offset[1];
+      value[2] = (float)raw[2] * gyro_scale[2] - gyro_offset[2];
+      if (Update(acc, value, (mag_valid != 0U) ? mag : NULL) != LSM6DSV16X_OK) {
+        return LSM6DSV16X_ERROR;
+      }
+      *Updated = 1U;
+      break;
+
+    default:
+      if (Word->Tag == mag_tag) {
+        mag[0] = (float)raw[0] * mag_sensitivity;
+        mag[1] = (float)raw[1] * mag_sensitivity;
+        mag[2] = (float)raw[2] * mag_sensitivity;
+        mag_valid = 1U;
+      }
+      break;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Process a block of decoded FIFO words with the 6-axis filter
+ * @note   The gyroscope samples are collected in batches of LSM6DSV16X_FUSION_BATCH,
+ *         which are then converted in a single pass before running the filter.
+ *         The magnetometer words are ignored, use Process_Word for the 9-axis filter.
+ * @param  Words pointer to the FIFO words
+ * @param  NumWords number of FIFO words
+ * @param  Updates pointer where the number of filter updates is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Process_Words(const LSM6DSV16X_FIFO_Word_t *Words, uint16_t NumWords, uint16_t *Updates)
+{
+  int16_t raw[3];
+
+  *Updates = 0U;
+
+  if (sample_period == 0.0f) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  for (uint16_t i = 0U; i < NumWords; i++) {
+    if (sens_source != NULL && Words[i].Cfg != sens_cfg) {
+      /* The samples already collected keep the previous sensitivities */
+      if (batch_len != 0U) {
+        Run_Batch();
+      }
+      if (Update_Config(Words[i].Cfg) != LSM6DSV16X_OK) {
+        return LSM6DSV16X_ERROR;
+      }
+    }
+
+    Word_To_Raw(&Words[i], raw);
+
+    if (Words[i].Tag == 2U) { /* XL_NC_TAG */
+      acc_raw[0] = raw[0];
+      acc_raw[1] = raw[1];
+      acc_raw[2] = raw[2];
+      acc[0] = (float)raw[0] * acc_scale[0] - acc_offset[0];
+      acc[1] = (float)raw[1] * acc_scale[1] - acc_offset[1];
+      acc[2] = (float)raw[2] * acc_scale[2] - acc_offset[2];
+      acc_valid = 1U;
+    } else if (Words[i].Tag == 3U) { /* TEMPERATURE_TAG */
+      /* The samples already collected keep the previous correction */
+      if (batch_len != 0U) {
+        Run_Batch();
+      }
+      (void)Set_Temperature(lsm6dsv16x_from_lsb_to_celsius(raw[0]));
+    } else if (Words[i].Tag == 1U && acc_valid != 0U) { /* GY_NC_TAG */
+      for (uint8_t j = 0U; j < 3U; j++) {
+        batch_acc[j][batch_len] = acc_raw[j];
+        batch_gyro[j][batch_len] = raw[j];
+      }
+      batch_len++;
+      (*Updates)++;
+
+      if (batch_len == LSM6DSV16X_FUSION_BATCH) {
+        Run_Batch();
+      }
+    }
+  }
+
+  if (batch_len != 0U) {
+    Run_Batch();
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Run one filter update
+ * @param  Acceleration accelerometer data [mg]
+ * @param  AngularRate gyroscope data [mdps]
+ * @param  MagneticField uncalibrated magnetometer data [mgauss], NULL to run a 6-axis update
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Update(const float Acceleration[3], const float AngularRate[3], const float MagneticField[3])
+{
+  float gx = AngularRate[0] * LSM6DSV16X_FUSION_MDPS_TO_RADS;
+  float gy = AngularRate[1] * LSM6DSV16X_FUSION_MDPS_TO_RADS;
+  float gz = AngularRate[2] * LSM6DSV16X_FUSION_MDPS_TO_RADS;
+  float m[3];
+  float norm;
+
+  if (sample_period == 0.0f) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (MagneticField == NULL) {
+    norm = Acceleration[0] * Acceleration[0] + Acceleration[1] * Acceleration[1] + Acceleration[2] * Acceleration[2];
+    norm = (norm > 0.0f) ? 1.0f / sqrtf(norm) : 0.0f;
+    Update_IMU(gx, gy, gz, Acceleration[0] * norm, Acceleration[1] * norm, Acceleration[2] * norm);
+    return LSM6DSV16X_OK;
+  }
+
+  if (mag_cal_running != 0U) {
+    for (uint8_t i = 0U; i < 3U; i++) {
+      if (MagneticField[i] < mag_min[i]) {
+        mag_min[i] = MagneticField[i];
+      }
+      if (MagneticField[i] > mag_max[i]) {
+        mag_max[i] = MagneticField[i];
+      }
+    }
+  }
+
+  for (uint8_t i = 0U; i < 3U; i++) {
+    m[i] = mag_cal.SoftIron[i][0] * (MagneticField[0] - mag_cal.HardIron[0])
+           + mag_cal.SoftIron[i][1] * (MagneticField[1] - mag_cal.HardIron[1])
+           + mag_cal.SoftIron[i][2] * (MagneticField[2] - mag_cal.HardIron[2]);
+  }
+
+  Update_MARG(gx, gy, gz, Acceleration[0], Acceleration[1], Acceleration[2], m[0], m[1], m[2]);
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the last orientation
+ * @param  Quaternion pointer where the quaternion is written (x, y, z, w)
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Get_Quaternion(float Quaternion[4])
+{
+  Quaternion[0] = q1;
+  Quaternion[1] = q2;
+  Quaternion[2] = q3;
+  Quaternion[3] = q0;
+
+  return LSM6DSV16X_OK;
+}
+
+#if LSM6DSV16X_FUSION_FIXED_POINT
+/**
+ * @brief  Run the filter on the collected batch with integer arithmetic
+ * @note   The quaternion is kept in Q2.30 format during the batch and the
+ *         Mahony proportional correction is applied, with Kp = beta / 2
+ */
+void LSM6DSV16XFusion::Run_Batch()
+{
+  const int64_t one = 1LL << 30;
+  /* Half rotation angle per gyroscope LSB, Q46, and half rotation angle of the offset, Q30 */
+  int64_t kg[3];
+  int64_t kh[3];
+  /* Accelerometer gain relative to the sensitivity and offset [LSB], Q14 */
+  int32_t ka[3];
+  int32_t kb[3];
+  /* Correction gain per sample, Q32 */
+  const int64_t kc = (int64_t)(0.5f * sample_period * beta * 4294967296.0f);
+  int64_t w = (int64_t)(q0 * 1073741824.0f);
+  int64_t x = (int64_t)(q1 * 1073741824.0f);
+  int64_t y = (int64_t)(q2 * 1073741824.0f);
+  int64_t z = (int64_t)(q3 * 1073741824.0f);
+  int64_t hx, hy, hz, dw, dx, dy, dz, f;
+  /* With a thermal gain up to 2 the corrected samples exceed 16 bits */
+  int64_t ax, ay, az;
+  uint32_t n;
+
+  for (uint8_t j = 0U; j < 3U; j++) {
+    kg[j] = (int64_t)(0.5f * sample_period * gyro_scale[j] * LSM6DSV16X_FUSION_MDPS_TO_RADS * 70368744177664.0f);
+    kh[j] = (int64_t)(0.5f * sample_period * gyro_offset[j] * LSM6DSV16X_FUSION_MDPS_TO_RADS * 1073741824.0f);
+    ka[j] = (int32_t)(acc_scale[j] / acc_sensitivity * 16384.0f);
+    kb[j] = (int32_t)(acc_offset[j] / acc_sensitivity * 16384.0f);
+  }
+
+  for (uint16_t i = 0U; i < batch_len; i++) {
+    hx = (((int64_t)batch_gyro[0][i] * kg[0]) >> 16) - kh[0];
+    hy = (((int64_t)batch_gyro[1][i] * kg[1]) >> 16) - kh[1];
+    hz = (((int64_t)batch_gyro[2][i] * kg[2]) >> 16) - kh[2];
+
+    ax = ((int64_t)batch_acc[0][i] * ka[0] - kb[0]) >> 14;
+    ay = ((int64_t)batch_acc[1][i] * ka[1] - kb[1]) >> 14;
+    az = ((int64_t)batch_acc[2][i] * ka[2] - kb[2]) >> 14;
+    n = Isqrt((uint64_t)(ax * ax + ay * ay + az * az));
+
+    if (n != 0U) {
+      /* Unit acceleration, Q15 */
+      int64_t ux = (ax * 32768) / (int64_t)n;
+      int64_t uy = (ay * 32768) / (int64_t)n;
+      int64_t uz = (az * 32768) / (int64_t)n;
+      /* Half of the estimated gravity direction, Q30 */
+      int64_t vx = (x * z - w * y) >> 30;
+      int64_t vy = (w * x + y * z) >> 30;
+      int64_t vz = ((w * w + z * z) >> 30) - (one >> 1);
+
+      hx += (((uy * vz - uz * vy) >> 15) * kc) >> 32;
+      hy += (((uz * vx - ux * vz) >> 15) * kc) >> 32;
+      hz += (((ux * vy - uy * vx) >> 15) * kc) >> 32;
+    }
+
+    dw = (-x * hx - y * hy - z * hz) >> 30;
+    dx = (w * hx + y * hz - z * hy) >> 30;
+    dy = (w * hy - x * hz + z * hx) >> 30;
+    dz = (w * hz + x * hy - y * hx) >> 30;
+    w += dw;
+    x += dx;
+    y += dy;
+    z += dz;
+
+    /* First order renormalization, the norm stays close to 1 */
+    f = (3 * one - ((w * w + x * x + y * y + z * z) >> 30)) >> 1;
+    w = (w * f) >> 30;
+    x = (x * f) >> 30;
+    y = (y * f) >> 30;
+    z = (z * f) >> 30;
+  }
+
+  q0 = (float)w / 1073741824.0f;
+  q1 = (float)x / 1073741824.0f;
+  q2 = (float)y / 1073741824.0f;
+  q3 = (float)z / 1073741824.0f;
+  batch_len = 0U;
+}
+#else
+/**
+ * @brief  Run the filter on the collected batch
+ * @note   The unit conversion and the normalization run first over whole
+ *         axis arrays, without dependencies between samples
+ */
+void LSM6DSV16XFusion::Run_Batch()
+{
+  float gx[LSM6DSV16X_FUSION_BATCH];
+  float gy[LSM6DSV16X_FUSION_BATCH];
+  float gz[LSM6DSV16X_FUSION_BATCH];
+  float ax[LSM6DSV16X_FUSION_BATCH];
+  float ay[LSM6DSV16X_FUSION_BATCH];
+  float az[LSM6DSV16X_FUSION_BATCH];
+  const float sx = gyro_scale[0] * LSM6DSV16X_FUSION_MDPS_TO_RADS;
+  const float sy = gyro_scale[1] * LSM6DSV16X_FUSION_MDPS_TO_RADS;
+  const float sz = gyro_scale[2] * LSM6DSV16X_FUSION_MDPS_TO_RADS;
+  const float ox = gyro_offset[0] * LSM6DSV16X_FUSION_MDPS_TO_RADS;
+  const float oy = gyro_offset[1] * LSM6DSV16X_FUSION_MDPS_TO_RADS;
+  const float oz = gyro_offset[2] * LSM6DSV16X_FUSION_MDPS_TO_RADS;
+  const uint16_t len = batch_len;
+  float norm;
+
+  for (uint16_t i = 0U; i < len; i++) {
+    gx[i] = (float)batch_gyro[0][i] * sx - ox;
+    gy[i] = (float)batch_gyro[1][i] * sy - oy;
+    gz[i] = (float)batch_gyro[2][i] * sz - oz;
+  }
+
+  for (uint16_t i = 0U; i < len; i++) {
+    ax[i] = (float)batch_acc[0][i] * acc_scale[0] - acc_offset[0];
+    ay[i] = (float)batch_acc[1][i] * acc_scale[1] - acc_offset[1];
+    az[i] = (float)batch_acc[2][i] * acc_scale[2] - acc_offset[2];
+    norm = ax[i] * ax[i] + ay[i] * ay[i] + az[i] * az[i];
+    norm = (norm > 0.0f) ? 1.0f / sqrtf(norm) : 0.0f;
+    ax[i] *= norm;
+    ay[i] *= norm;
+    az[i] *= norm;
+  }
+
+  for (uint16_t i = 0U; i < len; i++) {
+    Update_IMU(gx[i], gy[i], gz[i], ax[i], ay[i], az[i]);
+  }
+
+  batch_len = 0U;
+}
+#endif
+
+/**
+ * @brief  Compute the per-axis conversion factors from the sensitivities and the thermal model
+ * @note   Same correction as the FIFO decoding of LSM6DSV16XSensor, with the gain folded
+ *         into the scale and the offset
+ */
+void LSM6DSV16XFusion::Update_Conversion()
+{
+  float xl_gain[3];
+  float g_gain[3];
+
+  LSM6DSV16XSensor::Get_Thermal_Correction((thermal_enabled != 0U) ? &thermal_model : NULL, temperature,
+                                           acc_offset, xl_gain, gyro_offset, g_gain);
+
+  for (uint8_t i = 0U; i < 3U; i++) {
+    acc_scale[i] = acc_sensitivity * xl_gain[i];
+    acc_offset[i] *= xl_gain[i];
+    gyro_scale[i] = gyro_sensitivity * g_gain[i];
+    gyro_offset[i] *= g_gain[i];
+  }
+}
+
+/**
+ * @brief  Load the sensitivities of a tracked FIFO configuration
+ * @param  Cfg configuration of the next words
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XFusion::Update_Config(uint8_t Cfg)
+{
+  if (sens_source->FIFO_Get_Config_Sensitivity(Cfg, &acc_sensitivity, &gyro_sensitivity) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* The buffered accelerometer sample was produced with the previous full scale */
+  if (Cfg != sens_cfg) {
+    acc_valid = 0U;
+  }
+  sens_cfg = Cfg;
+  Update_Conversion();
+
+  return LSM6DSV16X_OK;
+}
+
+#if LSM6DSV16X_FUSION_MAHONY
+/**
+ * @brief  Mahony step with accelerometer and magnetometer
+ * @param  gx, gy, gz angular rate [rad/s]
+ * @param  ax, ay, az acceleration, any unit
+ * @param  mx, my, mz calibrated magnetic field, any unit
+ */
+void LSM6DSV16XFusion::Update_MARG(float gx, float gy, float gz, float ax, float ay, float az, float mx, float my, float mz)
+{
+  float norm;
+  float hx, hy, bx, bz;
+  float halfvx, halfvy, halfvz, halfwx, halfwy, halfwz;
+  float halfex, halfey, halfez;
+  float q0q0, q0q1, q0q2, q0q3, q1q1, q1q2, q1q3, q2q2, q2q3, q3q3;
+
+  norm = ax * ax + ay * ay + az * az;
+  norm = (norm > 0.0f) ? 1.0f / sqrtf(norm) : 0.0f;
+  ax *= norm;
+  ay *= norm;
+  az *= norm;
+
+  norm = mx * mx + my * my + mz * mz;
+  if (norm == 0.0f || (ax == 0.0f && ay == 0.0f && az == 0.0f)) {
+    Update_IMU(gx, gy, gz, ax, ay, az);
+    return;
+  }
+
+  norm = 1.0f / sqrtf(norm);
+  mx *= norm;
+  my *= norm;
+  mz *= norm;
+
+  q0q0 = q0 * q0;
+  q0q1 = q0 * q1;
+  q0q2 = q0 * q2;
+  q0q3 = q0 * q3;
+  q1q1 = q1 * q1;
+  q1q2 = q1 * q2;
+  q1q3 = q1 * q3;
+  q2q2 = q2 * q2;
+  q2q3 = q2 * q3;
+  q3q3 = q3 * q3;
+
+  /* Reference direction of the Earth magnetic field */
+  hx = 2.0f * (mx * (0.5f - q2q2 - q3q3) + my * (q1q2 - q0q3) + mz * (q1q3 + q0q2));
+  hy = 2.0f * (mx * (q1q2 + q0q3) + my * (0.5f - q1q1 - q3q3) + mz * (q2q3 - q0q1));
+  bx = sqrtf(hx * hx + hy * hy);
+  bz = 2.0f * (mx * (q1q3 - q0q2) + my * (q2q3 + q0q1) + mz * (0.5f - q1q1 - q2q2));
+
+  /* Estimated direction of gravity and magnetic field */
+  halfvx = q1q3 - q0q2;
+  halfvy = q0q1 + q2q3;
+  halfvz = q0q0 - 0.5f + q3q3;
+  halfwx = bx * (0.5f - q2q2 - q3q3) + bz * (q1q3 - q0q2);
+  halfwy = bx * (q1q2 - q0q3) + bz * (q0q1 + q2q3);
+  halfwz = bx * (q0q2 + q1q3) + bz * (0.5f - q1q1 - q2q2);
+
+  /* Error between the estimated and the measured directions */
+  halfex = (ay * halfvz - az * halfvy) + (my * halfwz - mz * halfwy);
+  halfey = (az * halfvx - ax * halfvz) + (mz * halfwx - mx * halfwz);
+  halfez = (ax * halfvy - ay * halfvx) + (mx * halfwy - my * halfwx);
+
+  if (ki > 0.0f) {
+    integral[0] += 2.0f * ki * halfex * sample_period;
+    integral[1] += 2.0f * ki * halfey * sample_period;
+    integral[2] += 2.0f * ki * halfez * sample_period;
+    gx += integral[0];
+    gy += integral[1];
+    gz += integral[2];
+  }
+
+  Integrate(gx + beta * halfex, gy + beta * halfey, gz + beta * halfez);
+}
+
+/**
+ * @brief  Mahony step with accelerometer only
+ * @param  gx, gy, gz angular rate [rad/s]
+ * @param  ax, ay, az normalized acceleration, all 0 to integrate the angular rate only
+ */
+void LSM6DSV16XFusion::Update_IMU(float gx, float gy, float gz, float ax, float ay, float az)
+{
+  float halfvx, halfvy, halfvz;
+  float halfex, halfey, halfez;
+
+  /* Estimated direction of gravity */
+  halfvx = q1 * q3 - q0 * q2;
+  halfvy = q0 * q1 + q2 * q3;
+  halfvz = q0 * q0 - 0.5f + q3 * q3;
+
+  /* Error between the estimated and the measured directions, 0 without acceleration */
+  halfex = ay * halfvz - az * halfvy;
+  halfey = az * halfvx - ax * halfvz;
+  halfez = ax * halfvy - ay * halfvx;
+
+  if (ki > 0.0f) {
+    integral[0] += 2.0f * ki * halfex * sample_period;
+    integral[1] += 2.0f * ki * halfey * sample_period;
+    integral[2] += 2.0f * ki * halfez * sample_period;
+    gx += integral[0];
+    gy += integral[1];
+    gz += integral[2];
+  }
+
+  Integrate(gx + beta * halfex, gy + beta * halfey, gz + beta * halfez);
+}
+
+/**
+ * @brief  Integrate the corrected angular rate
+ * @param  gx, gy, gz angular rate [rad/s]
+ */
+void LSM6DSV16XFusion::Integrate(float gx, float gy, float gz)
+{
+  float norm;
+  float qa = q0;
+  float qb = q1;
+  float qc = q2;
+
+  gx *= 0.5f * sample_period;
+  gy *= 0.5f * sample_period;
+  gz *= 0.5f * sample_period;
+
+  q0 += -qb * gx - qc * gy - q3 * gz;
+  q1 += qa * gx + qc * gz - q3 * gy;
+  q2 += qa * gy - qb * gz + q3 * gx;
+  q3 += qa * gz + qb * gy - qc * gx;
+
+  norm = 1.0f / sqrtf(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+  q0 *= norm;
+  q1 *= norm;
+  q2 *= norm;
+  q3 *= norm;
+}
+#else
+/**
+ * @brief  Madgwick gradient descent step with accelerometer and magnetometer
+ * @param  gx, gy, gz angular rate [rad/s]
+ * @param  ax, ay, az acceleration, any unit
+ * @param  mx, my, mz calibrated magnetic field, any unit
+ */
+void LSM6DSV16XFusion::Update_MARG(float gx, float gy, float gz, float ax, float ay, float az, float mx, float my, float mz)
+{
+  float norm;
+  float s0, s1, s2, s3;
+  float qDot1, qDot2, qDot3, qDot4;
+  float hx, hy;
+  float _2q0mx, _2q0my, _2q0mz, _2q1mx, _2bx, _2bz, _4bx, _4bz;
+  float _2q0, _2q1, _2q2, _2q3, _2q0q2, _2q2q3;
+  float q0q0, q0q1, q0q2, q0q3, q1q1, q1q2, q1q3, q2q2, q2q3, q3q3;
+
+  norm = mx * mx + my * my + mz * mz;
+  if (norm == 0.0f) {
+    norm = ax * ax + ay * ay + az * az;
+    norm = (norm > 0.0f) ? 1.0f / sqrtf(norm) : 0.0f;
+    Update_IMU(gx, gy, gz, ax * norm, ay * norm, az * norm);
+    return;
+  }
+
+  qDot1 = 0.5f * (-q1 * gx - q2 * gy - q3 * gz);
+  qDot2 = 0.5f * (q0 * gx + q2 * gz - q3 * gy);
+  qDot3 = 0.5f * (q0 * gy - q1 * gz + q3 * gx);
+  qDot4 = 0.5f * (q0 * gz + q1 * gy - q2 * gx);
+
+  if (!((ax == 0.0f) && (ay == 0.0f) && (az == 0.0f))) {
+    norm = 1.0f / sqrtf(norm);
+    mx *= norm;
+    my *= norm;
+    mz *= norm;
+
+    norm = 1.0f / sqrtf(ax * ax + ay * ay + az * az);
+    ax *= norm;
+    ay *= norm;
+    az *= norm;
+
+    _2q0mx = 2.0f * q0 * mx;
+    _2q0my = 2.0f * q0 * my;
+    _2q0mz = 2.0f * q0 * mz;
+    _2q1mx = 2.0f * q1 * mx;
+    _2q0 = 2.0f * q0;
+    _2q1 = 2.0f * q1;
+    _2q2 = 2.0f * q2;
+    _2q3 = 2.0f * q3;
+    _2q0q2 = 2.0f * q0 * q2;
+    _2q2q3 = 2.0f * q2 * q3;
+    q0q0 = q0 * q0;
+    q0q1 = q0 * q1;
+    q0q2 = q0 * q2;
+    q0q3 = q0 * q3;
+    q1q1 = q1 * q1;
+    q1q2 = q1 * q2;
+    q1q3 = q1 * q3;
+    q2q2 = q2 * q2;
+    q2q3 = q2 * q3;
+    q3q3 = q3 * q3;
+
+    /* Reference direction of the Earth magnetic field */
+    hx = mx * q0q0 - _2q0my * q3 + _2q0mz * q2 + mx * q1q1 + _2q1 * my * q2 + _2q1 * mz * q3 - mx * q2q2 - mx * q3q3;
+    hy = _2q0mx * q3 + my * q0q0 - _2q0mz * q1 + _2q1mx * q2 - my * q1q1 + my * q2q2 + _2q2 * mz * q3 - my * q3q3;
+    _2bx = sqrtf(hx * hx + hy * hy);
+    _2bz = -_2q0mx * q2 + _2q0my * q1 + mz * q0q0 + _2q1mx * q3 - mz * q1q1 + _2q2 * my * q3 - mz * q2q2 + mz * q3q3;
+    _4bx = 2.0f * _2bx;
+    _4bz = 2.0f * _2bz;
+
+    /* Gradient of the objective function */
+    s0 = -_2q2 * (2.0f * q1q3 - _2q0q2 - ax) + _2q1 * (2.0f * q0q1 + _2q2q3 - ay) - _2bz * q2 * (_2bx * (0.5f - q2q2 - q3q3) + _2bz * (q1q3 - q0q2) - mx) + (-_2bx * q3 + _2bz * q1) * (_2bx * (q1q2 - q0q3) + _2bz * (q0q1 + q2q3) - my) + _2bx * q2 * (_2bx * (q0q2 + q1q3) + _2bz * (0.5f - q1q1 - q2q2) - mz);
+    s1 = _2q3 * (2.0f * q1q3 - _2q0q2 - ax) + _2q0 * (2.0f * q0q1 + _2q2q3 - ay) - 4.0f * q1 * (1.0f - 2.0f * q1q1 - 2.0f * q2q2 - az) + _2bz * q3 * (_2bx * (0.5f - q2q2 - q3q3) + _2bz * (q1q3 - q0q2) - mx) + (_2bx * q2 + _2bz * q0) * (_2bx * (q1q2 - q0q3) + _2bz * (q0q1 + q2q3) - my) + (_2bx * q3 - _4bz * q1) * (_2bx * (q0q2 + q1q3) + _2bz * (0.5f - q1q1 - q2q2) - mz);
+    s2 = -_2q0 * (2.0f * q1q3 - _2q0q2 - ax) + _2q3 * (2.0f * q0q1 + _2q2q3 - ay) - 4.0f * q2 * (1.0f - 2.0f * q1q1 - 2.0f * q2q2 - az) + (-_4bx * q2 - _2bz * q0) * (_2bx * (0.5f - q2q2 - q3q3) + _2bz * (q1q3 - q0q2) - mx) + (_2bx * q1 + _2bz * q3) * (_2bx * (q1q2 - q0q3) + _2bz * (q0q1 + q2q3) - my) + (_2bx * q0 - _4bz * q2) * (_2bx * (q0q2 + q1q3) + _2bz * (0.5f - q1q1 - q2q2) - mz);
+    s3 = _2q1 * (2.0f * q1q3 - _2q0q2 - ax) + _2q2 * (2.0f * q0q1 + _2q2q3 - ay) + (-_4bx * q3 + _2bz * q1) * (_2bx * (0.5f - q2q2 - q3q3) + _2bz * (q1q3 - q0q2) - mx) + (-_2bx * q0 + _2bz * q2) * (_2bx * (q1q2 - q0q3) + _2bz * (q0q1 + q2q3) - my) + _2bx * q1 * (_2bx * (q0q2 + q1q3) + _2bz * (0.5f - q1q1 - q2q2) - mz);
+
+    norm = s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3;
+    if (norm > 0.0f) {
+      norm = beta / sqrtf(norm);
+      qDot1 -= norm * s0;
+      qDot2 -= norm * s1;
+      qDot3 -= norm * s2;
+      qDot4 -= norm * s3;
+    }
+  }
+
+  q0 += qDot1 * sample_period;
+  q1 += qDot2 * sample_period;
+  q2 += qDot3 * sample_period;
+  q3 += qDot4 * sample_period;
+
+  norm = 1.0f / sqrtf(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+  q0 *= norm;
+  q1 *= norm;
+  q2 *= norm;
+  q3 *= norm;
+}
+
+/**
+ * @brief  Madgwick gradient descent step with accelerometer only
+ * @param  gx, gy, gz angular rate [rad/s]
+ * @param  ax, ay, az normalized acceleration, all 0 to integrate the angular rate only
+ */
+void LSM6DSV16XFusion::Update_IMU(float gx, float gy, float gz, float ax, float ay, float az)
+{
+  float norm;
+  float s0, s1, s2, s3;
+  float qDot1, qDot2, qDot3, qDot4;
+  float _2q0, _2q1, _2q2, _2q3, _4q0, _4q1, _4q2, _8q1, _8q2;
+  float q0q0, q1q1, q2q2, q3q3;
+
+  qDot1 = 0.5f * (-q1 * gx - q2 * gy - q3 * gz);
+  qDot2 = 0.5f * (q0 * gx + q2 * gz - q3 * gy);
+  qDot3 = 0.5f * (q0 * gy - q1 * gz + q3 * gx);
+  qDot4 = 0.5f * (q0 * gz + q1 * gy - q2 * gx);
+
+  if (!((ax == 0.0f) && (ay == 0.0f) && (az == 0.0f))) {
+    _2q0 = 2.0f * q0;
+    _2q1 = 2.0f * q1;
+    _2q2 = 2.0f * q2;
+    _2q3 = 2.0f * q3;
+    _4q0 = 4.0f * q0;
+    _4q1 = 4.0f * q1;
+    _4q2 = 4.0f * q2;
+    _8q1 = 8.0f * q1;
+    _8q2 = 8.0f * q2;
+    q0q0 = q0 * q0;
+    q1q1 = q1 * q1;
+    q2q2 = q2 * q2;
+    q3q3 = q3 * q3;
+
+    /* Gradient of the objective function */
+    s0 = _4q0 * q2q2 + _2q2 * ax + _4q0 * q1q1 - _2q1 * ay;
+    s1 = _4q1 * q3q3 - _2q3 * ax + 4.0f * q0q0 * q1 - _2q0 * ay - _4q1 + _8q1 * q1q1 + _8q1 * q2q2 + _4q1 * az;
+    s2 = 4.0f * q0q0 * q2 + _2q0 * ax + _4q2 * q3q3 - _2q3 * ay - _4q2 + _8q2 * q1q1 + _8q2 * q2q2 + _4q2 * az;
+    s3 = 4.0f * q1q1 * q3 - _2q1 * ax + 4.0f * q2q2 * q3 - _2q2 * ay;
+
+    norm = s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3;
+    if (norm > 0.0f) {
+      norm = beta / sqrtf(norm);
+      qDot1 -= norm * s0;
+      qDot2 -= norm * s1;
+      qDot3 -= norm * s2;
+      qDot4 -= norm * s3;
+    }
+  }
+
+  q0 += qDot1 * sample_period;
+  q1 += qDot2 * sample_period;
+  q2 += qDot3 * sample_period;
+  q3 += qDot4 * sample_period;
+
+  norm = 1.0f / sqrtf(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+  q0 *= norm;
+  q1 *= norm;
+  q2 *= norm;
+  q3 *= norm;
+}
+#endif
@@ -0,0 +1,179 @@
+/**
+ ******************************************************************************
+ * @file    LSM6DSV16XFusion.h
+ * @author  LSM6DSV16X library contributors
+ * @version V1.0.0
+ * @date    October 2026
+ * @brief   Orientation filter fed by the LSM6DSV16X FIFO stream.
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; COPYRIGHT(c) 2026 LSM6DSV16X library contributors</center></h2>
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of the copyright holder nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************
+ */
+
+
+/* Prevent recursive inclusion -----------------------------------------------*/
+
+#ifndef __LSM6DSV16XFusion_H__
+#define __LSM6DSV16XFusion_H__
+
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "LSM6DSV16XSensor.h"
+
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Filter selection (must be defined as a global build flag) */
+#ifndef LSM6DSV16X_FUSION_MAHONY
+  #define LSM6DSV16X_FUSION_MAHONY  0 /* 0: Madgwick, 1: Mahony */
+#endif
+
+/* Integer 6-axis batch update for cores without FPU (must be defined as a global build flag) */
+#ifndef LSM6DSV16X_FUSION_FIXED_POINT
+  #define LSM6DSV16X_FUSION_FIXED_POINT  0
+#endif
+
+/* The integer batch update runs the Mahony proportional correction only */
+#if LSM6DSV16X_FUSION_FIXED_POINT && !LSM6DSV16X_FUSION_MAHONY
+  #error "LSM6DSV16X_FUSION_FIXED_POINT requires LSM6DSV16X_FUSION_MAHONY=1"
+#endif
+
+/* Gyroscope samples processed per batch pass */
+#ifndef LSM6DSV16X_FUSION_BATCH
+  #define LSM6DSV16X_FUSION_BATCH  16U
+#endif
+
+#if LSM6DSV16X_FUSION_MAHONY
+  #define LSM6DSV16X_FUSION_DEFAULT_BETA  1.0f /* Twice the proportional gain */
+#else
+  #define LSM6DSV16X_FUSION_DEFAULT_BETA  0.1f
+#endif
+
+
+/* Typedefs ------------------------------------------------------------------*/
+
+typedef struct {
+  float HardIron[3];    /* Offset removed from the magnetometer data [mgauss] */
+  float SoftIron[3][3]; /* Matrix applied after the offset removal */
+} LSM6DSV16X_Mag_Calibration_t;
+
+
+/* Class Declaration ---------------------------------------------------------*/
+
+/**
+ * Madgwick (or Mahony) orientation filter fed with the decoded FIFO words
+ * of the accelerometer, the gyroscope and a sensor hub magnetometer.
+ * A quaternion is produced for each gyroscope sample, in the same
+ * component order as FIFO_Get_Rotation_Vector (x, y, z, w).
+ */
+class LSM6DSV16XFusion {
+  public:
+    LSM6DSV16XFusion(float SampleRate, float Beta = LSM6DSV16X_FUSION_DEFAULT_BETA);
+    LSM6DSV16XStatusTypeDef Reset();
+    LSM6DSV16XStatusTypeDef Set_Sample_Rate(float SampleRate);
+    LSM6DSV16XStatusTypeDef Set_Beta(float Beta);
+    LSM6DSV16XStatusTypeDef Set_Integral_Gain(float Ki);
+    LSM6DSV16XStatusTypeDef Set_Sensitivity(float AccSensitivity, float GyroSensitivity, float MagSensitivity);
+    LSM6DSV16XStatusTypeDef Set_Sensitivity_Source(LSM6DSV16XSensor *Sensor);
+    LSM6DSV16XStatusTypeDef Set_Thermal_Model(const LSM6DSV16X_Thermal_Model_t *Model);
+    LSM6DSV16XStatusTypeDef Set_Temperature(float Temperature);
+    LSM6DSV16XStatusTypeDef Set_Mag_Slave(uint8_t Slave);
+    LSM6DSV16XStatusTypeDef Set_Mag_Calibration(const LSM6DSV16X_Mag_Calibration_t *Calibration);
+    LSM6DSV16XStatusTypeDef Get_Mag_Calibration(LSM6DSV16X_Mag_Calibration_t *Calibration);
+    LSM6DSV16XStatusTypeDef Start_Mag_Calibration();
+    LSM6DSV16XStatusTypeDef Stop_Mag_Calibration();
+    LSM6DSV16XStatusTypeDef Process_Word(const LSM6DSV16X_FIFO_Word_t *Word, uint8_t *Updated);
+    LSM6DSV16XStatusTypeDef Process_Words(const LSM6DSV16X_FIFO_Word_t *Words, uint16_t NumWords, uint16_t *Updates);
+    LSM6DSV16XStatusTypeDef Update(const float Acceleration[3], const float AngularRate[3], const float MagneticField[3]);
+    LSM6DSV16XStatusTypeDef Get_Quaternion(float Quaternion[4]);
+
+  private:
+    void Update_MARG(float gx, float gy, float gz, float ax, float ay, float az, float mx, float my, float mz);
+    void Update_IMU(float gx, float gy, float gz, float ax, float ay, float az);
+    void Run_Batch();
+    void Update_Conversion();
+    LSM6DSV16XStatusTypeDef Update_Config(uint8_t Cfg);
+#if LSM6DSV16X_FUSION_MAHONY
+    void Integrate(float gx, float gy, float gz);
+#endif
+
+    /* Quaternion, scalar first */
+    float q0;
+    float q1;
+    float q2;
+    float q3;
+
+    float beta;
+    float sample_period;
+#if LSM6DSV16X_FUSION_MAHONY
+    /* Integral feedback [rad/s] */
+    float ki;
+    float integral[3];
+#endif
+
+    /* Raw data conversion factors [mg/LSB, mdps/LSB, mgauss/LSB] */
+    float acc_sensitivity;
+    float gyro_sensitivity;
+    float mag_sensitivity;
+    uint8_t mag_tag;
+
+    /* Sensor tracking the FIFO configurations, the sensitivities follow LSM6DSV16X_FIFO_Word_t::Cfg */
+    LSM6DSV16XSensor *sens_source;
+    uint8_t sens_cfg;
+
+    /* Thermal drift model, applied at the last temperature */
+    LSM6DSV16X_Thermal_Model_t thermal_model;
+    uint8_t thermal_enabled;
+    float temperature;
+
+    /* Per-axis conversion with the thermal correction, value = raw * scale - offset */
+    float acc_scale[3];
+    float acc_offset[3];
+    float gyro_scale[3];
+    float gyro_offset[3];
+
+    /* Last samples from the FIFO stream [mg, mgauss] */
+    float acc[3];
+    float mag[3];
+    uint8_t acc_valid;
+    uint8_t mag_valid;
+
+    /* Raw 6-axis samples waiting for the batch update, one array per axis */
+    int16_t batch_acc[3][LSM6DSV16X_FUSION_BATCH];
+    int16_t batch_gyro[3][LSM6DSV16X_FUSION_BATCH];
+    int16_t acc_raw[3];
+    uint16_t batch_len;
+
+    LSM6DSV16X_Mag_Calibration_t mag_cal;
+    float mag_min[3];
+    float mag_max[3];
+    uint8_t mag_cal_running;
+};
+
+#endif /* __LSM6DSV16XFusion_H__ */
@@ -0,0 +1,401 @@
+/**
+ ******************************************************************************
+ * @file    LSM6DSV16XOrientation.cpp
+ * @author  LSM6DSV16X library contributors
+ * @version V1.0.0
+ * @date    October 2026
+ * @brief   Implementation of the LSM6DSV16X SFLP post-processing kernels.
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; COPYRIGHT(c) 2026 LSM6DSV16X library contributors</center></h2>
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of the copyright holder nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************
+ */
+
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "LSM6DSV16XOrientation.h"
+#include <math.h>
+
+
+/* Defines -------------------------------------------------------------------*/
+
+#define LSM6DSV16X_RAD_TO_DEG     57.2957795f
+#define LSM6DSV16X_SQRT1_2        0.70710678f
+#define LSM6DSV16X_ONE_G_MG       1000.0f
+
+
+/* Private functions ---------------------------------------------------------*/
+
+/* Express a sensor-to-ENU quaternion (x, y, z, w) in the selected convention */
+static inline void Quat_To_Frame(LSM6DSV16X_Frame_t Frame, float q[4])
+{
+  float x = q[0], y = q[1], z = q[2], w = q[3];
+
+  if (Frame == LSM6DSV16X_FRAME_NED) {
+    /* q' = q_enu_to_ned * q * conj(q_sensor_to_frd) */
+    q[0] = LSM6DSV16X_SQRT1_2 * (x + y);
+    q[1] = LSM6DSV16X_SQRT1_2 * (x - y);
+    q[2] = LSM6DSV16X_SQRT1_2 * (w - z);
+    q[3] = LSM6DSV16X_SQRT1_2 * (w + z);
+  }
+}
+
+/* Express a sensor frame vector in the body axes of the selected convention */
+static inline void Vec_To_Frame(LSM6DSV16X_Frame_t Frame, float v[3])
+{
+  if (Frame == LSM6DSV16X_FRAME_NED) {
+    v[1] = -v[1];
+    v[2] = -v[2];
+  }
+}
+
+static inline void Quat_To_Euler(const float q[4], float *Yaw, float *Pitch, float *Roll)
+{
+  float x = q[0], y = q[1], z = q[2], w = q[3];
+  float sinp = 2.0f * (w * y - z * x);
+
+  /* Clamp to avoid NaN at +/-90 deg pitch */
+  sinp = (sinp > 1.0f) ? 1.0f : (sinp < -1.0f) ? -1.0f : sinp;
+
+  *Yaw = atan2f(2.0f * (w * z + x * y), 1.0f - 2.0f * (y * y + z * z)) * LSM6DSV16X_RAD_TO_DEG;
+  *Pitch = asinf(sinp) * LSM6DSV16X_RAD_TO_DEG;
+  *Roll = atan2f(2.0f * (w * x + y * z), 1.0f - 2.0f * (x * x + y * y)) * LSM6DSV16X_RAD_TO_DEG;
+}
+
+static inline void Quat_To_Matrix(const float q[4], float m[3][3])
+{
+  float x = q[0], y = q[1], z = q[2], w = q[3];
+
+  m[0][0] = 1.0f - 2.0f * (y * y + z * z);
+  m[0][1] = 2.0f * (x * y - w * z);
+  m[0][2] = 2.0f * (x * z + w * y);
+  m[1][0] = 2.0f * (x * y + w * z);
+  m[1][1] = 1.0f - 2.0f * (x * x + z * z);
+  m[1][2] = 2.0f * (y * z - w * x);
+  m[2][0] = 2.0f * (x * z - w * y);
+  m[2][1] = 2.0f * (y * z + w * x);
+  m[2][2] = 1.0f - 2.0f * (x * x + y * y);
+}
+
+/* Rotate a body frame specific force to the earth frame and remove gravity */
+static inline void Linear_Earth(LSM6DSV16X_Frame_t Frame, const float q[4], const float a[3], float out[3])
+{
+  float m[3][3];
+
+  Quat_To_Matrix(q, m);
+  out[0] = m[0][0] * a[0] + m[0][1] * a[1] + m[0][2] * a[2];
+  out[1] = m[1][0] * a[0] + m[1][1] * a[1] + m[1][2] * a[2];
+  out[2] = m[2][0] * a[0] + m[2][1] * a[1] + m[2][2] * a[2];
+
+  /* At rest the accelerometer reads 1 g upwards */
+  out[2] += (Frame == LSM6DSV16X_FRAME_NED) ? LSM6DSV16X_ONE_G_MG : -LSM6DSV16X_ONE_G_MG;
+}
+
+
+/* Functions -----------------------------------------------------------------*/
+
+/**
+ * @brief  Convert a batch of SFLP quaternions to Euler angles
+ * @param  Quaternion array of quaternions (FIFO_Get_Rotation_Vector order)
+ * @param  Euler array where the yaw, pitch and roll angles are written [deg]
+ * @param  Count number of samples
+ * @param  Frame frame convention of the angles
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16X_Quaternion_To_Euler(const LSM6DSV16X_Quaternion_t *Quaternion, LSM6DSV16X_Euler_t *Euler, uint16_t Count, LSM6DSV16X_Frame_t Frame)
+{
+  float q[4];
+
+  if (Quaternion == NULL || Euler == NULL) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  for (uint16_t i = 0; i < Count; i++) {
+    q[0] = Quaternion[i].X;
+    q[1] = Quaternion[i].Y;
+    q[2] = Quaternion[i].Z;
+    q[3] = Quaternion[i].W;
+    Quat_To_Frame(Frame, q);
+    Quat_To_Euler(q, &Euler[i].Yaw, &Euler[i].Pitch, &Euler[i].Roll);
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Convert a batch of SFLP quaternions to Euler angles, one array per component
+ * @param  Quaternion arrays of the quaternion components
+ * @param  Euler arrays where the yaw, pitch and roll angles are written [deg]
+ * @param  Count number of samples
+ * @param  Frame frame convention of the angles
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16X_Quaternion_To_Euler_SoA(const LSM6DSV16X_Quaternion_SoA_t *Quaternion, const LSM6DSV16X_Euler_SoA_t *Euler, uint16_t Count, LSM6DSV16X_Frame_t Frame)
+{
+  if (Quaternion == NULL || Euler == NULL) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  const float *LSM6DSV16X_RESTRICT qx = Quaternion->X;
+  const float *LSM6DSV16X_RESTRICT qy = Quaternion->Y;
+  const float *LSM6DSV16X_RESTRICT qz = Quaternion->Z;
+  const float *LSM6DSV16X_RESTRICT qw = Quaternion->W;
+  float *LSM6DSV16X_RESTRICT yaw = Euler->Yaw;
+  float *LSM6DSV16X_RESTRICT pitch = Euler->Pitch;
+  float *LSM6DSV16X_RESTRICT roll = Euler->Roll;
+  float q[4];
+
+  for (uint16_t i = 0; i < Count; i++) {
+    q[0] = qx[i];
+    q[1] = qy[i];
+    q[2] = qz[i];
+    q[3] = qw[i];
+    Quat_To_Frame(Frame, q);
+    Quat_To_Euler(q, &yaw[i], &pitch[i], &roll[i]);
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Convert a batch of SFLP quaternions to body to earth rotation matrices
+ * @param  Quaternion array of quaternions (FIFO_Get_Rotation_Vector order)
+ * @param  Matrix array where the rotation matrices are written
+ * @param  Count number of samples
+ * @param  Frame frame convention of the matrices
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16X_Quaternion_To_Matrix(const LSM6DSV16X_Quaternion_t *Quaternion, LSM6DSV16X_Matrix_t *Matrix, uint16_t Count, LSM6DSV16X_Frame_t Frame)
+{
+  float q[4];
+
+  if (Quaternion == NULL || Matrix == NULL) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  for (uint16_t i = 0; i < Count; i++) {
+    q[0] = Quaternion[i].X;
+    q[1] = Quaternion[i].Y;
+    q[2] = Quaternion[i].Z;
+    q[3] = Quaternion[i].W;
+    Quat_To_Frame(Frame, q);
+    Quat_To_Matrix(q, Matrix[i].M);
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Convert a batch of SFLP quaternions to rotation matrices, one array per element
+ * @param  Quaternion arrays of the quaternion components
+ * @param  Matrix arrays where the matrix elements are written
+ * @param  Count number of samples
+ * @param  Frame frame convention of the matrices
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16X_Quaternion_To_Matrix_SoA(const LSM6DSV16X_Quaternion_SoA_t *Quaternion, const LSM6DSV16X_Matrix_SoA_t *Matrix, uint16_t Count, LSM6DSV16X_Frame_t Frame)
+{
+  if (Quaternion == NULL || Matrix == NULL) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  const float *LSM6DSV16X_RESTRICT qx = Quaternion->X;
+  const float *LSM6DSV16X_RESTRICT qy = Quaternion->Y;
+  const float *LSM6DSV16X_RESTRICT qz = Quaternion->Z;
+  const float *LSM6DSV16X_RESTRICT qw = Quaternion->W;
+  float q[4];
+  float m[3][3];
+
+  for (uint16_t i = 0; i < Count; i++) {
+    q[0] = qx[i];
+    q[1] = qy[i];
+    q[2] = qz[i];
+    q[3] = qw[i];
+    Quat_To_Frame(Frame, q);
+    Quat_To_Matrix(q, m);
+    for (uint8_t r = 0; r < 3U; r++) {
+      for (uint8_t c = 0; c < 3U; c++) {
+        Matrix->M[r][c][i] = m[r][c];
+      }
+    }
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Remove the SFLP gravity vector from a batch of accelerometer samples
+ * @param  Acceleration array of accelerometer samples [mg]
+ * @param  Gravity array of SFLP gravity vectors, one per sample [mg]
+ * @param  Linear array where the linear acceleration in body axes is written [mg]
+ * @param  Count number of samples
+ * @param  Frame frame convention of the body axes
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16X_Linear_Acceleration(const LSM6DSV16X_Vector_t *Acceleration, const LSM6DSV16X_Vector_t *Gravity, LSM6DSV16X_Vector_t *Linear, uint16_t Count, LSM6DSV16X_Frame_t Frame)
+{
+  float v[3];
+
+  if (Acceleration == NULL || Gravity == NULL || Linear == NULL) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  for (uint16_t i = 0; i < Count; i++) {
+    v[0] = Acceleration[i].X - Gravity[i].X;
+    v[1] = Acceleration[i].Y - Gravity[i].Y;
+    v[2] = Acceleration[i].Z - Gravity[i].Z;
+    Vec_To_Frame(Frame, v);
+    Linear[i].X = v[0];
+    Linear[i].Y = v[1];
+    Linear[i].Z = v[2];
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Remove the SFLP gravity vector from a batch of accelerometer samples, one array per axis
+ * @param  Acceleration arrays of the accelerometer axes [mg]
+ * @param  Gravity arrays of the SFLP gravity vector axes [mg]
+ * @param  Linear arrays where the linear acceleration in body axes is written [mg]
+ * @param  Count number of samples
+ * @param  Frame frame convention of the body axes
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16X_Linear_Acceleration_SoA(const LSM6DSV16X_Vector_SoA_t *Acceleration, const LSM6DSV16X_Vector_SoA_t *Gravity, const LSM6DSV16X_Vector_SoA_t *Linear, uint16_t Count, LSM6DSV16X_Frame_t Frame)
+{
+  if (Acceleration == NULL || Gravity == NULL || Linear == NULL) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  const float *LSM6DSV16X_RESTRICT ax = Acceleration->X;
+  const float *LSM6DSV16X_RESTRICT ay = Acceleration->Y;
+  const float *LSM6DSV16X_RESTRICT az = Acceleration->Z;
+  const float *LSM6DSV16X_RESTRICT gx = Gravity->X;
+  const float *LSM6DSV16X_RESTRICT gy = Gravity->Y;
+  const float *LSM6DSV16X_RESTRICT gz = Gravity->Z;
+  float *LSM6DSV16X_RESTRICT lx = Linear->X;
+  float *LSM6DSV16X_RESTRICT ly = Linear->Y;
+  float *LSM6DSV16X_RESTRICT lz = Linear->Z;
+  float sign = (Frame == LSM6DSV16X_FRAME_NED) ? -1.0f : 1.0f;
+
+  /* Branch-free so that the loop can be vectorized */
+  for (uint16_t i = 0; i < Count; i++) {
+    lx[i] = ax[i] - gx[i];
+    ly[i] = sign * (ay[i] - gy[i]);
+    lz[i] = sign * (az[i] - gz[i]);
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Compute the earth frame linear acceleration of a batch of accelerometer samples
+ * @param  Quaternion array of SFLP quaternions, one per sample (FIFO_Get_Rotation_Vector order)
+ * @param  Acceleration array of accelerometer samples [mg]
+ * @param  Linear array where the linear acceleration in earth axes is written [mg]
+ * @param  Count number of samples
+ * @param  Frame frame convention of the earth axes
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16X_Linear_Acceleration_Earth(const LSM6DSV16X_Quaternion_t *Quaternion, const LSM6DSV16X_Vector_t *Acceleration, LSM6DSV16X_Vector_t *Linear, uint16_t Count, LSM6DSV16X_Frame_t Frame)
+{
+  float q[4];
+  float a[3];
+  float l[3];
+
+  if (Quaternion == NULL || Acceleration == NULL || Linear == NULL) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  for (uint16_t i = 0; i < Count; i++) {
+    q[0] = Quaternion[i].X;
+    q[1] = Quaternion[i].Y;
+    q[2] = Quaternion[i].Z;
+    q[3] = Quaternion[i].W;
+    a[0] = Acceleration[i].X;
+    a[1] = Acceleration[i].Y;
+    a[2] = Acceleration[i].Z;
+    Quat_To_Frame(Frame, q);
+    Vec_To_Frame(Frame, a);
+    Linear_Earth(Frame, q, a, l);
+    Linear[i].X = l[0];
+    Linear[i].Y = l[1];
+    Linear[i].Z = l[2];
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Compute the earth frame linear acceleration of a batch of samples, one array per component
+ * @param  Quaternion arrays of the SFLP quaternion components
+ * @param  Acceleration arrays of the accelerometer axes [mg]
+ * @param  Linear arrays where the linear acceleration in earth axes is written [mg]
+ * @param  Count number of samples
+ * @param  Frame frame convention of the earth axes
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16X_Linear_Acceleration_Earth_SoA(const LSM6DSV16X_Quaternion_SoA_t *Quaternion, const LSM6DSV16X_Vector_SoA_t *Acceleration, const LSM6DSV16X_Vector_SoA_t *Linear, uint16_t Count, LSM6DSV16X_Frame_t Frame)
+{
+  if (Quaternion == NULL || Acceleration == NULL || Linear == NULL) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  const float *LSM6DSV16X_RESTRICT qx = Quaternion->X;
+  const float *LSM6DSV16X_RESTRICT qy = Quaternion->Y;
+  const float *LSM6DSV16X_RESTRICT qz = Quaternion->Z;
+  const float *LSM6DSV16X_RESTRICT qw = Quaternion->W;
+  const float *LSM6DSV16X_RESTRICT ax = Acceleration->X;
+  const float *LSM6DSV16X_RESTRICT ay = Acceleration->Y;
+  const float *LSM6DSV16X_RESTRICT az = Acceleration->Z;
+  float *LSM6DSV16X_RESTRICT lx = Linear->X;
+  float *LSM6DSV16X_RESTRICT ly = Linear->Y;
+  float *LSM6DSV16X_RESTRICT lz = Linear->Z;
+  float q[4];
+  float a[3];
+  float l[3];
+
+  for (uint16_t i = 0; i < Count; i++) {
+    q[0] = qx[i];
+    q[1] = qy[i];
+    q[2] = qz[i];
+    q[3] = qw[i];
+    a[0] = ax[i];
+    a[1] = ay[i];
+    a[2] = az[i];
+    Quat_To_Frame(Frame, q);
+    Vec_To_Frame(Frame, a);
+    Linear_Earth(Frame, q, a, l);
+    lx[i] = l[0];
+    ly[i] = l[1];
+    lz[i] = l[2];
+  }
+
+  return LSM6DSV16X_OK;
+}
@@ -0,0 +1,128 @@
+/**
+ ******************************************************************************
+ * @file    LSM6DSV16XOrientation.h
+ * @author  LSM6DSV16X library contributors
+ * @version V1.0.0
+ * @date    October 2026
+ * @brief   Batch post-processing of the LSM6DSV16X SFLP outputs.
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; COPYRIGHT(c) 2026 LSM6DSV16X library contributors</center></h2>
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of the copyright holder nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************
+ */
+
+
+/* Prevent recursive inclusion -----------------------------------------------*/
+
+#ifndef __LSM6DSV16XOrientation_H__
+#define __LSM6DSV16XOrientation_H__
+
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "LSM6DSV16XSensor.h"
+
+
+/* Defines -------------------------------------------------------------------*/
+
+#if defined(__GNUC__)
+  #define LSM6DSV16X_RESTRICT  __restrict
+#else
+  #define LSM6DSV16X_RESTRICT
+#endif
+
+
+/* Typedefs ------------------------------------------------------------------*/
+
+typedef enum {
+  LSM6DSV16X_FRAME_ENU = 0, /* East-North-Up, body axes are the sensor axes */
+  LSM6DSV16X_FRAME_NED = 1, /* North-East-Down, body axes are forward (x), right (-y), down (-z) */
+} LSM6DSV16X_Frame_t;
+
+/* Same component order as FIFO_Get_Rotation_Vector, a float[4] can be cast to it */
+typedef struct {
+  float X;
+  float Y;
+  float Z;
+  float W;
+} LSM6DSV16X_Quaternion_t;
+
+typedef struct {
+  float X;
+  float Y;
+  float Z;
+} LSM6DSV16X_Vector_t;
+
+/* Z-Y-X Tait-Bryan angles [deg] */
+typedef struct {
+  float Yaw;
+  float Pitch;
+  float Roll;
+} LSM6DSV16X_Euler_t;
+
+/* Body to earth rotation, row major */
+typedef struct {
+  float M[3][3];
+} LSM6DSV16X_Matrix_t;
+
+/* Struct-of-arrays layouts, one array per component */
+typedef struct {
+  float *X;
+  float *Y;
+  float *Z;
+  float *W;
+} LSM6DSV16X_Quaternion_SoA_t;
+
+typedef struct {
+  float *X;
+  float *Y;
+  float *Z;
+} LSM6DSV16X_Vector_SoA_t;
+
+typedef struct {
+  float *Yaw;
+  float *Pitch;
+  float *Roll;
+} LSM6DSV16X_Euler_SoA_t;
+
+typedef struct {
+  float *M[3][3];
+} LSM6DSV16X_Matrix_SoA_t;
+
+
+/* Functions -----------------------------------------------------------------*/
+
+LSM6DSV16XStatusTypeDef LSM6DSV16X_Quaternion_To_Euler(const LSM6DSV16X_Quaternion_t *Quaternion, LSM6DSV16X_Euler_t *Euler, uint16_t Count, LSM6DSV16X_Frame_t Frame);
+LSM6DSV16XStatusTypeDef LSM6DSV16X_Quaternion_To_Euler_SoA(const LSM6DSV16X_Quaternion_SoA_t *Quaternion, const LSM6DSV16X_Euler_SoA_t *Euler, uint16_t Count, LSM6DSV16X_Frame_t Frame);
+LSM6DSV16XStatusTypeDef LSM6DSV16X_Quaternion_To_Matrix(const LSM6DSV16X_Quaternion_t *Quaternion, LSM6DSV16X_Matrix_t *Matrix, uint16_t Count, LSM6DSV16X_Frame_t Frame);
+LSM6DSV16XStatusTypeDef LSM6DSV16X_Quaternion_To_Matrix_SoA(const LSM6DSV16X_Quaternion_SoA_t *Quaternion, const LSM6DSV16X_Matrix_SoA_t *Matrix, uint16_t Count, LSM6DSV16X_Frame_t Frame);
+LSM6DSV16XStatusTypeDef LSM6DSV16X_Linear_Acceleration(const LSM6DSV16X_Vector_t *Acceleration, const LSM6DSV16X_Vector_t *Gravity, LSM6DSV16X_Vector_t *Linear, uint16_t Count, LSM6DSV16X_Frame_t Frame);
+LSM6DSV16XStatusTypeDef LSM6DSV16X_Linear_Acceleration_SoA(const LSM6DSV16X_Vector_SoA_t *Acceleration, const LSM6DSV16X_Vector_SoA_t *Gravity, const LSM6DSV16X_Vector_SoA_t *Linear, uint16_t Count, LSM6DSV16X_Frame_t Frame);
+LSM6DSV16XStatusTypeDef LSM6DSV16X_Linear_Acceleration_Earth(const LSM6DSV16X_Quaternion_t *Quaternion, const LSM6DSV16X_Vector_t *Acceleration, LSM6DSV16X_Vector_t *Linear, uint16_t Count, LSM6DSV16X_Frame_t Frame);
+LSM6DSV16XStatusTypeDef LSM6DSV16X_Linear_Acceleration_Earth_SoA(const LSM6DSV16X_Quaternion_SoA_t *Quaternion, const LSM6DSV16X_Vector_SoA_t *Acceleration, const LSM6DSV16X_Vector_SoA_t *Linear, uint16_t Count, LSM6DSV16X_Frame_t Frame);
+
+#endif /* __LSM6DSV16XOrientation_H__ */
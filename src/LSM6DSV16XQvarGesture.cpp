@@ -0,0 +1,235 @@
+/**
+ ******************************************************************************
+ * @file    LSM6DSV16XQvarGesture.cpp
+ * @author  LSM6DSV16X library contributors
+ * @version V1.0.0
+ * @date    October 2026
+ * @brief   Touch and swipe detector on the LSM6DSV16X QVAR stream.
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; COPYRIGHT(c) 2026 LSM6DSV16X library contributors</center></h2>
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of the copyright holder nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************
+ */
+
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "LSM6DSV16XQvarGesture.h"
+
+
+/* Class Implementation ------------------------------------------------------*/
+
+/** Constructor
+ */
+LSM6DSV16XQvarGesture::LSM6DSV16XQvarGesture()
+{
+  touch_mv = LSM6DSV16X_QVAR_TOUCH_MV;
+  release_mv = LSM6DSV16X_QVAR_RELEASE_MV;
+  tap_us = LSM6DSV16X_QVAR_TAP_MS * 1000U;
+  double_gap_us = LSM6DSV16X_QVAR_DOUBLE_GAP_MS * 1000U;
+  tick_us = 21.75f;
+
+  Reset();
+}
+
+/**
+ * @brief  Restart the detection, the baseline is taken again from the next sample
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XQvarGesture::Reset()
+{
+  now_us = 0U;
+  last_timestamp = 0U;
+  started = 0U;
+  baseline = 0.0f;
+  in_contact = 0U;
+  first_sign = 0;
+  bipolar = 0U;
+  below = 0U;
+  touch_pending = 0U;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Set the contact thresholds
+ * @param  TouchMv deviation from the baseline that starts a contact [mV]
+ * @param  ReleaseMv deviation below which the contact ends [mV], lower than TouchMv
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XQvarGesture::Set_Thresholds(float TouchMv, float ReleaseMv)
+{
+  if (ReleaseMv <= 0.0f || TouchMv <= ReleaseMv) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  touch_mv = TouchMv;
+  release_mv = ReleaseMv;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Set the timings of the touches
+ * @param  TapMs longest contact taken as a touch [ms]
+ * @param  DoubleGapMs longest release between the two touches of a double touch [ms]
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XQvarGesture::Set_Timing(uint16_t TapMs, uint16_t DoubleGapMs)
+{
+  if (TapMs == 0U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  tap_us = (uint32_t)TapMs * 1000U;
+  double_gap_us = (uint32_t)DoubleGapMs * 1000U;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Set the duration of one timestamp LSB, see Get_Timestamp_Resolution
+ * @param  Resolution duration of one timestamp LSB [us]
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XQvarGesture::Set_Timestamp_Resolution(float Resolution)
+{
+  if (Resolution <= 0.0f) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  tick_us = Resolution;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Process a QVAR sample
+ * @note   A touch is reported once the double touch gap has elapsed without a second
+ *         touch, so that a double touch is not also reported as a touch
+ * @param  Sample pointer to the sample read with QVAR_Get_Sample
+ * @param  Gesture pointer where the gesture detected with this sample is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XQvarGesture::Process_Sample(const LSM6DSV16X_QVAR_Sample_t *Sample, LSM6DSV16X_QVAR_Gesture_t *Gesture)
+{
+  float deviation;
+  float magnitude;
+
+  *Gesture = LSM6DSV16X_QVAR_NO_GESTURE;
+
+  if (started == 0U) {
+    started = 1U;
+    last_timestamp = Sample->Timestamp;
+    baseline = Sample->Value;
+    return LSM6DSV16X_OK;
+  }
+
+  now_us += (uint32_t)((float)(Sample->Timestamp - last_timestamp) * tick_us);
+  last_timestamp = Sample->Timestamp;
+
+  deviation = Sample->Value - baseline;
+  magnitude = (deviation < 0.0f) ? -deviation : deviation;
+
+  if (in_contact == 0U) {
+    if (magnitude >= touch_mv) {
+      in_contact = 1U;
+      first_sign = (deviation > 0.0f) ? 1 : -1;
+      bipolar = 0U;
+      below = 0U;
+      contact_start_us = now_us;
+      return LSM6DSV16X_OK;
+    }
+
+    /* Follow the slow drift of the electrodes while released */
+    baseline += deviation / (float)(1U << LSM6DSV16X_QVAR_BASELINE_SHIFT);
+
+    if (touch_pending != 0U && now_us - release_us > double_gap_us) {
+      touch_pending = 0U;
+      *Gesture = LSM6DSV16X_QVAR_TOUCH;
+    }
+    return LSM6DSV16X_OK;
+  }
+
+  if (magnitude >= touch_mv && ((deviation > 0.0f) ? 1 : -1) != first_sign) {
+    bipolar = 1U;
+  }
+
+  if (now_us - contact_start_us > LSM6DSV16X_QVAR_CONTACT_MAX_MS * 1000U) {
+    /* Too long for a gesture, the electrodes moved to a new baseline */
+    in_contact = 0U;
+    touch_pending = 0U;
+    baseline = Sample->Value;
+    return LSM6DSV16X_OK;
+  }
+
+  /* The zero crossing of a swipe is shorter than the release hold */
+  if (magnitude >= release_mv) {
+    below = 0U;
+    return LSM6DSV16X_OK;
+  }
+  if (below == 0U) {
+    below = 1U;
+    below_since_us = now_us;
+  }
+  if (now_us - below_since_us < LSM6DSV16X_QVAR_RELEASE_HOLD_MS * 1000U) {
+    return LSM6DSV16X_OK;
+  }
+
+  in_contact = 0U;
+  release_us = below_since_us;
+
+  if (bipolar != 0U) {
+    touch_pending = 0U;
+    *Gesture = (first_sign > 0) ? LSM6DSV16X_QVAR_SWIPE_FORWARD : LSM6DSV16X_QVAR_SWIPE_BACKWARD;
+  } else if (below_since_us - contact_start_us <= tap_us) {
+    if (touch_pending != 0U) {
+      touch_pending = 0U;
+      *Gesture = LSM6DSV16X_QVAR_DOUBLE_TOUCH;
+    } else {
+      touch_pending = 1U;
+    }
+  } else {
+    /* A long touch ends any pending one */
+    touch_pending = 0U;
+    *Gesture = LSM6DSV16X_QVAR_TOUCH;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the QVAR level tracked while the electrodes are released
+ * @param  Baseline pointer where the baseline is written [mV]
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XQvarGesture::Get_Baseline(float *Baseline)
+{
+  *Baseline = baseline;
+
+  return LSM6DSV16X_OK;
+}
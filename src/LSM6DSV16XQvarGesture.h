@@ -0,0 +1,119 @@
+/**
+ ******************************************************************************
+ * @file    LSM6DSV16XQvarGesture.h
+ * @author  LSM6DSV16X library contributors
+ * @version V1.0.0
+ * @date    October 2026
+ * @brief   Touch and swipe detector on the LSM6DSV16X QVAR stream.
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; COPYRIGHT(c) 2026 LSM6DSV16X library contributors</center></h2>
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of the copyright holder nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************
+ */
+
+
+/* Prevent recursive inclusion -----------------------------------------------*/
+
+#ifndef __LSM6DSV16XQvarGesture_H__
+#define __LSM6DSV16XQvarGesture_H__
+
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "LSM6DSV16XSensor.h"
+
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Default thresholds on the QVAR deviation from the baseline [mV] */
+#define LSM6DSV16X_QVAR_TOUCH_MV    5.0f
+#define LSM6DSV16X_QVAR_RELEASE_MV  2.5f
+
+/* Default timings [ms] */
+#define LSM6DSV16X_QVAR_TAP_MS          300U  /* Longest contact of a touch */
+#define LSM6DSV16X_QVAR_DOUBLE_GAP_MS   250U  /* Longest release between the touches of a double touch */
+#define LSM6DSV16X_QVAR_RELEASE_HOLD_MS  30U  /* Time below the release threshold that ends a contact */
+#define LSM6DSV16X_QVAR_CONTACT_MAX_MS 2000U  /* Longer contacts are taken as a baseline shift */
+
+/* Baseline tracking weight while released, as a power of two */
+#define LSM6DSV16X_QVAR_BASELINE_SHIFT  6U
+
+
+/* Typedefs ------------------------------------------------------------------*/
+
+typedef enum {
+  LSM6DSV16X_QVAR_NO_GESTURE,
+  LSM6DSV16X_QVAR_TOUCH,
+  LSM6DSV16X_QVAR_DOUBLE_TOUCH,
+  LSM6DSV16X_QVAR_SWIPE_FORWARD,   /* Positive lobe first, from electrode 1 to electrode 2 */
+  LSM6DSV16X_QVAR_SWIPE_BACKWARD   /* Negative lobe first */
+} LSM6DSV16X_QVAR_Gesture_t;
+
+
+/* Class Declaration ---------------------------------------------------------*/
+
+/**
+ * Detects touches, double touches and swipes on the two QVAR electrodes from
+ * the timestamped samples of QVAR_Get_Sample. Each sample runs a fixed amount
+ * of work: a contact is a deviation from the tracked baseline, and a swipe
+ * shows both polarities within one contact since QVAR is differential.
+ */
+class LSM6DSV16XQvarGesture {
+  public:
+    LSM6DSV16XQvarGesture();
+    LSM6DSV16XStatusTypeDef Reset();
+    LSM6DSV16XStatusTypeDef Set_Thresholds(float TouchMv, float ReleaseMv);
+    LSM6DSV16XStatusTypeDef Set_Timing(uint16_t TapMs, uint16_t DoubleGapMs);
+    LSM6DSV16XStatusTypeDef Set_Timestamp_Resolution(float Resolution);
+    LSM6DSV16XStatusTypeDef Process_Sample(const LSM6DSV16X_QVAR_Sample_t *Sample, LSM6DSV16X_QVAR_Gesture_t *Gesture);
+    LSM6DSV16XStatusTypeDef Get_Baseline(float *Baseline);
+
+  private:
+    /* Configuration */
+    float touch_mv;
+    float release_mv;
+    uint32_t tap_us;
+    uint32_t double_gap_us;
+    float tick_us;
+
+    /* Time base, from the sample timestamps */
+    uint32_t now_us;
+    uint32_t last_timestamp;
+    uint8_t started;
+
+    float baseline;
+    uint8_t in_contact;
+    int8_t first_sign;   /* Polarity of the first lobe of the contact */
+    uint8_t bipolar;     /* Both polarities crossed the touch threshold */
+    uint32_t contact_start_us;
+    uint32_t below_since_us;
+    uint8_t below;
+    uint8_t touch_pending; /* A touch waiting for a second one */
+    uint32_t release_us;
+};
+
+#endif /* __LSM6DSV16XQvarGesture_H__ */
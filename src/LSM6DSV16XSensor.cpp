@@ -50,10 +50,47 @@ LSM6DSV16XSensor::LSM6DSV16XSensor(TwoWire *i2c, uint8_t address) : dev_i2c(i2c)
 {
   reg_ctx.write_reg = LSM6DSV16X_io_write;
   reg_ctx.read_reg = LSM6DSV16X_io_read;
+  reg_ctx.mdelay = LSM6DSV16X_delay;
   reg_ctx.handle = (void *)this;
   dev_spi = NULL;
   acc_is_enabled = 0L;
   gyro_is_enabled = 0L;
+  acc_dual_enabled = 0U;
+  (void)memset((void *)int_route_count, 0x0, sizeof(int_route_count));
+  int_route_held[0] = 0U;
+  int_route_held[1] = 0U;
+  int_route_committed[0] = 0U;
+  int_route_committed[1] = 0U;
+  int_route_deferred = 0U;
+  int_route_irq_enable = 0U;
+  int_route_irq_hold = 0U;
+  acc_sensitivity = 0.0f;
+  gyro_sensitivity = 0.0f;
+  capture_armed = 0U;
+  fifo_burst_words = (LSM6DSV16X_FIFO_BURST_WORDS < LSM6DSV16X_I2C_BURST_WORDS) ? LSM6DSV16X_FIFO_BURST_WORDS : LSM6DSV16X_I2C_BURST_WORDS;
+  capture_triggered = 0U;
+  activity_cb = NULL;
+  activity_state = LSM6DSV16X_ACTIVITY_STATE;
+  activity_mode = LSM6DSV16X_XL_AND_GY_NOT_AFFECTED;
+  activity_xl_bdr = LSM6DSV16X_XL_NOT_BATCHED;
+  activity_gy_bdr = LSM6DSV16X_GY_NOT_BATCHED;
+  activity_enabled = 0U;
+  sh_enabled = 0U;
+  (void)memset((void *)sh_slave, 0x0, sizeof(sh_slave));
+  sflp_gbias_valid = 0U;
+  xl_cal_running = 0U;
+  bus_held = 0U;
+  fifo_loss_cb = NULL;
+  batch_cnt_threshold = 0U;
+  cfg_track = 0U;
+  thermal_enabled = 0U;
+  Thermal_Update(0.0f);
+  fifo_slot_ticks = 0.0f;
+  (void)FIFO_Reset_Stats();
+  (void)memset((void *)&bus_stats, 0x0, sizeof(LSM6DSV16X_Bus_Stats_t));
+#if LSM6DSV16X_LATENCY_TRACE
+  (void)Reset_Latency_Stats();
+#endif
 }
 
 /** Constructor
@@ -65,10 +102,47 @@ LSM6DSV16XSensor::LSM6DSV16XSensor(SPIClass *spi, int cs_pin, uint32_t spi_speed
 {
   reg_ctx.write_reg = LSM6DSV16X_io_write;
   reg_ctx.read_reg = LSM6DSV16X_io_read;
+  reg_ctx.mdelay = LSM6DSV16X_delay;
   reg_ctx.handle = (void *)this;
   dev_i2c = NULL;
   acc_is_enabled = 0L;
   gyro_is_enabled = 0L;
+  acc_dual_enabled = 0U;
+  (void)memset((void *)int_route_count, 0x0, sizeof(int_route_count));
+  int_route_held[0] = 0U;
+  int_route_held[1] = 0U;
+  int_route_committed[0] = 0U;
+  int_route_committed[1] = 0U;
+  int_route_deferred = 0U;
+  int_route_irq_enable = 0U;
+  int_route_irq_hold = 0U;
+  acc_sensitivity = 0.0f;
+  gyro_sensitivity = 0.0f;
+  capture_armed = 0U;
+  fifo_burst_words = LSM6DSV16X_FIFO_BURST_WORDS;
+  capture_triggered = 0U;
+  activity_cb = NULL;
+  activity_state = LSM6DSV16X_ACTIVITY_STATE;
+  activity_mode = LSM6DSV16X_XL_AND_GY_NOT_AFFECTED;
+  activity_xl_bdr = LSM6DSV16X_XL_NOT_BATCHED;
+  activity_gy_bdr = LSM6DSV16X_GY_NOT_BATCHED;
+  activity_enabled = 0U;
+  sh_enabled = 0U;
+  (void)memset((void *)sh_slave, 0x0, sizeof(sh_slave));
+  sflp_gbias_valid = 0U;
+  xl_cal_running = 0U;
+  bus_held = 0U;
+  fifo_loss_cb = NULL;
+  batch_cnt_threshold = 0U;
+  cfg_track = 0U;
+  thermal_enabled = 0U;
+  Thermal_Update(0.0f);
+  fifo_slot_ticks = 0.0f;
+  (void)FIFO_Reset_Stats();
+  (void)memset((void *)&bus_stats, 0x0, sizeof(LSM6DSV16X_Bus_Stats_t));
+#if LSM6DSV16X_LATENCY_TRACE
+  (void)Reset_Latency_Stats();
+#endif
 }
 
 /**
@@ -111,6 +185,7 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::begin()
   if (lsm6dsv16x_xl_full_scale_set(&reg_ctx, LSM6DSV16X_2g) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
+  acc_sensitivity = LSM6DSV16X_ACC_SENSITIVITY_FS_2G;
 
   /* Select default output data rate. */
   gyro_odr = LSM6DSV16X_ODR_AT_120Hz;
@@ -124,6 +199,7 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::begin()
   if (lsm6dsv16x_gy_full_scale_set(&reg_ctx, LSM6DSV16X_2000dps) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
+  gyro_sensitivity = LSM6DSV16X_GYRO_SENSITIVITY_FS_2000DPS;
 
   initialized = 1U;
 
@@ -186,7 +262,7 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_X()
 
   acc_is_enabled = 1U;
 
-  return LSM6DSV16X_OK;
+  return FIFO_Track_Config();
 }
 
 /**
@@ -212,7 +288,7 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_X()
 
   acc_is_enabled = 0U;
 
-  return LSM6DSV16X_OK;
+  return FIFO_Track_Config();
 }
 
 /**
@@ -442,10 +518,16 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_X_ODR(float Odr, LSM6DSV16X_ACC_Op
   }
 
   if (acc_is_enabled == 1U) {
-    return Set_X_ODR_When_Enabled(Odr);
+    if (Set_X_ODR_When_Enabled(Odr) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
   } else {
-    return Set_X_ODR_When_Disabled(Odr);
+    if (Set_X_ODR_When_Disabled(Odr) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
   }
+
+  return FIFO_Track_Config();
 }
 
 /**
@@ -557,11 +639,14 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_X_FS(int32_t FullScale)
            : (FullScale <= 8) ? LSM6DSV16X_8g
            :                    LSM6DSV16X_16g;
 
+  /* Invalidate the cached sensitivity */
+  acc_sensitivity = 0.0f;
+
   if (lsm6dsv16x_xl_full_scale_set(&reg_ctx, new_fs) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  return LSM6DSV16X_OK;
+  return FIFO_Track_Config();
 }
 
 /**
@@ -698,6 +783,12 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_X_Event_Status(LSM6DSV16X_Event_St
     }
   }
 
+  if ((md1_cfg.int1_sleep_change == 1U) || (md2_cfg.int2_sleep_change == 1U)) {
+    if (wake_up_src.sleep_change_ia == 1U) {
+      Status->SleepStatus = 1;
+    }
+  }
+
   if (int1_ctrl.int1_step_detector == 1U || int2_ctrl.int2_step_detector == 1U) {
     if (func_src.step_detected == 1U) {
       Status->StepStatus = 1;
@@ -710,6 +801,12 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_X_Event_Status(LSM6DSV16X_Event_St
     }
   }
 
+  if ((int1_ctrl.int1_sig_mot == 1U) || (int2_ctrl.int2_sig_mot == 1U)) {
+    if (emb_func_status.is_sigmot == 1U) {
+      Status->SignificantMotionStatus = 1;
+    }
+  }
+
   return LSM6DSV16X_OK;
 }
 
@@ -758,385 +855,703 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_X_Filter_Mode(uint8_t LowHighPassF
 }
 
 /**
- * @brief  Enable 6D orientation detection
- * @param  IntPin interrupt pin line to be used
+ * @brief  Enable the accelerometer dual channel, a second output at 16 g full scale
+ *         next to the one at the full scale selected with Set_X_FS
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_6D_Orientation(LSM6DSV16X_SensorIntPin_t IntPin)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_X_Dual_Channel()
 {
-  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
-  lsm6dsv16x_md1_cfg_t val1;
-  lsm6dsv16x_md2_cfg_t val2;
-  lsm6dsv16x_functions_enable_t functions_enable;
-
-  /* Output Data Rate selection */
-  if (Set_X_ODR(480.0f) != LSM6DSV16X_OK) {
+  if (lsm6dsv16x_xl_dual_channel_set(&reg_ctx, PROPERTY_ENABLE) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Full scale selection */
-  if (Set_X_FS(2) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
+  acc_dual_enabled = 1U;
 
-  /* 6D orientation enabled. */
-  if (Set_6D_Orientation_Threshold(2) != LSM6DSV16X_OK) {
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Disable the accelerometer dual channel
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_X_Dual_Channel()
+{
+  if (lsm6dsv16x_xl_dual_channel_set(&reg_ctx, PROPERTY_DISABLE) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
-  /* Enable 6D orientation event on either INT1 or INT2 pin */
-  switch (IntPin) {
-    case LSM6DSV16X_INT1_PIN:
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      val1.int1_6d = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      functions_enable.interrupts_enable = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-      break;
-
-    case LSM6DSV16X_INT2_PIN:
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      val2.int2_6d = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      functions_enable.interrupts_enable = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-      break;
 
-    default:
-      ret = LSM6DSV16X_ERROR;
-      break;
-  }
+  acc_dual_enabled = 0U;
 
-  return ret;
+  return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Disable 6D orientation detection
+ * @brief  Get both accelerometer channels with a single burst from OUTX_L_A to UI_OUTZ_H_A_OIS_DUALC
+ * @param  Channel1 pointer where the raw values of the selected full scale channel are written
+ * @param  Channel2 pointer where the raw values of the 16 g channel are written
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_6D_Orientation()
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_X_Dual_AxesRaw(int16_t *Channel1, int16_t *Channel2)
 {
-  lsm6dsv16x_md1_cfg_t val1;
-  lsm6dsv16x_md2_cfg_t val2;
+  uint8_t buff[18];
 
-  /* Reset threshold */
-  if (Set_6D_Orientation_Threshold(0) != LSM6DSV16X_OK) {
+  if (acc_dual_enabled == 0U) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Disable 6D orientation event on both INT1 and INT2 pins */
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
+  /* OUTX_L_A (28h) .. OUTZ_H_A (2Dh), UI_OUTX_L_G_OIS_EIS (2Eh) .. (33h), UI_OUTX_L_A_OIS_DUALC (34h) .. (39h) */
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_OUTX_L_A, buff, 18) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  val1.int1_6d = PROPERTY_DISABLE;
-
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
+  for (uint8_t i = 0U; i < 3U; i++) {
+    Channel1[i] = (int16_t)((uint16_t)buff[2U * i + 1U] << 8 | buff[2U * i]);
+    Channel2[i] = (int16_t)((uint16_t)buff[2U * i + 13U] << 8 | buff[2U * i + 12U]);
   }
 
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get both accelerometer channels
+ * @param  Channel1 pointer where the values of the selected full scale channel are written [mg]
+ * @param  Channel2 pointer where the values of the 16 g channel are written [mg]
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_X_Dual_Axes(float *Channel1, float *Channel2)
+{
+  int16_t raw1[3];
+  int16_t raw2[3];
+
+  if (Get_X_Dual_AxesRaw(raw1, raw2) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  val2.int2_6d = PROPERTY_DISABLE;
+  if (acc_sensitivity == 0.0f) {
+    if (Get_X_Sensitivity(&acc_sensitivity) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
 
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
+  for (uint8_t i = 0U; i < 3U; i++) {
+    Channel1[i] = (float)raw1[i] * acc_sensitivity;
+    Channel2[i] = (float)raw2[i] * LSM6DSV16X_XL_DUAL_SENSITIVITY;
   }
 
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Set 6D orientation threshold
- * @param  Threshold 6D Orientation detection threshold
+ * @brief  Get the acceleration from the selected full scale channel, each axis close to
+ *         saturation being taken from the 16 g channel
+ * @param  Acceleration pointer where the values of the axes are written [mg]
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_6D_Orientation_Threshold(uint8_t Threshold)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_X_HDR_Axes(float *Acceleration)
 {
-  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
-  lsm6dsv16x_6d_threshold_t newThreshold = LSM6DSV16X_DEG_80;
+  int16_t raw1[3];
+  int16_t raw2[3];
 
-  switch (Threshold) {
-    case 0:
-      newThreshold = LSM6DSV16X_DEG_80;
-      break;
-    case 1:
-      newThreshold = LSM6DSV16X_DEG_70;
-      break;
-    case 2:
-      newThreshold = LSM6DSV16X_DEG_60;
-      break;
-    case 3:
-      newThreshold = LSM6DSV16X_DEG_50;
-      break;
-    default:
-      ret = LSM6DSV16X_ERROR;
-      break;
+  if (Get_X_Dual_AxesRaw(raw1, raw2) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
   }
 
-  if (ret == LSM6DSV16X_ERROR) {
-    return LSM6DSV16X_ERROR;
+  if (acc_sensitivity == 0.0f) {
+    if (Get_X_Sensitivity(&acc_sensitivity) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
   }
 
-  if (lsm6dsv16x_6d_threshold_set(&reg_ctx, newThreshold) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
+  for (uint8_t i = 0U; i < 3U; i++) {
+    if (raw1[i] >= LSM6DSV16X_XL_HDR_SWITCH_LSB || raw1[i] <= -LSM6DSV16X_XL_HDR_SWITCH_LSB) {
+      Acceleration[i] = (float)raw2[i] * LSM6DSV16X_XL_DUAL_SENSITIVITY;
+    } else {
+      Acceleration[i] = (float)raw1[i] * acc_sensitivity;
+    }
   }
 
   return LSM6DSV16X_OK;
-
 }
 
 /**
- * @brief  Get the status of XLow orientation
- * @param  XLow the status of XLow orientation
+ * @brief  Route an interrupt source to a pin
+ * @note   Every call takes a reference on the source, which stays routed until all the
+ *         references are released by Unroute_Interrupt and the feature using it is disabled
+ * @param  IntPin interrupt pin line to be used
+ * @param  Source interrupt source to be routed
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_6D_Orientation_XL(uint8_t *XLow)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Route_Interrupt(LSM6DSV16X_SensorIntPin_t IntPin, LSM6DSV16X_Int_Source_t Source)
 {
-  lsm6dsv16x_d6d_src_t data;
-
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_D6D_SRC, (uint8_t *)&data, 1) != LSM6DSV16X_OK) {
+  if ((IntPin != LSM6DSV16X_INT1_PIN && IntPin != LSM6DSV16X_INT2_PIN)
+      || (uint8_t)Source >= LSM6DSV16X_INT_SOURCE_NUMBER
+      || int_route_count[IntPin][Source] == 0xFFU) {
     return LSM6DSV16X_ERROR;
   }
 
-  *XLow = data.xl;
+  int_route_count[IntPin][Source]++;
 
-  return LSM6DSV16X_OK;
+  return Commit_Interrupt_Routing();
 }
 
 /**
- * @brief  Get the status of XHigh orientation
- * @param  XHigh the status of XHigh orientation
+ * @brief  Release a reference taken by Route_Interrupt
+ * @param  IntPin interrupt pin line the source was routed to
+ * @param  Source interrupt source to be released
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_6D_Orientation_XH(uint8_t *XHigh)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Unroute_Interrupt(LSM6DSV16X_SensorIntPin_t IntPin, LSM6DSV16X_Int_Source_t Source)
 {
-  lsm6dsv16x_d6d_src_t data;
+  if ((IntPin != LSM6DSV16X_INT1_PIN && IntPin != LSM6DSV16X_INT2_PIN)
+      || (uint8_t)Source >= LSM6DSV16X_INT_SOURCE_NUMBER) {
+    return LSM6DSV16X_ERROR;
+  }
 
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_D6D_SRC, (uint8_t *)&data, 1) != LSM6DSV16X_OK) {
+  /* The reference of the Enable_ functions is only released when the feature is disabled */
+  if (int_route_count[IntPin][Source] <= ((int_route_held[IntPin] >> Source) & 1UL)) {
     return LSM6DSV16X_ERROR;
   }
 
-  *XHigh = data.xh;
+  int_route_count[IntPin][Source]--;
 
-  return LSM6DSV16X_OK;
+  return Commit_Interrupt_Routing();
 }
 
 /**
- * @brief  Get the status of YLow orientation
- * @param  YLow the status of YLow orientation
+ * @brief  Defer the routing changes until End_Interrupt_Routing
+ * @note   Enabling several features in between writes their routing in a single pass
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_6D_Orientation_YL(uint8_t *YLow)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Begin_Interrupt_Routing()
 {
-  lsm6dsv16x_d6d_src_t data;
-
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_D6D_SRC, (uint8_t *)&data, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  *YLow = data.yl;
+  int_route_deferred = 1U;
 
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Get the status of YHigh orientation
- * @param  YHigh the status of YHigh orientation
+ * @brief  Write the routing changes accumulated since Begin_Interrupt_Routing
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_6D_Orientation_YH(uint8_t *YHigh)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::End_Interrupt_Routing()
 {
-  lsm6dsv16x_d6d_src_t data;
+  int_route_deferred = 0U;
 
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_D6D_SRC, (uint8_t *)&data, 1) != LSM6DSV16X_OK) {
+  return Commit_Interrupt_Routing();
+}
+
+/**
+ * @brief  Get the interrupt sources routed to a pin by the routing manager
+ * @param  IntPin interrupt pin line
+ * @param  Sources pointer where the mask of the routed sources is written, bit n for source n
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_Interrupt_Routing(LSM6DSV16X_SensorIntPin_t IntPin, uint32_t *Sources)
+{
+  if (IntPin != LSM6DSV16X_INT1_PIN && IntPin != LSM6DSV16X_INT2_PIN) {
     return LSM6DSV16X_ERROR;
   }
 
-  *YHigh = data.yh;
+  *Sources = 0U;
+  for (uint8_t i = 0; i < LSM6DSV16X_INT_SOURCE_NUMBER; i++) {
+    if (int_route_count[IntPin][i] != 0U) {
+      *Sources |= 1UL << i;
+    }
+  }
 
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Get the status of ZLow orientation
- * @param  ZLow the status of ZLow orientation
+ * @brief  Take or release the reference of a feature on an interrupt source
+ * @note   Unlike Route_Interrupt, a feature holds at most one reference per pin
+ * @param  IntPin interrupt pin line
+ * @param  Source interrupt source used by the feature
+ * @param  Status 1 to take the reference, 0 to release it
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_6D_Orientation_ZL(uint8_t *ZLow)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Hold_Interrupt(LSM6DSV16X_SensorIntPin_t IntPin, LSM6DSV16X_Int_Source_t Source, uint8_t Status)
 {
-  lsm6dsv16x_d6d_src_t data;
+  uint32_t bit = 1UL << Source;
 
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_D6D_SRC, (uint8_t *)&data, 1) != LSM6DSV16X_OK) {
+  if (IntPin != LSM6DSV16X_INT1_PIN && IntPin != LSM6DSV16X_INT2_PIN) {
     return LSM6DSV16X_ERROR;
   }
 
-  *ZLow = data.zl;
+  if (Status != 0U && (int_route_held[IntPin] & bit) == 0U) {
+    int_route_count[IntPin][Source]++;
+    int_route_held[IntPin] |= bit;
+  } else if (Status == 0U && (int_route_held[IntPin] & bit) != 0U) {
+    int_route_count[IntPin][Source]--;
+    int_route_held[IntPin] &= ~bit;
+  }
 
-  return LSM6DSV16X_OK;
+  return Commit_Interrupt_Routing();
 }
 
 /**
- * @brief  Get the status of ZHigh orientation
- * @param  ZHigh the status of ZHigh orientation
+ * @brief  Release the references of a feature on an interrupt source, on both pins
+ * @param  Source interrupt source used by the feature
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_6D_Orientation_ZH(uint8_t *ZHigh)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Release_Interrupt(LSM6DSV16X_Int_Source_t Source)
 {
-  lsm6dsv16x_d6d_src_t data;
+  uint32_t bit = 1UL << Source;
 
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_D6D_SRC, (uint8_t *)&data, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
+  for (uint8_t pin = 0; pin < 2U; pin++) {
+    if ((int_route_held[pin] & bit) != 0U) {
+      int_route_count[pin][Source]--;
+      int_route_held[pin] &= ~bit;
+    }
   }
 
-  *ZHigh = data.zh;
-
-  return LSM6DSV16X_OK;
+  return Commit_Interrupt_Routing();
 }
 
+/* Field of a routing register, updated only when the manager changes the source */
+#define LSM6DSV16X_INT_ROUTE_FIELD(Field, Pin, Source) \
+  if ((changed[Pin] & (1UL << (Source))) != 0U) { \
+    Field = ((desired[Pin] & (1UL << (Source))) != 0U) ? PROPERTY_ENABLE : PROPERTY_DISABLE; \
+  }
 
 /**
- * @brief  Enable free fall detection
- * @param  IntPin interrupt pin line to be used
+ * @brief  Write the routing of the referenced sources to the device
+ * @note   Only the sources whose routing changed since the last commit are written, so
+ *         routing set outside the manager (e.g. by an MLC/FSM configuration) is kept.
+ *         Each pin costs one pass of lsm6dsv16x_pin_intX_route_get/set, the embedded
+ *         function sources of both pins a single memory bank switch.
+ *         FUNCTIONS_ENABLE.INTERRUPTS_ENABLE is owned by the manager while basic sources are routed
+ *         or the accelerometer offset calibration runs.
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Free_Fall_Detection(LSM6DSV16X_SensorIntPin_t IntPin)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Commit_Interrupt_Routing()
 {
-  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
-  lsm6dsv16x_md1_cfg_t val1;
-  lsm6dsv16x_md2_cfg_t val2;
+  lsm6dsv16x_pin_int_route_t route;
+  lsm6dsv16x_emb_func_int1_t emb_func_int1;
+  lsm6dsv16x_emb_func_int2_t emb_func_int2;
   lsm6dsv16x_functions_enable_t functions_enable;
+  uint32_t desired[2];
+  uint32_t changed[2];
+  uint8_t irq_enable;
 
-  /* Output Data Rate selection */
-  if (Set_X_ODR(480) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
+  if (int_route_deferred != 0U) {
+    return LSM6DSV16X_OK;
   }
 
-  /* Full scale selection */
-  if (Set_X_FS(2) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
+  for (uint8_t pin = 0; pin < 2U; pin++) {
+    desired[pin] = 0U;
+    for (uint8_t i = 0; i < LSM6DSV16X_INT_SOURCE_NUMBER; i++) {
+      if (int_route_count[pin][i] != 0U) {
+        desired[pin] |= 1UL << i;
+      }
+    }
 
-  /*  Set free fall duration.*/
-  if (Set_Free_Fall_Duration(3) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
+    /* INTx_EMB_FUNC is shared by all the embedded function sources of the pin */
+    if ((desired[pin] & LSM6DSV16X_INT_ROUTE_EMB_SOURCES) != 0U) {
+      desired[pin] |= LSM6DSV16X_INT_ROUTE_EMB_FUNC;
+    }
+
+    changed[pin] = desired[pin] ^ int_route_committed[pin];
   }
 
-  /* Set free fall threshold. */
-  if (Set_Free_Fall_Threshold(3) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
+  irq_enable = (((desired[0] | desired[1]) & LSM6DSV16X_INT_ROUTE_BASIC_SOURCES) != 0U
+                || int_route_irq_hold != 0U) ? 1U : 0U;
+
+  if ((changed[0] | changed[1]) == 0U && irq_enable == int_route_irq_enable) {
+    return LSM6DSV16X_OK;
   }
 
-  /* Enable free fall event on either INT1 or INT2 pin */
-  switch (IntPin) {
-    case LSM6DSV16X_INT1_PIN:
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
+  /* Embedded function sources first, so that INTx_EMB_FUNC never routes a stale selection */
+  if (((changed[0] | changed[1]) & LSM6DSV16X_INT_ROUTE_EMB_SOURCES) != 0U) {
+    if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_EMBED_FUNC_MEM_BANK) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+
+    if ((changed[0] & LSM6DSV16X_INT_ROUTE_EMB_SOURCES) != 0U) {
+      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT1, (uint8_t *)&emb_func_int1, 1) != LSM6DSV16X_OK) {
         return LSM6DSV16X_ERROR;
       }
 
-      val1.int1_ff = PROPERTY_ENABLE;
+      LSM6DSV16X_INT_ROUTE_FIELD(emb_func_int1.int1_step_detector, 0, LSM6DSV16X_INT_STEP_DETECTOR)
+      LSM6DSV16X_INT_ROUTE_FIELD(emb_func_int1.int1_tilt, 0, LSM6DSV16X_INT_TILT)
+      LSM6DSV16X_INT_ROUTE_FIELD(emb_func_int1.int1_sig_mot, 0, LSM6DSV16X_INT_SIG_MOT)
+      LSM6DSV16X_INT_ROUTE_FIELD(emb_func_int1.int1_fsm_lc, 0, LSM6DSV16X_INT_FSM_LC)
 
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
+      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT1, (uint8_t *)&emb_func_int1, 1) != LSM6DSV16X_OK) {
         return LSM6DSV16X_ERROR;
       }
+    }
 
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
+    if ((changed[1] & LSM6DSV16X_INT_ROUTE_EMB_SOURCES) != 0U) {
+      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT2, (uint8_t *)&emb_func_int2, 1) != LSM6DSV16X_OK) {
         return LSM6DSV16X_ERROR;
       }
 
-      functions_enable.interrupts_enable = PROPERTY_ENABLE;
+      LSM6DSV16X_INT_ROUTE_FIELD(emb_func_int2.int2_step_detector, 1, LSM6DSV16X_INT_STEP_DETECTOR)
+      LSM6DSV16X_INT_ROUTE_FIELD(emb_func_int2.int2_tilt, 1, LSM6DSV16X_INT_TILT)
+      LSM6DSV16X_INT_ROUTE_FIELD(emb_func_int2.int2_sig_mot, 1, LSM6DSV16X_INT_SIG_MOT)
+      LSM6DSV16X_INT_ROUTE_FIELD(emb_func_int2.int2_fsm_lc, 1, LSM6DSV16X_INT_FSM_LC)
 
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
+      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT2, (uint8_t *)&emb_func_int2, 1) != LSM6DSV16X_OK) {
         return LSM6DSV16X_ERROR;
       }
-      break;
+    }
 
-    case LSM6DSV16X_INT2_PIN:
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
+    if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
 
-      val2.int2_ff = PROPERTY_ENABLE;
+  for (uint8_t pin = 0; pin < 2U; pin++) {
+    if ((changed[pin] & ~LSM6DSV16X_INT_ROUTE_EMB_SOURCES) == 0U) {
+      continue;
+    }
 
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
+    (void)memset((void *)&route, 0x0, sizeof(route));
+    if (((pin == 0U) ? lsm6dsv16x_pin_int1_route_get(&reg_ctx, &route)
+         : lsm6dsv16x_pin_int2_route_get(&reg_ctx, &route)) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
 
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
+    LSM6DSV16X_INT_ROUTE_FIELD(route.drdy_xl, pin, LSM6DSV16X_INT_DRDY_XL)
+    LSM6DSV16X_INT_ROUTE_FIELD(route.drdy_g, pin, LSM6DSV16X_INT_DRDY_G)
+    LSM6DSV16X_INT_ROUTE_FIELD(route.fifo_th, pin, LSM6DSV16X_INT_FIFO_TH)
+    LSM6DSV16X_INT_ROUTE_FIELD(route.fifo_ovr, pin, LSM6DSV16X_INT_FIFO_OVR)
+    LSM6DSV16X_INT_ROUTE_FIELD(route.fifo_full, pin, LSM6DSV16X_INT_FIFO_FULL)
+    LSM6DSV16X_INT_ROUTE_FIELD(route.cnt_bdr, pin, LSM6DSV16X_INT_CNT_BDR)
+    LSM6DSV16X_INT_ROUTE_FIELD(route.sixd, pin, LSM6DSV16X_INT_6D)
+    LSM6DSV16X_INT_ROUTE_FIELD(route.single_tap, pin, LSM6DSV16X_INT_SINGLE_TAP)
+    LSM6DSV16X_INT_ROUTE_FIELD(route.double_tap, pin, LSM6DSV16X_INT_DOUBLE_TAP)
+    LSM6DSV16X_INT_ROUTE_FIELD(route.wakeup, pin, LSM6DSV16X_INT_WAKE_UP)
+    LSM6DSV16X_INT_ROUTE_FIELD(route.freefall, pin, LSM6DSV16X_INT_FREE_FALL)
+    LSM6DSV16X_INT_ROUTE_FIELD(route.sleep_change, pin, LSM6DSV16X_INT_SLEEP_CHANGE)
+    LSM6DSV16X_INT_ROUTE_FIELD(route.emb_func, pin, LSM6DSV16X_INT_SOURCE_NUMBER)
+
+    if (((pin == 0U) ? lsm6dsv16x_pin_int1_route_set(&reg_ctx, &route)
+         : lsm6dsv16x_pin_int2_route_set(&reg_ctx, &route)) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
 
-      functions_enable.interrupts_enable = PROPERTY_ENABLE;
+  /* The basic interrupts need INTERRUPTS_ENABLE, set with the first user and cleared with the last */
+  if (irq_enable != int_route_irq_enable) {
+    if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
 
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-      break;
+    functions_enable.interrupts_enable = irq_enable;
 
-    default:
-      ret = LSM6DSV16X_ERROR;
-      break;
+    if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
   }
 
-  return ret;
+  int_route_committed[0] = desired[0];
+  int_route_committed[1] = desired[1];
+  int_route_irq_enable = irq_enable;
+
+  return LSM6DSV16X_OK;
 }
 
+#undef LSM6DSV16X_INT_ROUTE_FIELD
+
+/* Source routed in the device */
+#define LSM6DSV16X_INT_ROUTE_READ(Field, Source) \
+  if ((Field) != 0U) { \
+    routed |= 1UL << (Source); \
+  }
+
 /**
- * @brief  Disable free fall detection
+ * @brief  Re-read the routing of the main page after it was written outside the manager
+ * @note   Only the referenced sources found routed in the device are taken as committed, so
+ *         the next commit routes again the references the device lost and leaves the other
+ *         sources as they are. The embedded function registers are not read, the main page
+ *         writers (e.g. Set_Config_Image) do not change them.
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Free_Fall_Detection()
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Sync_Interrupt_Routing()
 {
-  lsm6dsv16x_md1_cfg_t val1;
-  lsm6dsv16x_md2_cfg_t val2;
+  lsm6dsv16x_pin_int_route_t route;
+  lsm6dsv16x_functions_enable_t functions_enable;
+  uint32_t referenced[2];
+  uint32_t routed;
 
-  /* Disable free fall event on both INT1 and INT2 pins */
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
+  for (uint8_t pin = 0; pin < 2U; pin++) {
+    (void)Get_Interrupt_Routing((LSM6DSV16X_SensorIntPin_t)pin, &referenced[pin]);
+    if ((referenced[pin] & LSM6DSV16X_INT_ROUTE_EMB_SOURCES) != 0U) {
+      referenced[pin] |= LSM6DSV16X_INT_ROUTE_EMB_FUNC;
+    }
+
+    (void)memset((void *)&route, 0x0, sizeof(route));
+    if (((pin == 0U) ? lsm6dsv16x_pin_int1_route_get(&reg_ctx, &route)
+         : lsm6dsv16x_pin_int2_route_get(&reg_ctx, &route)) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+
+    routed = 0U;
+    LSM6DSV16X_INT_ROUTE_READ(route.drdy_xl, LSM6DSV16X_INT_DRDY_XL)
+    LSM6DSV16X_INT_ROUTE_READ(route.drdy_g, LSM6DSV16X_INT_DRDY_G)
+    LSM6DSV16X_INT_ROUTE_READ(route.fifo_th, LSM6DSV16X_INT_FIFO_TH)
+    LSM6DSV16X_INT_ROUTE_READ(route.fifo_ovr, LSM6DSV16X_INT_FIFO_OVR)
+    LSM6DSV16X_INT_ROUTE_READ(route.fifo_full, LSM6DSV16X_INT_FIFO_FULL)
+    LSM6DSV16X_INT_ROUTE_READ(route.cnt_bdr, LSM6DSV16X_INT_CNT_BDR)
+    LSM6DSV16X_INT_ROUTE_READ(route.sixd, LSM6DSV16X_INT_6D)
+    LSM6DSV16X_INT_ROUTE_READ(route.single_tap, LSM6DSV16X_INT_SINGLE_TAP)
+    LSM6DSV16X_INT_ROUTE_READ(route.double_tap, LSM6DSV16X_INT_DOUBLE_TAP)
+    LSM6DSV16X_INT_ROUTE_READ(route.wakeup, LSM6DSV16X_INT_WAKE_UP)
+    LSM6DSV16X_INT_ROUTE_READ(route.freefall, LSM6DSV16X_INT_FREE_FALL)
+    LSM6DSV16X_INT_ROUTE_READ(route.sleep_change, LSM6DSV16X_INT_SLEEP_CHANGE)
+    LSM6DSV16X_INT_ROUTE_READ(route.emb_func, LSM6DSV16X_INT_SOURCE_NUMBER)
+
+    int_route_committed[pin] = (int_route_committed[pin] & LSM6DSV16X_INT_ROUTE_EMB_SOURCES)
+                               | (routed & referenced[pin]);
+  }
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  int_route_irq_enable = (functions_enable.interrupts_enable != 0U
+                          && (((referenced[0] | referenced[1]) & LSM6DSV16X_INT_ROUTE_BASIC_SOURCES) != 0U
+                              || int_route_irq_hold != 0U)) ? 1U : 0U;
+
+  return LSM6DSV16X_OK;
+}
+
+#undef LSM6DSV16X_INT_ROUTE_READ
+
+/**
+ * @brief  Enable 6D orientation detection
+ * @param  IntPin interrupt pin line to be used
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_6D_Orientation(LSM6DSV16X_SensorIntPin_t IntPin)
+{
+  /* Output Data Rate selection */
+  if (Set_X_ODR(480.0f) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* Full scale selection */
+  if (Set_X_FS(2) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* 6D orientation enabled. */
+  if (Set_6D_Orientation_Threshold(2) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+  /* Enable 6D orientation event on either INT1 or INT2 pin */
+  return Hold_Interrupt(IntPin, LSM6DSV16X_INT_6D, 1U);
+}
+
+/**
+ * @brief  Disable 6D orientation detection
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_6D_Orientation()
+{
+  /* Reset threshold */
+  if (Set_6D_Orientation_Threshold(0) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* Disable 6D orientation event on both INT1 and INT2 pins */
+  if (Release_Interrupt(LSM6DSV16X_INT_6D) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Set 6D orientation threshold
+ * @param  Threshold 6D Orientation detection threshold
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_6D_Orientation_Threshold(uint8_t Threshold)
+{
+  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
+  lsm6dsv16x_6d_threshold_t newThreshold = LSM6DSV16X_DEG_80;
+
+  switch (Threshold) {
+    case 0:
+      newThreshold = LSM6DSV16X_DEG_80;
+      break;
+    case 1:
+      newThreshold = LSM6DSV16X_DEG_70;
+      break;
+    case 2:
+      newThreshold = LSM6DSV16X_DEG_60;
+      break;
+    case 3:
+      newThreshold = LSM6DSV16X_DEG_50;
+      break;
+    default:
+      ret = LSM6DSV16X_ERROR;
+      break;
+  }
+
+  if (ret == LSM6DSV16X_ERROR) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_6d_threshold_set(&reg_ctx, newThreshold) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+
+}
+
+/**
+ * @brief  Get the status of XLow orientation
+ * @param  XLow the status of XLow orientation
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_6D_Orientation_XL(uint8_t *XLow)
+{
+  lsm6dsv16x_d6d_src_t data;
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_D6D_SRC, (uint8_t *)&data, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  *XLow = data.xl;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the status of XHigh orientation
+ * @param  XHigh the status of XHigh orientation
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_6D_Orientation_XH(uint8_t *XHigh)
+{
+  lsm6dsv16x_d6d_src_t data;
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_D6D_SRC, (uint8_t *)&data, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-  val1.int1_ff = PROPERTY_DISABLE;
+  *XHigh = data.xh;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the status of YLow orientation
+ * @param  YLow the status of YLow orientation
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_6D_Orientation_YL(uint8_t *YLow)
+{
+  lsm6dsv16x_d6d_src_t data;
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_D6D_SRC, (uint8_t *)&data, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  *YLow = data.yl;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the status of YHigh orientation
+ * @param  YHigh the status of YHigh orientation
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_6D_Orientation_YH(uint8_t *YHigh)
+{
+  lsm6dsv16x_d6d_src_t data;
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_D6D_SRC, (uint8_t *)&data, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  *YHigh = data.yh;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the status of ZLow orientation
+ * @param  ZLow the status of ZLow orientation
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_6D_Orientation_ZL(uint8_t *ZLow)
+{
+  lsm6dsv16x_d6d_src_t data;
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_D6D_SRC, (uint8_t *)&data, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  *ZLow = data.zl;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the status of ZHigh orientation
+ * @param  ZHigh the status of ZHigh orientation
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_6D_Orientation_ZH(uint8_t *ZHigh)
+{
+  lsm6dsv16x_d6d_src_t data;
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_D6D_SRC, (uint8_t *)&data, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  *ZHigh = data.zh;
+
+  return LSM6DSV16X_OK;
+}
+
+
+/**
+ * @brief  Enable free fall detection
+ * @param  IntPin interrupt pin line to be used
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Free_Fall_Detection(LSM6DSV16X_SensorIntPin_t IntPin)
+{
+  /* Output Data Rate selection */
+  if (Set_X_ODR(480) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* Full scale selection */
+  if (Set_X_FS(2) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
+  /*  Set free fall duration.*/
+  if (Set_Free_Fall_Duration(3) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
+  /* Set free fall threshold. */
+  if (Set_Free_Fall_Threshold(3) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  val2.int2_ff = PROPERTY_DISABLE;
+  /* Enable free fall event on either INT1 or INT2 pin */
+  return Hold_Interrupt(IntPin, LSM6DSV16X_INT_FREE_FALL, 1U);
+}
 
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
+/**
+ * @brief  Disable free fall detection
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Free_Fall_Detection()
+{
+  /* Disable free fall event on both INT1 and INT2 pins */
+  if (Release_Interrupt(LSM6DSV16X_INT_FREE_FALL) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
@@ -1229,11 +1644,6 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_Free_Fall_Duration(uint8_t Duratio
  */
 LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Wake_Up_Detection(LSM6DSV16X_SensorIntPin_t IntPin)
 {
-  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
-  lsm6dsv16x_md1_cfg_t val1;
-  lsm6dsv16x_md2_cfg_t val2;
-  lsm6dsv16x_functions_enable_t functions_enable;
-
   /* Output Data Rate selection */
   if (Set_X_ODR(480) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
@@ -1255,131 +1665,197 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Wake_Up_Detection(LSM6DSV16X_Se
   }
 
   /* Enable wake up event on either INT1 or INT2 pin */
-  switch (IntPin) {
-    case LSM6DSV16X_INT1_PIN:
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      val1.int1_wu = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
+  return Hold_Interrupt(IntPin, LSM6DSV16X_INT_WAKE_UP, 1U);
+}
 
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
 
-      functions_enable.interrupts_enable = PROPERTY_ENABLE;
+/**
+ * @brief  Disable wake up detection
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Wake_Up_Detection()
+{
+  /* Disable wake up event on both INT1 and INT2 pins */
+  if (Release_Interrupt(LSM6DSV16X_INT_WAKE_UP) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-      break;
-
-    case LSM6DSV16X_INT2_PIN:
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
+  /* Reset wake-up threshold */
+  if (Set_Wake_Up_Threshold(0) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-      val2.int2_wu = PROPERTY_ENABLE;
+  /* Reset wake-up durantion */
+  if (Set_Wake_Up_Duration(0) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
+  return LSM6DSV16X_OK;
+}
 
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
+/**
+ * @brief  Set wake up threshold
+ * @param  Threshold wake up detection threshold
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_Wake_Up_Threshold(uint32_t Threshold)
+{
+  lsm6dsv16x_act_thresholds_t wake_up_ths;
 
-      functions_enable.interrupts_enable = PROPERTY_ENABLE;
+  if (lsm6dsv16x_act_thresholds_get(&reg_ctx, &wake_up_ths) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-      break;
+  wake_up_ths.threshold = Threshold;
 
-    default:
-      ret = LSM6DSV16X_ERROR;
-      break;
+  if (lsm6dsv16x_act_thresholds_set(&reg_ctx, &wake_up_ths) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
   }
 
-  return ret;
+  return LSM6DSV16X_OK;
 }
 
+/**
+ * @brief  Set wake up duration
+ * @param  Duration wake up detection duration
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_Wake_Up_Duration(uint8_t Duration)
+{
+  lsm6dsv16x_act_wkup_time_windows_t dur_t;
+
+  if (lsm6dsv16x_act_wkup_time_windows_get(&reg_ctx, &dur_t) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  dur_t.shock = Duration;
+
+  if (lsm6dsv16x_act_wkup_time_windows_set(&reg_ctx, dur_t) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
 
 /**
- * @brief  Disable wake up detection
+ * @brief  Enable the activity/inactivity power manager
+ * @note   When the device is still the accelerometer drops to SleepOdr in low-power mode and the gyroscope
+ *         is handled according to Mode. Service_Activity_Power_Manager() must be called on the sleep change
+ *         interrupt to follow the transitions with the FIFO batch rates. The wake-up threshold and the
+ *         inactivity duration are set to LSM6DSV16X_ACTIVITY_WAKE_THS and LSM6DSV16X_ACTIVITY_SLEEP_DUR,
+ *         Set_Wake_Up_Threshold and Set_Sleep_Duration change them afterwards.
+ * @param  IntPin interrupt pin line where the sleep change event is routed
+ * @param  ActiveOdr accelerometer ODR and FIFO BDR when the device is moving [Hz]
+ * @param  SleepOdr accelerometer ODR when the device is still (1.875, 15, 30 or 60 Hz)
+ * @param  Mode gyroscope behavior during inactivity
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Wake_Up_Detection()
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Activity_Power_Manager(LSM6DSV16X_SensorIntPin_t IntPin, float ActiveOdr, float SleepOdr, lsm6dsv16x_act_mode_t Mode)
 {
-  lsm6dsv16x_md1_cfg_t val1;
-  lsm6dsv16x_md2_cfg_t val2;
+  lsm6dsv16x_act_sleep_xl_odr_t new_odr;
+  lsm6dsv16x_act_thresholds_t thresholds;
+  lsm6dsv16x_act_wkup_time_windows_t windows;
+  lsm6dsv16x_wake_up_src_t wake_up_src;
 
-  /* Disable wake up event on both INT1 and INT2 pins */
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
+  new_odr = (SleepOdr <=  1.875f) ? LSM6DSV16X_1Hz875
+            : (SleepOdr <= 15.0f) ? LSM6DSV16X_15Hz
+            : (SleepOdr <= 30.0f) ? LSM6DSV16X_30Hz
+            :                       LSM6DSV16X_60Hz;
+
+  /* Output Data Rate selection */
+  if (Set_X_ODR(ActiveOdr) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_act_sleep_xl_odr_set(&reg_ctx, new_odr) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  val1.int1_wu = PROPERTY_DISABLE;
+  /* Motion above the threshold wakes the device, the inactivity duration puts it to sleep */
+  if (lsm6dsv16x_act_thresholds_get(&reg_ctx, &thresholds) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
+  thresholds.threshold = LSM6DSV16X_ACTIVITY_WAKE_THS;
+
+  if (lsm6dsv16x_act_thresholds_set(&reg_ctx, &thresholds) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
+  if (lsm6dsv16x_act_wkup_time_windows_get(&reg_ctx, &windows) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  val2.int2_wu = PROPERTY_DISABLE;
+  windows.quiet = LSM6DSV16X_ACTIVITY_SLEEP_DUR;
 
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
+  if (lsm6dsv16x_act_wkup_time_windows_set(&reg_ctx, windows) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Reset wake-up threshold */
-  if (Set_Wake_Up_Threshold(0) != LSM6DSV16X_OK) {
+  if (lsm6dsv16x_act_mode_set(&reg_ctx, Mode) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Reset wake-up durantion */
-  if (Set_Wake_Up_Duration(0) != LSM6DSV16X_OK) {
+  /* Enable sleep change event on either INT1 or INT2 pin */
+  if (Hold_Interrupt(IntPin, LSM6DSV16X_INT_SLEEP_CHANGE, 1U) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_WAKE_UP_SRC, (uint8_t *)&wake_up_src, 1) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
+  activity_odr = ActiveOdr;
+  sleep_odr = SleepOdr;
+  activity_mode = Mode;
+  activity_state = LSM6DSV16X_ACTIVITY_STATE;
+  activity_enabled = 1U;
+
+  /* The device may already be still */
+  if (wake_up_src.sleep_state == 1U) {
+    return Service_Activity_Power_Manager();
+  }
+
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Set wake up threshold
- * @param  Threshold wake up detection threshold
+ * @brief  Disable the activity/inactivity power manager and restore the full-rate configuration
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_Wake_Up_Threshold(uint32_t Threshold)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Activity_Power_Manager()
 {
-  lsm6dsv16x_act_thresholds_t wake_up_ths;
+  if (activity_enabled == 0U) {
+    return LSM6DSV16X_OK;
+  }
 
-  if (lsm6dsv16x_act_thresholds_get(&reg_ctx, &wake_up_ths) != LSM6DSV16X_OK) {
+  if (lsm6dsv16x_act_mode_set(&reg_ctx, LSM6DSV16X_XL_AND_GY_NOT_AFFECTED) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  wake_up_ths.threshold = Threshold;
-
-  if (lsm6dsv16x_act_thresholds_set(&reg_ctx, &wake_up_ths) != LSM6DSV16X_OK) {
+  /* Disable sleep change event on INT1 and INT2 pins */
+  if (Release_Interrupt(LSM6DSV16X_INT_SLEEP_CHANGE) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
+  if (activity_state == LSM6DSV16X_INACTIVITY_STATE) {
+    if (Restore_Activity_Rates() != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  activity_state = LSM6DSV16X_ACTIVITY_STATE;
+  activity_enabled = 0U;
+
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Set wake up duration
- * @param  Duration wake up detection duration
+ * @brief  Set the inactivity duration before going to sleep
+ * @param  Duration inactivity duration (1 LSB = 512 / accelerometer ODR, 0 = 16 / ODR)
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_Wake_Up_Duration(uint8_t Duration)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_Sleep_Duration(uint8_t Duration)
 {
   lsm6dsv16x_act_wkup_time_windows_t dur_t;
 
@@ -1387,7 +1863,7 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_Wake_Up_Duration(uint8_t Duration)
     return LSM6DSV16X_ERROR;
   }
 
-  dur_t.shock = Duration;
+  dur_t.quiet = Duration;
 
   if (lsm6dsv16x_act_wkup_time_windows_set(&reg_ctx, dur_t) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
@@ -1396,6 +1872,107 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_Wake_Up_Duration(uint8_t Duration)
   return LSM6DSV16X_OK;
 }
 
+/**
+ * @brief  Set the function called on activity/inactivity transitions
+ * @param  Callback function called with the new state (NULL to remove it)
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_Activity_Callback(LSM6DSV16X_Activity_Callback_t Callback)
+{
+  activity_cb = Callback;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Follow the activity/inactivity state, to be called on the sleep change interrupt
+ * @note   On inactivity the FIFO batches the accelerometer at the sleep ODR and, when the gyroscope sleeps
+ *         or is powered down, stops batching the gyroscope. On activity the ODR and the batch rates in use
+ *         before the inactivity are restored
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Service_Activity_Power_Manager()
+{
+  lsm6dsv16x_wake_up_src_t wake_up_src;
+  LSM6DSV16X_Activity_State_t state;
+
+  if (activity_enabled == 0U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_WAKE_UP_SRC, (uint8_t *)&wake_up_src, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  state = (wake_up_src.sleep_state == 1U) ? LSM6DSV16X_INACTIVITY_STATE : LSM6DSV16X_ACTIVITY_STATE;
+
+  if (state == activity_state) {
+    return LSM6DSV16X_OK;
+  }
+
+  if (state == LSM6DSV16X_INACTIVITY_STATE) {
+    /* Remember the batch rates to restore them on wake-up */
+    if (lsm6dsv16x_fifo_xl_batch_get(&reg_ctx, &activity_xl_bdr) != LSM6DSV16X_OK
+        || lsm6dsv16x_fifo_gy_batch_get(&reg_ctx, &activity_gy_bdr) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+
+    if (activity_xl_bdr != LSM6DSV16X_XL_NOT_BATCHED) {
+      if (FIFO_Set_X_BDR(sleep_odr) != LSM6DSV16X_OK) {
+        return LSM6DSV16X_ERROR;
+      }
+    }
+
+    if (activity_mode == LSM6DSV16X_XL_LOW_POWER_GY_SLEEP || activity_mode == LSM6DSV16X_XL_LOW_POWER_GY_POWER_DOWN) {
+      if (FIFO_Set_G_BDR(0.0f) != LSM6DSV16X_OK) {
+        return LSM6DSV16X_ERROR;
+      }
+    }
+  } else {
+    if (Restore_Activity_Rates() != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  activity_state = state;
+
+  if (activity_cb != NULL) {
+    activity_cb(state);
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Restore the accelerometer ODR and the FIFO batch rates in use before the inactivity
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Restore_Activity_Rates()
+{
+  if (Set_X_ODR(activity_odr) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_fifo_xl_batch_set(&reg_ctx, activity_xl_bdr) != LSM6DSV16X_OK
+      || lsm6dsv16x_fifo_gy_batch_set(&reg_ctx, activity_gy_bdr) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return FIFO_Track_Config();
+}
+
+/**
+ * @brief  Get the last activity/inactivity state seen by the power manager
+ * @param  State pointer where the state is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_Activity_State(LSM6DSV16X_Activity_State_t *State)
+{
+  *State = activity_state;
+
+  return LSM6DSV16X_OK;
+}
+
 /**
  * @brief  Enable single tap detection
  * @param  IntPin interrupt pin line to be used
@@ -1403,11 +1980,6 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_Wake_Up_Duration(uint8_t Duration)
  */
 LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Single_Tap_Detection(LSM6DSV16X_SensorIntPin_t IntPin)
 {
-  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
-  lsm6dsv16x_md1_cfg_t val1;
-  lsm6dsv16x_md2_cfg_t val2;
-  lsm6dsv16x_functions_enable_t functions_enable;
-
   lsm6dsv16x_tap_dur_t tap_dur;
   lsm6dsv16x_tap_cfg0_t tap_cfg0;
   lsm6dsv16x_tap_ths_6d_t tap_ths_6d;
@@ -1462,57 +2034,7 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Single_Tap_Detection(LSM6DSV16X
   }
 
   /* Enable single tap event on either INT1 or INT2 pin */
-  switch (IntPin) {
-    case LSM6DSV16X_INT1_PIN:
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      val1.int1_single_tap = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      functions_enable.interrupts_enable = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-      break;
-
-    case LSM6DSV16X_INT2_PIN:
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      val2.int2_single_tap = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      functions_enable.interrupts_enable = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-      break;
-
-    default:
-      ret = LSM6DSV16X_ERROR;
-      break;
-  }
-
-  return ret;
+  return Hold_Interrupt(IntPin, LSM6DSV16X_INT_SINGLE_TAP, 1U);
 }
 
 /**
@@ -1521,31 +2043,13 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Single_Tap_Detection(LSM6DSV16X
  */
 LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Single_Tap_Detection()
 {
-  lsm6dsv16x_md1_cfg_t val1;
-  lsm6dsv16x_md2_cfg_t val2;
   lsm6dsv16x_tap_dur_t tap_dur;
   lsm6dsv16x_tap_cfg0_t tap_cfg0;
   lsm6dsv16x_tap_ths_6d_t tap_ths_6d;
 
 
   /* Disable single tap event on both INT1 and INT2 pins */
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  val1.int1_single_tap = PROPERTY_DISABLE;
-
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  val2.int2_single_tap = PROPERTY_DISABLE;
-
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
+  if (Release_Interrupt(LSM6DSV16X_INT_SINGLE_TAP) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
@@ -1593,11 +2097,6 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Single_Tap_Detection()
  */
 LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Double_Tap_Detection(LSM6DSV16X_SensorIntPin_t IntPin)
 {
-  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
-  lsm6dsv16x_md1_cfg_t val1;
-  lsm6dsv16x_md2_cfg_t val2;
-  lsm6dsv16x_functions_enable_t functions_enable;
-
   lsm6dsv16x_tap_dur_t tap_dur;
   lsm6dsv16x_tap_cfg0_t tap_cfg0;
   lsm6dsv16x_tap_ths_6d_t tap_ths_6d;
@@ -1654,103 +2153,34 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Double_Tap_Detection(LSM6DSV16X
   }
 
   /* Enable double tap event on either INT1 or INT2 pin */
-  switch (IntPin) {
-    case LSM6DSV16X_INT1_PIN:
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
+  return Hold_Interrupt(IntPin, LSM6DSV16X_INT_DOUBLE_TAP, 1U);
+}
 
-      val1.int1_double_tap = PROPERTY_ENABLE;
+/**
+ * @brief  Disable double tap detection
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Double_Tap_Detection()
+{
+  lsm6dsv16x_tap_dur_t tap_dur;
+  lsm6dsv16x_tap_cfg0_t tap_cfg0;
+  lsm6dsv16x_tap_ths_6d_t tap_ths_6d;
 
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
+  /* Disable double tap event on both INT1 and INT2 pins */
+  if (Release_Interrupt(LSM6DSV16X_INT_DOUBLE_TAP) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
+  /* Disable tap detection on Z-axis. */
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_TAP_CFG0, (uint8_t *)&tap_cfg0, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-      functions_enable.interrupts_enable = PROPERTY_ENABLE;
+  tap_cfg0.tap_z_en = 0x0U;
 
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-      break;
-
-    case LSM6DSV16X_INT2_PIN:
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      val2.int2_double_tap = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      functions_enable.interrupts_enable = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-      break;
-
-    default:
-      ret = LSM6DSV16X_ERROR;
-      break;
-  }
-
-  return ret;
-}
-
-/**
- * @brief  Disable double tap detection
- * @retval 0 in case of success, an error code otherwise
- */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Double_Tap_Detection()
-{
-  lsm6dsv16x_md1_cfg_t val1;
-  lsm6dsv16x_md2_cfg_t val2;
-
-  lsm6dsv16x_tap_dur_t tap_dur;
-  lsm6dsv16x_tap_cfg0_t tap_cfg0;
-  lsm6dsv16x_tap_ths_6d_t tap_ths_6d;
-
-  /* Disable double tap event on both INT1 and INT2 pins */
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  val1.int1_ff = PROPERTY_DISABLE;
-
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  val2.int2_ff = PROPERTY_DISABLE;
-
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  /* Disable tap detection on Z-axis. */
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_TAP_CFG0, (uint8_t *)&tap_cfg0, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  tap_cfg0.tap_z_en = 0x0U;
-
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_TAP_CFG0, (uint8_t *)&tap_cfg0, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_TAP_CFG0, (uint8_t *)&tap_cfg0, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
   /* Reset Z-axis threshold. */
   if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_TAP_THS_6D, (uint8_t *)&tap_ths_6d, 1) != LSM6DSV16X_OK) {
@@ -1882,10 +2312,6 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_Tap_Duration_Time(uint8_t Time)
 LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Pedometer(LSM6DSV16X_SensorIntPin_t IntPin)
 {
   lsm6dsv16x_stpcnt_mode_t mode;
-  lsm6dsv16x_md1_cfg_t val1;
-  lsm6dsv16x_md2_cfg_t val2;
-  lsm6dsv16x_emb_func_int1_t emb_func_int1;
-  lsm6dsv16x_emb_func_int2_t emb_func_int2;
 
   /* Output Data Rate selection */
   if (Set_X_ODR(30) != LSM6DSV16X_OK) {
@@ -1910,80 +2336,8 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Pedometer(LSM6DSV16X_SensorIntP
     return LSM6DSV16X_ERROR;
   }
 
-  /* Enable free fall event on either INT1 or INT2 pin */
-  switch (IntPin) {
-    case LSM6DSV16X_INT1_PIN:
-      /* Enable access to embedded functions registers. */
-      if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_EMBED_FUNC_MEM_BANK) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      /* Step detector interrupt driven to INT1 pin */
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT1, (uint8_t *)&emb_func_int1, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      emb_func_int1.int1_step_detector = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT1, (uint8_t *)&emb_func_int1, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      /* Disable access to embedded functions registers */
-      if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      val1.int1_emb_func = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-      break;
-
-    case LSM6DSV16X_INT2_PIN:
-      /* Enable access to embedded functions registers. */
-      if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_EMBED_FUNC_MEM_BANK) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      /* Step detector interrupt driven to INT1 pin */
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT2, (uint8_t *)&emb_func_int2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      emb_func_int2.int2_step_detector = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT2, (uint8_t *)&emb_func_int2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      /* Disable access to embedded functions registers */
-      if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      val2.int2_emb_func = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-      break;
-
-    default:
-      return LSM6DSV16X_ERROR;
-      break;
-  }
-
-  return LSM6DSV16X_OK;
+  /* Step detector interrupt driven to either INT1 or INT2 pin */
+  return Hold_Interrupt(IntPin, LSM6DSV16X_INT_STEP_DETECTOR, 1U);
 }
 
 
@@ -1993,15 +2347,8 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Pedometer(LSM6DSV16X_SensorIntP
  */
 LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Pedometer()
 {
-  lsm6dsv16x_md1_cfg_t val1;
-  lsm6dsv16x_md2_cfg_t val2;
-
-  lsm6dsv16x_emb_func_int1_t emb_func_int1;
-  lsm6dsv16x_emb_func_int2_t emb_func_int2;
-
   lsm6dsv16x_stpcnt_mode_t mode;
 
-
   if (lsm6dsv16x_stpcnt_mode_get(&reg_ctx, &mode) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
@@ -2015,60 +2362,11 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Pedometer()
     return LSM6DSV16X_ERROR;
   }
 
-  /* Disable emb func event on either INT1 or INT2 pin */
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  val1.int1_emb_func = PROPERTY_DISABLE;
-
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  val2.int2_emb_func = PROPERTY_DISABLE;
-
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  /* Enable access to embedded functions registers. */
-  if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_EMBED_FUNC_MEM_BANK) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  /* Reset interrupt driven to INT1 pin. */
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT1, (uint8_t *)&emb_func_int1, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  emb_func_int1.int1_step_detector = PROPERTY_DISABLE;
-
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT1, (uint8_t *)&emb_func_int1, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  /* Reset interrupt driven to INT2 pin. */
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT2, (uint8_t *)&emb_func_int2, 1) != LSM6DSV16X_OK) {
+  /* Reset interrupt driven to INT1 and INT2 pins */
+  if (Release_Interrupt(LSM6DSV16X_INT_STEP_DETECTOR) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  emb_func_int2.int2_step_detector = PROPERTY_DISABLE;
-
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT2, (uint8_t *)&emb_func_int2, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  /* Disable access to embedded functions registers. */
-  if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-
   return LSM6DSV16X_OK;
 }
 
@@ -2106,12 +2404,7 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Step_Counter_Reset()
  */
 LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Tilt_Detection(LSM6DSV16X_SensorIntPin_t IntPin)
 {
-  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
-  lsm6dsv16x_md1_cfg_t val1;
-  lsm6dsv16x_md2_cfg_t val2;
   lsm6dsv16x_emb_func_en_a_t emb_func_en_a;
-  lsm6dsv16x_emb_func_int1_t emb_func_int1;
-  lsm6dsv16x_emb_func_int2_t emb_func_int2;
 
   /* Output Data Rate selection */
   if (Set_X_ODR(30) != LSM6DSV16X_OK) {
@@ -2123,104 +2416,29 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Tilt_Detection(LSM6DSV16X_Senso
     return LSM6DSV16X_ERROR;
   }
 
-  switch (IntPin) {
-    case LSM6DSV16X_INT1_PIN:
-      /* Enable access to embedded functions registers */
-      if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_EMBED_FUNC_MEM_BANK) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      /* Enable tilt detection */
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      emb_func_en_a.tilt_en = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      /* Tilt interrupt driven to INT1 pin */
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT1, (uint8_t *)&emb_func_int1, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      emb_func_int1.int1_tilt = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT1, (uint8_t *)&emb_func_int1, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      /* Disable access to embedded functions registers */
-      if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      /* Enable routing the embedded functions interrupt */
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      val1.int1_emb_func = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-      break;
-
-
-    case LSM6DSV16X_INT2_PIN:
-      /* Enable access to embedded functions registers */
-      if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_EMBED_FUNC_MEM_BANK) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      /* Enable tilt detection */
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      emb_func_en_a.tilt_en = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      /* Tilt interrupt driven to INT2 pin */
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT2, (uint8_t *)&emb_func_int2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      emb_func_int2.int2_tilt = PROPERTY_ENABLE;
-
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT2, (uint8_t *)&emb_func_int2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-
-      /* Disable access to embedded functions registers */
-      if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
+  /* Enable access to embedded functions registers */
+  if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_EMBED_FUNC_MEM_BANK) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-      /* Enable routing the embedded functions interrupt */
-      if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
+  /* Enable tilt detection */
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-      val2.int2_emb_func = PROPERTY_ENABLE;
+  emb_func_en_a.tilt_en = PROPERTY_ENABLE;
 
-      if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-        return LSM6DSV16X_ERROR;
-      }
-      break;
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-    default:
-      ret = LSM6DSV16X_ERROR;
-      break;
+  /* Disable access to embedded functions registers */
+  if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
   }
 
-  return ret;
+  /* Tilt interrupt driven to either INT1 or INT2 pin */
+  return Hold_Interrupt(IntPin, LSM6DSV16X_INT_TILT, 1U);
 }
 
 /**
@@ -2229,32 +2447,10 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Tilt_Detection(LSM6DSV16X_Senso
  */
 LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Tilt_Detection()
 {
-  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
-  lsm6dsv16x_md1_cfg_t val1;
-  lsm6dsv16x_md2_cfg_t val2;
-
   lsm6dsv16x_emb_func_en_a_t emb_func_en_a;
-  lsm6dsv16x_emb_func_int1_t emb_func_int1;
-  lsm6dsv16x_emb_func_int2_t emb_func_int2;
-
-  /* Disable emb func event on either INT1 or INT2 pin */
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  val1.int1_emb_func = PROPERTY_DISABLE;
-
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD1_CFG, (uint8_t *)&val1, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
 
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  val2.int2_emb_func = PROPERTY_DISABLE;
-
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_MD2_CFG, (uint8_t *)&val2, 1) != LSM6DSV16X_OK) {
+  /* Reset interrupt driven to INT1 and INT2 pins */
+  if (Release_Interrupt(LSM6DSV16X_INT_TILT) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
@@ -2274,34 +2470,59 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Tilt_Detection()
     return LSM6DSV16X_ERROR;
   }
 
-  /* Reset interrupt driven to INT1 pin. */
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT1, (uint8_t *)&emb_func_int1, 1) != LSM6DSV16X_OK) {
+  /* Disable access to embedded functions registers. */
+  if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  emb_func_int1.int1_tilt = PROPERTY_DISABLE;
+  return LSM6DSV16X_OK;
+}
 
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT1, (uint8_t *)&emb_func_int1, 1) != LSM6DSV16X_OK) {
+/**
+ * @brief  Enable significant motion detection
+ * @note   The event is raised by the embedded step detector after a change of location,
+ *         so it stays silent on vibrations and small movements that wake up detection reports
+ * @param  IntPin interrupt pin line to be used
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Significant_Motion(LSM6DSV16X_SensorIntPin_t IntPin)
+{
+  /* Output Data Rate selection */
+  if (Set_X_ODR(30) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Reset interrupt driven to INT2 pin. */
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT2, (uint8_t *)&emb_func_int2, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
+  /* Full scale selection */
+  if (Set_X_FS(2) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* Enable significant motion detection */
+  if (lsm6dsv16x_sigmot_mode_set(&reg_ctx, PROPERTY_ENABLE) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
   }
 
-  emb_func_int2.int2_tilt = PROPERTY_DISABLE;
+  /* Significant motion interrupt driven to either INT1 or INT2 pin */
+  return Hold_Interrupt(IntPin, LSM6DSV16X_INT_SIG_MOT, 1U);
+}
 
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INT2, (uint8_t *)&emb_func_int2, 1) != LSM6DSV16X_OK) {
+/**
+ * @brief  Disable significant motion detection
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Significant_Motion()
+{
+  /* Reset interrupt driven to INT1 and INT2 pins */
+  if (Release_Interrupt(LSM6DSV16X_INT_SIG_MOT) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Disable access to embedded functions registers. */
-  if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK) {
+  /* Disable significant motion detection */
+  if (lsm6dsv16x_sigmot_mode_set(&reg_ctx, PROPERTY_DISABLE) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  return ret;
+  return LSM6DSV16X_OK;
 }
 
 /**
@@ -2312,11 +2533,10 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Tilt_Detection()
   */
 LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Num_Samples(uint16_t *NumSamples)
 {
-  lsm6dsv16x_fifo_status_t status;
-  if (lsm6dsv16x_fifo_status_get(&reg_ctx, &status) != LSM6DSV16X_OK) {
+  lsm6dsv16x_fifo_status2_t status2;
+  if (FIFO_Read_Status(NumSamples, &status2) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
-  *NumSamples = status.fifo_level;
 
   return LSM6DSV16X_OK;
 }
@@ -2330,8 +2550,9 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Num_Samples(uint16_t *NumSamp
 LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Full_Status(uint8_t *Status)
 {
   lsm6dsv16x_fifo_status2_t val;
+  uint16_t level;
 
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FIFO_STATUS2, (uint8_t *)&val, 1) != LSM6DSV16X_OK) {
+  if (FIFO_Read_Status(&level, &val) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
@@ -2348,19 +2569,7 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Full_Status(uint8_t *Status)
   */
 LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Set_INT1_FIFO_Full(uint8_t Status)
 {
-  lsm6dsv16x_int1_ctrl_t reg;
-
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_INT1_CTRL, (uint8_t *)&reg, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  reg.int1_fifo_full = Status;
-
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_INT1_CTRL, (uint8_t *)&reg, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  return LSM6DSV16X_OK;
+  return Hold_Interrupt(LSM6DSV16X_INT1_PIN, LSM6DSV16X_INT_FIFO_FULL, Status);
 }
 
 /**
@@ -2371,21 +2580,101 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Set_INT1_FIFO_Full(uint8_t Status
   */
 LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Set_INT2_FIFO_Full(uint8_t Status)
 {
-  lsm6dsv16x_int2_ctrl_t reg;
+  return Hold_Interrupt(LSM6DSV16X_INT2_PIN, LSM6DSV16X_INT_FIFO_FULL, Status);
+}
+
+/**
+  * @brief  Set the LSM6DSV16X FIFO threshold interrupt on INT1 pin
+  * @note   The pin stays high while the FIFO level is at or above the watermark
+  * @param  Status FIFO threshold interrupt on INT1 pin status
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Set_INT1_FIFO_Threshold(uint8_t Status)
+{
+  return Hold_Interrupt(LSM6DSV16X_INT1_PIN, LSM6DSV16X_INT_FIFO_TH, Status);
+}
+
+/**
+  * @brief  Set the LSM6DSV16X FIFO threshold interrupt on INT2 pin
+  * @note   The pin stays high while the FIFO level is at or above the watermark
+  * @param  Status FIFO threshold interrupt on INT2 pin status
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Set_INT2_FIFO_Threshold(uint8_t Status)
+{
+  return Hold_Interrupt(LSM6DSV16X_INT2_PIN, LSM6DSV16X_INT_FIFO_TH, Status);
+}
+
+/**
+  * @brief  Set the LSM6DSV16X FIFO batch counter, which raises an event every Threshold
+  *         samples of one sensor batched in the FIFO, whatever else is batched
+  * @param  Event sensor whose batched samples are counted (accelerometer or gyroscope)
+  * @param  Threshold samples per event, from 1 to 1023, 0 to disable
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Set_Batch_Counter(lsm6dsv16x_fifo_batch_cnt_event_t Event, uint16_t Threshold)
+{
+  uint8_t buff[2];
+  lsm6dsv16x_counter_bdr_reg1_t reg1;
+
+  if (Threshold > 1023U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  switch (Event) {
+    case LSM6DSV16X_XL_BATCH_EVENT:
+      batch_cnt_tag = 0x02U; /* XL_NC_TAG */
+      break;
+
+    case LSM6DSV16X_GY_BATCH_EVENT:
+      batch_cnt_tag = 0x01U; /* GY_NC_TAG */
+      break;
+
+    default:
+      return LSM6DSV16X_ERROR;
+  }
 
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_INT2_CTRL, (uint8_t *)&reg, 1) != LSM6DSV16X_OK) {
+  /* CNT_BDR_TH[9:8] shares COUNTER_BDR_REG1 with TRIG_COUNTER_BDR, the driver setter overwrites it */
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_COUNTER_BDR_REG1, buff, 1) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  reg.int2_fifo_full = Status;
+  (void)memcpy((void *)&reg1, &buff[0], 1);
+  reg1.trig_counter_bdr = (uint8_t)Event;
+  reg1.cnt_bdr_th = (uint8_t)(Threshold >> 8);
+  (void)memcpy(&buff[0], (void *)&reg1, 1);
+  buff[1] = (uint8_t)(Threshold & 0xFFU);
 
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_INT2_CTRL, (uint8_t *)&reg, 1) != LSM6DSV16X_OK) {
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_COUNTER_BDR_REG1, buff, 2) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
+  batch_cnt_threshold = Threshold;
+  batch_cnt_counted = 0U;
+
   return LSM6DSV16X_OK;
 }
 
+/**
+  * @brief  Set the LSM6DSV16X FIFO batch counter interrupt on INT1 pin
+  * @param  Status FIFO batch counter interrupt on INT1 pin status
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Set_INT1_Batch_Counter(uint8_t Status)
+{
+  return Hold_Interrupt(LSM6DSV16X_INT1_PIN, LSM6DSV16X_INT_CNT_BDR, Status);
+}
+
+/**
+  * @brief  Set the LSM6DSV16X FIFO batch counter interrupt on INT2 pin
+  * @param  Status FIFO batch counter interrupt on INT2 pin status
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Set_INT2_Batch_Counter(uint8_t Status)
+{
+  return Hold_Interrupt(LSM6DSV16X_INT2_PIN, LSM6DSV16X_INT_CNT_BDR, Status);
+}
+
 /**
   * @brief  Set the LSM6DSV16X FIFO watermark level
 
@@ -2451,6 +2740,13 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Set_Mode(uint8_t Mode)
     return LSM6DSV16X_ERROR;
   }
 
+  /* Bypass mode flushes the FIFO, the tag counter and timestamp sequence restart */
+  fifo_last_cnt = 0xFFU;
+  fifo_ts_valid = 0U;
+  if (newMode == LSM6DSV16X_BYPASS_MODE) {
+    cfg_decode = cfg_latest;
+  }
+
   return ret;
 }
 
@@ -2470,6 +2766,8 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Tag(uint8_t *Tag)
 
   *Tag = (uint8_t)tag_local.tag_sensor;
 
+  FIFO_Track_Word(*Tag);
+
   return LSM6DSV16X_OK;
 }
 
@@ -2499,12 +2797,12 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_X_Axes(int32_t *Acceleration)
     return LSM6DSV16X_ERROR;
   }
 
-  if (Get_X_Sensitivity(&sensitivity) != LSM6DSV16X_OK) {
+  if (FIFO_Sensitivity(cfg_decode, 0, &sensitivity) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
-  acceleration_float[0] = (float)data_raw.i16bit[0] * sensitivity;
-  acceleration_float[1] = (float)data_raw.i16bit[1] * sensitivity;
-  acceleration_float[2] = (float)data_raw.i16bit[2] * sensitivity;
+  acceleration_float[0] = ((float)data_raw.i16bit[0] * sensitivity - thermal_xl_offset[0]) * thermal_xl_gain[0];
+  acceleration_float[1] = ((float)data_raw.i16bit[1] * sensitivity - thermal_xl_offset[1]) * thermal_xl_gain[1];
+  acceleration_float[2] = ((float)data_raw.i16bit[2] * sensitivity - thermal_xl_offset[2]) * thermal_xl_gain[2];
 
   Acceleration[0] = (int32_t)acceleration_float[0];
   Acceleration[1]  = (int32_t)acceleration_float[1];
@@ -2538,7 +2836,11 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Set_X_BDR(float Bdr)
             : (Bdr <= 3840.0f) ? LSM6DSV16X_XL_BATCHED_AT_3840Hz
             :                    LSM6DSV16X_XL_BATCHED_AT_7680Hz;
 
-  return (LSM6DSV16XStatusTypeDef) lsm6dsv16x_fifo_xl_batch_set(&reg_ctx, new_bdr);
+  if (lsm6dsv16x_fifo_xl_batch_set(&reg_ctx, new_bdr) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return FIFO_Track_Config();
 }
 
 /**
@@ -2557,13 +2859,13 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_G_Axes(int32_t *AngularVeloci
     return LSM6DSV16X_ERROR;
   }
 
-  if (Get_G_Sensitivity(&sensitivity) != LSM6DSV16X_OK) {
+  if (FIFO_Sensitivity(cfg_decode, 1, &sensitivity) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  angular_velocity_float[0] = (float)data_raw.i16bit[0] * sensitivity;
-  angular_velocity_float[1] = (float)data_raw.i16bit[1] * sensitivity;
-  angular_velocity_float[2] = (float)data_raw.i16bit[2] * sensitivity;
+  angular_velocity_float[0] = ((float)data_raw.i16bit[0] * sensitivity - thermal_g_offset[0]) * thermal_g_gain[0];
+  angular_velocity_float[1] = ((float)data_raw.i16bit[1] * sensitivity - thermal_g_offset[1]) * thermal_g_gain[1];
+  angular_velocity_float[2] = ((float)data_raw.i16bit[2] * sensitivity - thermal_g_offset[2]) * thermal_g_gain[2];
 
   AngularVelocity[0] = (int32_t)angular_velocity_float[0];
   AngularVelocity[1] = (int32_t)angular_velocity_float[1];
@@ -2596,625 +2898,3432 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Set_G_BDR(float Bdr)
             : (Bdr <= 3840.0f) ? LSM6DSV16X_GY_BATCHED_AT_3840Hz
             :                    LSM6DSV16X_GY_BATCHED_AT_7680Hz;
 
-  return (LSM6DSV16XStatusTypeDef) lsm6dsv16x_fifo_gy_batch_set(&reg_ctx, new_bdr);
+  if (lsm6dsv16x_fifo_gy_batch_set(&reg_ctx, new_bdr) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return FIFO_Track_Config();
 }
 
 /**
- * @brief  Enable the LSM6DSV16X gyroscope sensor
- * @retval 0 in case of success, an error code otherwise
- */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_G()
+  * @brief  Set the LSM6DSV16X FIFO temperature BDR value
+  * @note   The temperature words also update the thermal compensation when read with FIFO_Get_Words
+  * @param  Bdr FIFO temperature BDR value (1.875, 15 or 60 Hz, 0 to disable)
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Set_Temperature_BDR(float Bdr)
 {
-  /* Check if the component is already enabled */
-  if (gyro_is_enabled == 1U) {
-    return LSM6DSV16X_OK;
-  }
+  lsm6dsv16x_fifo_temp_batch_t new_bdr;
 
-  /* Output data rate selection. */
-  if (lsm6dsv16x_gy_data_rate_set(&reg_ctx, gyro_odr) != LSM6DSV16X_OK) {
+  new_bdr = (Bdr <=  0.0f) ? LSM6DSV16X_TEMP_NOT_BATCHED
+            : (Bdr <=  1.9f) ? LSM6DSV16X_TEMP_BATCHED_AT_1Hz875
+            : (Bdr <= 15.0f) ? LSM6DSV16X_TEMP_BATCHED_AT_15Hz
+            :                  LSM6DSV16X_TEMP_BATCHED_AT_60Hz;
+
+  if (lsm6dsv16x_fifo_temp_batch_set(&reg_ctx, new_bdr) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  gyro_is_enabled = 1U;
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Enable the batching of the accelerometer 16 g channel in the FIFO
+  * @note   The LSM6DSV16X batches the second channel (XL_DUAL_CORE tag) only while a finite
+  *         state machine program requests it, e.g. during an impact, at the accelerometer rate
+  * @param  Status FIFO batching of the 16 g channel status
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Set_X_Dual_Batch(uint8_t Status)
+{
+  if (lsm6dsv16x_fifo_xl_dual_fsm_batch_set(&reg_ctx, (Status != 0U) ? PROPERTY_ENABLE : PROPERTY_DISABLE) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Disable the LSM6DSV16X gyroscope sensor
- * @retval 0 in case of success, an error code otherwise
- */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_G()
+  * @brief  Drain the LSM6DSV16X FIFO with burst reads
+  * @param  Words array where the FIFO words (tag, counter and data) are written
+  * @param  MaxWords size of the Words array
+  * @param  NumWords pointer where the number of words read is written
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Words(LSM6DSV16X_FIFO_Word_t *Words, uint16_t MaxWords, uint16_t *NumWords)
 {
-  /* Check if the component is already disabled */
-  if (gyro_is_enabled == 0U) {
-    return LSM6DSV16X_OK;
+  lsm6dsv16x_fifo_status2_t status2;
+  uint16_t level;
+  uint32_t lost = 0;
+  uint16_t count;
+  uint16_t done = 0;
+  uint16_t chunk;
+
+#if LSM6DSV16X_LATENCY_TRACE
+  uint32_t irq_us;
+  uint8_t pending;
+  uint32_t bus_start_us;
+  uint32_t bus_end_us;
+
+  noInterrupts();
+  irq_us = irq_time_us;
+  pending = irq_pending;
+  irq_pending = 0;
+  interrupts();
+
+  bus_start_us = micros();
+  if (pending != 0U) {
+    Latency_Record(LSM6DSV16X_LATENCY_IRQ_TO_BUS, bus_start_us - irq_us);
   }
+#endif
 
-  /* Get current output data rate. */
-  if (lsm6dsv16x_gy_data_rate_get(&reg_ctx, &gyro_odr) != LSM6DSV16X_OK) {
+  *NumWords = 0;
+
+  if (FIFO_Read_Status(&level, &status2) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Output data rate selection - power down. */
-  if (lsm6dsv16x_gy_data_rate_set(&reg_ctx, LSM6DSV16X_ODR_OFF) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
+  count = (level < MaxWords) ? level : MaxWords;
+
+  /* The FIFO output address rolls back to FIFO_DATA_OUT_TAG, so several words can be read in one burst */
+  while (done < count) {
+    chunk = count - done;
+    if (chunk > fifo_burst_words) {
+      chunk = fifo_burst_words;
+    }
+
+    if (FIFO_Read_Burst(&Words[done], chunk, &lost) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+
+    done += chunk;
   }
 
-  gyro_is_enabled = 0U;
+  *NumWords = count;
+  FIFO_Account_Drain(count, lost);
+
+#if LSM6DSV16X_LATENCY_TRACE
+  bus_end_us = micros();
+  Latency_Record(LSM6DSV16X_LATENCY_BUS_TRANSFER, bus_end_us - bus_start_us);
+  if (pending != 0U) {
+    Latency_Record(LSM6DSV16X_LATENCY_IRQ_TO_READ_END, bus_end_us - irq_us);
+  }
+#endif
 
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Get the LSM6DSV16X gyroscope sensor sensitivity
- * @param  Sensitivity pointer
- * @retval 0 in case of success, an error code otherwise
- */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_G_Sensitivity(float *Sensitivity)
+  * @brief  Drain one batch counter frame from the LSM6DSV16X FIFO: the words up to the
+  *         Threshold-th sample of the counted sensor, with the words interleaved with them
+  * @note   Call it once per batch counter event. The read never goes past the end of the
+  *         frame; a frame cut by MaxWords or by a short FIFO continues in the next call.
+  * @param  Words array where the FIFO words are written
+  * @param  MaxWords size of the Words array
+  * @param  NumWords pointer where the number of words read is written
+  * @param  Complete pointer where 1 is written when the last word of the frame was read
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Batch_Frame(LSM6DSV16X_FIFO_Word_t *Words, uint16_t MaxWords, uint16_t *NumWords, uint8_t *Complete)
 {
-  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
-  lsm6dsv16x_gy_full_scale_t full_scale;
+  lsm6dsv16x_fifo_status2_t status2;
+  uint16_t level;
+  uint32_t lost = 0;
+  uint16_t count;
+  uint16_t done = 0;
+  uint16_t chunk;
 
-  /* Read actual full scale selection from sensor. */
-  if (lsm6dsv16x_gy_full_scale_get(&reg_ctx, &full_scale) != LSM6DSV16X_OK) {
+  *NumWords = 0;
+  *Complete = 0;
+
+  if (batch_cnt_threshold == 0U) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Store the sensitivity based on actual full scale. */
-  switch (full_scale) {
-    case LSM6DSV16X_125dps:
-      *Sensitivity = LSM6DSV16X_GYRO_SENSITIVITY_FS_125DPS;
-      break;
+  if (FIFO_Read_Status(&level, &status2) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-    case LSM6DSV16X_250dps:
-      *Sensitivity = LSM6DSV16X_GYRO_SENSITIVITY_FS_250DPS;
-      break;
+  count = (level < MaxWords) ? level : MaxWords;
 
-    case LSM6DSV16X_500dps:
-      *Sensitivity = LSM6DSV16X_GYRO_SENSITIVITY_FS_500DPS;
-      break;
+  while (done < count && batch_cnt_counted < batch_cnt_threshold) {
+    /* Each counted sample still missing takes at least one word, so a burst this long cannot overshoot */
+    chunk = count - done;
+    if (chunk > fifo_burst_words) {
+      chunk = fifo_burst_words;
+    }
+    if (chunk > batch_cnt_threshold - batch_cnt_counted) {
+      chunk = batch_cnt_threshold - batch_cnt_counted;
+    }
 
-    case LSM6DSV16X_1000dps:
-      *Sensitivity = LSM6DSV16X_GYRO_SENSITIVITY_FS_1000DPS;
-      break;
+    if (FIFO_Read_Burst(&Words[done], chunk, &lost) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
 
-    case LSM6DSV16X_2000dps:
-      *Sensitivity = LSM6DSV16X_GYRO_SENSITIVITY_FS_2000DPS;
-      break;
+    for (uint16_t i = 0; i < chunk; i++) {
+      if (Words[done + i].Tag == batch_cnt_tag) {
+        batch_cnt_counted++;
+      }
+    }
 
-    case LSM6DSV16X_4000dps:
-      *Sensitivity = LSM6DSV16X_GYRO_SENSITIVITY_FS_4000DPS;
-      break;
+    done += chunk;
+  }
 
-    default:
-      ret = LSM6DSV16X_ERROR;
-      break;
+  *NumWords = done;
+  FIFO_Account_Drain(done, lost);
+
+  if (batch_cnt_counted >= batch_cnt_threshold) {
+    batch_cnt_counted = 0U;
+    *Complete = 1;
   }
 
-  return ret;
+  return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Get the LSM6DSV16X gyroscope sensor output data rate
- * @param  Odr pointer where the output data rate is written
- * @retval 0 in case of success, an error code otherwise
- */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_G_ODR(float *Odr)
+  * @brief  Decode the accelerometer axes of a FIFO word read with FIFO_Get_Words
+  * @param  Word pointer to the FIFO word (accelerometer tag)
+  * @param  Acceleration pointer where the values of the axes are written [mg]
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Decode_X_Axes(const LSM6DSV16X_FIFO_Word_t *Word, float *Acceleration)
 {
-  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
-  lsm6dsv16x_data_rate_t odr_low_level;
+  float sensitivity;
 
-  /* Get current output data rate. */
-  if (lsm6dsv16x_gy_data_rate_get(&reg_ctx, &odr_low_level) != LSM6DSV16X_OK) {
+  if (Word->Tag != 0x02U) { /* XL_NC_TAG */
     return LSM6DSV16X_ERROR;
   }
 
-  switch (odr_low_level) {
-    case LSM6DSV16X_ODR_OFF:
-      *Odr = 0.0f;
-      break;
+  if (FIFO_Sensitivity(Word->Cfg, 0, &sensitivity) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-    case LSM6DSV16X_ODR_AT_7Hz5:
-      *Odr = 7.5f;
-      break;
+  Acceleration[0] = ((float)(int16_t)((uint16_t)Word->Data[1] << 8 | Word->Data[0]) * sensitivity - thermal_xl_offset[0]) * thermal_xl_gain[0];
+  Acceleration[1] = ((float)(int16_t)((uint16_t)Word->Data[3] << 8 | Word->Data[2]) * sensitivity - thermal_xl_offset[1]) * thermal_xl_gain[1];
+  Acceleration[2] = ((float)(int16_t)((uint16_t)Word->Data[5] << 8 | Word->Data[4]) * sensitivity - thermal_xl_offset[2]) * thermal_xl_gain[2];
 
-    case LSM6DSV16X_ODR_AT_15Hz:
-      *Odr = 15.0f;
-      break;
+  return LSM6DSV16X_OK;
+}
 
-    case LSM6DSV16X_ODR_AT_30Hz:
-      *Odr = 30.0f;
-      break;
+/**
+  * @brief  Decode the gyroscope axes of a FIFO word read with FIFO_Get_Words
+  * @param  Word pointer to the FIFO word (gyroscope tag)
+  * @param  AngularRate pointer where the values of the axes are written [mdps]
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Decode_G_Axes(const LSM6DSV16X_FIFO_Word_t *Word, float *AngularRate)
+{
+  float sensitivity;
 
-    case LSM6DSV16X_ODR_AT_60Hz:
-      *Odr = 60.0f;
-      break;
+  if (Word->Tag != 0x01U) { /* GY_NC_TAG */
+    return LSM6DSV16X_ERROR;
+  }
 
-    case LSM6DSV16X_ODR_AT_120Hz:
-      *Odr = 120.0f;
-      break;
+  if (FIFO_Sensitivity(Word->Cfg, 1, &sensitivity) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-    case LSM6DSV16X_ODR_AT_240Hz:
-      *Odr = 240.0f;
-      break;
+  AngularRate[0] = ((float)(int16_t)((uint16_t)Word->Data[1] << 8 | Word->Data[0]) * sensitivity - thermal_g_offset[0]) * thermal_g_gain[0];
+  AngularRate[1] = ((float)(int16_t)((uint16_t)Word->Data[3] << 8 | Word->Data[2]) * sensitivity - thermal_g_offset[1]) * thermal_g_gain[1];
+  AngularRate[2] = ((float)(int16_t)((uint16_t)Word->Data[5] << 8 | Word->Data[4]) * sensitivity - thermal_g_offset[2]) * thermal_g_gain[2];
 
-    case LSM6DSV16X_ODR_AT_480Hz:
-      *Odr = 480.0f;
-      break;
+  return LSM6DSV16X_OK;
+}
 
-    case LSM6DSV16X_ODR_AT_960Hz:
-      *Odr = 960.0f;
-      break;
+/**
+  * @brief  Decode the temperature of a FIFO word read with FIFO_Get_Words
+  * @param  Word pointer to the FIFO word (temperature tag)
+  * @param  Temperature pointer where the temperature is written [degC]
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Decode_Temperature(const LSM6DSV16X_FIFO_Word_t *Word, float *Temperature)
+{
+  if (Word->Tag != 0x03U) { /* TEMPERATURE_TAG */
+    return LSM6DSV16X_ERROR;
+  }
 
-    case LSM6DSV16X_ODR_AT_1920Hz:
-      *Odr = 1920.0f;
-      break;
+  *Temperature = lsm6dsv16x_from_lsb_to_celsius((int16_t)((uint16_t)Word->Data[1] << 8 | Word->Data[0]));
 
-    case LSM6DSV16X_ODR_AT_3840Hz:
-      *Odr = 3840.0f;
-      break;
+  return LSM6DSV16X_OK;
+}
 
-    case LSM6DSV16X_ODR_AT_7680Hz:
-      *Odr = 7680.0f;
-      break;
+/**
+  * @brief  Decode the accelerometer 16 g channel of a FIFO word read with FIFO_Get_Words
+  * @param  Word pointer to the FIFO word (XL_DUAL_CORE tag)
+  * @param  Acceleration pointer where the values of the axes are written [mg]
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Decode_X_Dual_Axes(const LSM6DSV16X_FIFO_Word_t *Word, float *Acceleration)
+{
+  if (Word->Tag != 0x1DU) { /* XL_DUAL_CORE */
+    return LSM6DSV16X_ERROR;
+  }
 
-    default:
-      ret = LSM6DSV16X_ERROR;
-      break;
+  for (uint8_t i = 0U; i < 3U; i++) {
+    Acceleration[i] = ((float)(int16_t)((uint16_t)Word->Data[2U * i + 1U] << 8 | Word->Data[2U * i]) * LSM6DSV16X_XL_DUAL_SENSITIVITY
+                       - thermal_xl_offset[i]) * thermal_xl_gain[i];
   }
 
-  return ret;
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Merge the two accelerometer channels of a block of FIFO words in a single stream
+  * @note   One sample is written for each accelerometer word. The axes of a sample close to
+  *         saturation are replaced with the 16 g channel word of the same time slot, when it
+  *         has been batched (see FIFO_Set_X_Dual_Batch). The two words are paired only when
+  *         no tag counter change separates them. A gap of a multiple of 4 time slots, which
+  *         only an overrun can cause, keeps the counter: discard the blocks for which
+  *         FIFO_Get_Words accounted lost samples (see FIFO_Set_Loss_Callback).
+  * @param  Words pointer to the FIFO words read with FIFO_Get_Words
+  * @param  NumWords number of FIFO words
+  * @param  Acceleration array where the samples are written, 3 values per sample [mg]
+  * @param  MaxSamples max number of samples written
+  * @param  NumSamples pointer where the number of samples written is written
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Decode_X_HDR(const LSM6DSV16X_FIFO_Word_t *Words, uint16_t NumWords, float *Acceleration, uint16_t MaxSamples, uint16_t *NumSamples)
+{
+  int16_t raw1[3];
+  int16_t raw2[3];
+  uint8_t slot = 0xFFU; /* Tag counter of the current time slot */
+  uint8_t has1 = 0U;    /* Sample of the time slot not merged yet */
+  uint8_t has2 = 0U;    /* 16 g word of the time slot not merged yet */
+  uint16_t n = 0U;
+
+  for (uint16_t i = 0U; i < NumWords; i++) {
+    const LSM6DSV16X_FIFO_Word_t *word = &Words[i];
+
+    /* The words of a time slot are contiguous, a new slot drops the unpaired ones */
+    if (word->Cnt != slot) {
+      slot = word->Cnt;
+      has1 = 0U;
+      has2 = 0U;
+    }
+
+    if (word->Tag == 0x02U) { /* XL_NC_TAG */
+      if (n == MaxSamples) {
+        break;
+      }
+      if (FIFO_Decode_X_Axes(word, &Acceleration[3U * n]) != LSM6DSV16X_OK) {
+        return LSM6DSV16X_ERROR;
+      }
+      for (uint8_t j = 0U; j < 3U; j++) {
+        raw1[j] = (int16_t)((uint16_t)word->Data[2U * j + 1U] << 8 | word->Data[2U * j]);
+      }
+      n++;
+      has1 = 1U;
+    } else if (word->Tag == 0x1DU) { /* XL_DUAL_CORE */
+      for (uint8_t j = 0U; j < 3U; j++) {
+        raw2[j] = (int16_t)((uint16_t)word->Data[2U * j + 1U] << 8 | word->Data[2U * j]);
+      }
+      has2 = 1U;
+    } else {
+      continue;
+    }
+
+    /* The two words of a time slot can come in any order */
+    if (has1 != 0U && has2 != 0U) {
+      FIFO_Merge_X_HDR(&Acceleration[3U * (n - 1U)], raw1, raw2);
+      has1 = 0U;
+      has2 = 0U;
+    }
+  }
+
+  *NumSamples = n;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Replace the axes of a sample close to saturation with the 16 g channel
+  * @param  Acceleration pointer to the decoded sample [mg]
+  * @param  Channel1 raw values of the selected full scale channel
+  * @param  Channel2 raw values of the 16 g channel
+  * @retval None
+  */
+void LSM6DSV16XSensor::FIFO_Merge_X_HDR(float *Acceleration, const int16_t *Channel1, const int16_t *Channel2)
+{
+  for (uint8_t i = 0U; i < 3U; i++) {
+    if (Channel1[i] >= LSM6DSV16X_XL_HDR_SWITCH_LSB || Channel1[i] <= -LSM6DSV16X_XL_HDR_SWITCH_LSB) {
+      Acceleration[i] = ((float)Channel2[i] * LSM6DSV16X_XL_DUAL_SENSITIVITY - thermal_xl_offset[i]) * thermal_xl_gain[i];
+    }
+  }
+}
+
+/**
+  * @brief  Convert the FIFO samples with the configuration they were produced with
+  * @note   The library keeps the configurations written while streaming with the FIFO
+  *         level at the time of the change. The LSM6DSV16X batches a CFG_CHANGE word when
+  *         the ODR, the batch rate or the full scale changes: at each CFG_CHANGE word the
+  *         decoder moves to the last configuration written before that word, so a setter
+  *         producing several CFG_CHANGE words or none (e.g. a change while the sensor is
+  *         off) does not shift the following configurations.
+  *         At most LSM6DSV16X_FIFO_CFG_EPOCHS configurations are kept: with more changes
+  *         between two reads the oldest words are converted with a newer configuration,
+  *         counted in LSM6DSV16X_FIFO_Stats_t::DroppedConfigs.
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Enable_Config_Tracking()
+{
+  if (lsm6dsv16x_fifo_virtual_sens_odr_chg_set(&reg_ctx, PROPERTY_ENABLE) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  cfg_track = 1U;
+  cfg_decode = 0U;
+  cfg_latest = 0U;
+  cfg_words = 0U;
+  (void)memset((void *)cfg_regs, 0xFF, sizeof(cfg_regs));
+
+  return FIFO_Track_Config();
+}
+
+/**
+  * @brief  Stop batching CFG_CHANGE words, the FIFO samples are converted with the
+  *         current configuration
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Disable_Config_Tracking()
+{
+  if (lsm6dsv16x_fifo_virtual_sens_odr_chg_set(&reg_ctx, PROPERTY_DISABLE) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  cfg_track = 0U;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Get the sensitivities of the FIFO samples produced with a configuration
+  * @param  Cfg configuration of the samples (LSM6DSV16X_FIFO_Word_t::Cfg)
+  * @param  AccSensitivity pointer where the accelerometer sensitivity is written [mg/LSB]
+  * @param  GyroSensitivity pointer where the gyroscope sensitivity is written [mdps/LSB]
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Config_Sensitivity(uint8_t Cfg, float *AccSensitivity, float *GyroSensitivity)
+{
+  if (FIFO_Sensitivity(Cfg, 0, AccSensitivity) != LSM6DSV16X_OK
+      || FIFO_Sensitivity(Cfg, 1, GyroSensitivity) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Record the configuration after a setter, when it changes what the FIFO tags
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Track_Config()
+{
+  uint8_t fifo_ctrl3;
+  uint8_t ctrl[8];
+  uint8_t regs[5];
+  uint8_t slot;
+  uint16_t level = 0U;
+  lsm6dsv16x_fifo_status2_t status2;
+
+  if (cfg_track == 0U) {
+    return LSM6DSV16X_OK;
+  }
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FIFO_CTRL3, &fifo_ctrl3, 1) != LSM6DSV16X_OK
+      || lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_CTRL1, ctrl, 8) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  regs[0] = fifo_ctrl3;        /* BDR_XL, BDR_GY */
+  regs[1] = ctrl[0] & 0x0FU;   /* CTRL1.ODR_XL */
+  regs[2] = ctrl[1] & 0x0FU;   /* CTRL2.ODR_G */
+  regs[3] = ctrl[5] & 0x0FU;   /* CTRL6.FS_G */
+  regs[4] = ctrl[7] & 0x03U;   /* CTRL8.FS_XL */
+
+  if (memcmp(regs, cfg_regs, sizeof(regs)) == 0) {
+    return LSM6DSV16X_OK;
+  }
+
+  /* The first configuration is the one of the words already in the FIFO */
+  if (cfg_regs[0] != 0xFFU) {
+    /* The words already in the FIFO were produced with the previous configuration */
+    if (FIFO_Read_Status(&level, &status2) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+    cfg_latest++;
+    if ((uint8_t)(cfg_latest - cfg_decode) >= LSM6DSV16X_FIFO_CFG_EPOCHS) {
+      cfg_decode = (uint8_t)(cfg_latest - LSM6DSV16X_FIFO_CFG_EPOCHS + 1U);
+      fifo_stats.DroppedConfigs++;
+    }
+  }
+  (void)memcpy(cfg_regs, regs, sizeof(regs));
+
+  slot = cfg_latest % LSM6DSV16X_FIFO_CFG_EPOCHS;
+  cfg_start[slot] = cfg_words + level;
+  if (Get_X_Sensitivity(&cfg_xl_sens[slot]) != LSM6DSV16X_OK
+      || Get_G_Sensitivity(&cfg_g_sens[slot]) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Select the configuration of the FIFO words from a word read
+  * @param  Tag tag of the word read
+  * @retval None
+  */
+void LSM6DSV16XSensor::FIFO_Track_Word(uint8_t Tag)
+{
+  uint8_t next;
+
+  /* A CFG_CHANGE word follows every configuration written before it was batched */
+  if (Tag == 0x05U) { /* CFG_CHANGE_TAG */
+    while (cfg_decode != cfg_latest) {
+      next = (uint8_t)(cfg_decode + 1U) % LSM6DSV16X_FIFO_CFG_EPOCHS;
+      if ((int32_t)(cfg_words - cfg_start[next]) < 0) {
+        break;
+      }
+      cfg_decode++;
+    }
+  }
+
+  cfg_words++;
+}
+
+/**
+  * @brief  Get the sensitivity to convert a FIFO sample
+  * @param  Cfg configuration the sample was produced with, ignored when not tracked
+  * @param  Gyro 1 for the gyroscope, 0 for the accelerometer
+  * @param  Sensitivity pointer where the sensitivity is written
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Sensitivity(uint8_t Cfg, uint8_t Gyro, float *Sensitivity)
+{
+  if (cfg_track != 0U) {
+    *Sensitivity = (Gyro != 0U) ? cfg_g_sens[Cfg % LSM6DSV16X_FIFO_CFG_EPOCHS] : cfg_xl_sens[Cfg % LSM6DSV16X_FIFO_CFG_EPOCHS];
+    return LSM6DSV16X_OK;
+  }
+
+  if (Gyro != 0U) {
+    if (gyro_sensitivity == 0.0f && Get_G_Sensitivity(&gyro_sensitivity) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+    *Sensitivity = gyro_sensitivity;
+  } else {
+    if (acc_sensitivity == 0.0f && Get_X_Sensitivity(&acc_sensitivity) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+    *Sensitivity = acc_sensitivity;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Get the LSM6DSV16X FIFO level and overrun flag with a single read
+  * @param  Level pointer where the number of unread words is written
+  * @param  Overrun pointer where 1 is written if samples were lost since the last read
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Status(uint16_t *Level, uint8_t *Overrun)
+{
+  lsm6dsv16x_fifo_status2_t status2;
+
+  if (FIFO_Read_Status(Level, &status2) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  *Overrun = status2.fifo_ovr_ia | status2.fifo_ovr_latched;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Get FIFO_STATUS1 and FIFO_STATUS2 with a single read
+  * @note   The read clears the latched overrun flag, which is counted in the FIFO loss
+  *         accounting (see FIFO_Get_Stats) before being returned
+  * @param  Status array where FIFO_STATUS1 and FIFO_STATUS2 are written
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Status_Regs(uint8_t *Status)
+{
+  lsm6dsv16x_fifo_status2_t status2;
+  uint16_t level;
+
+  if (FIFO_Read_Status(&level, &status2) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  Status[0] = (uint8_t)(level & 0xFFU);
+  (void)memcpy(&Status[1], (void *)&status2, 1);
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Set the LSM6DSV16X FIFO timestamp batching
+  * @param  Decimation one timestamp word every 1, 8 or 32 batched samples, 0 to disable
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Set_Timestamp_Batch(uint8_t Decimation)
+{
+  lsm6dsv16x_fifo_timestamp_batch_t batch;
+
+  switch (Decimation) {
+    case 0:
+      batch = LSM6DSV16X_TMSTMP_NOT_BATCHED;
+      break;
+
+    case 1:
+      batch = LSM6DSV16X_TMSTMP_DEC_1;
+      break;
+
+    case 8:
+      batch = LSM6DSV16X_TMSTMP_DEC_8;
+      break;
+
+    case 32:
+      batch = LSM6DSV16X_TMSTMP_DEC_32;
+      break;
+
+    default:
+      return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_fifo_timestamp_batch_set(&reg_ctx, batch) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Decode the timestamp of a FIFO word read with FIFO_Get_Words
+  * @param  Word pointer to the FIFO word (timestamp tag)
+  * @param  Timestamp pointer where the timestamp is written [LSB, 21.75 us typ.]
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Decode_Timestamp(const LSM6DSV16X_FIFO_Word_t *Word, uint32_t *Timestamp)
+{
+  if (Word->Tag != 0x04U) { /* TIMESTAMP_TAG */
+    return LSM6DSV16X_ERROR;
+  }
+
+  *Timestamp = (uint32_t)Word->Data[0]
+               | (uint32_t)Word->Data[1] << 8
+               | (uint32_t)Word->Data[2] << 16
+               | (uint32_t)Word->Data[3] << 24;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Get the LSM6DSV16X FIFO loss counters
+  * @note   Levels and flags are sampled on every FIFO status read of the library,
+  *         samples lost are estimated on the words read with FIFO_Get_Words
+  * @param  Stats pointer where the counters are written
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Stats(LSM6DSV16X_FIFO_Stats_t *Stats)
+{
+  *Stats = fifo_stats;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Reset the LSM6DSV16X FIFO loss counters
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Reset_Stats()
+{
+  (void)memset((void *)&fifo_stats, 0x0, sizeof(LSM6DSV16X_FIFO_Stats_t));
+  fifo_wtm_armed = 1U;
+  fifo_full_armed = 1U;
+  fifo_last_cnt = 0xFFU;
+  fifo_ovr_seen = 0U;
+  fifo_slots = 0U;
+  fifo_ts_valid = 0U;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Set the function called when the FIFO loses samples
+  * @note   Called from the FIFO read that detects an overrun (Lost is 0) or estimates
+  *         the number of time slots lost
+  * @param  Callback function to call, NULL to disable
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Set_Loss_Callback(LSM6DSV16X_FIFO_Loss_Callback_t Callback)
+{
+  fifo_loss_cb = Callback;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Read FIFO_STATUS1 and FIFO_STATUS2 with a single burst and update the loss counters
+  * @param  Level pointer where the number of unread words is written
+  * @param  Status2 pointer where FIFO_STATUS2 is written
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Read_Status(uint16_t *Level, lsm6dsv16x_fifo_status2_t *Status2)
+{
+  uint8_t buff[2];
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FIFO_STATUS1, buff, 2) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  (void)memcpy((void *)Status2, &buff[1], 1);
+  *Level = ((uint16_t)Status2->diff_fifo * 256U) + buff[0];
+  FIFO_Account_Status(*Level, Status2);
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Update the loss counters with a FIFO status read
+  * @note   The latched overrun flag is cleared by the read, so each overrun is counted once
+  * @param  Level number of unread words
+  * @param  Status2 value of FIFO_STATUS2
+  * @retval None
+  */
+void LSM6DSV16XSensor::FIFO_Account_Status(uint16_t Level, const lsm6dsv16x_fifo_status2_t *Status2)
+{
+  if (Level > fifo_stats.MaxLevel) {
+    fifo_stats.MaxLevel = Level;
+  }
+
+  if (Status2->fifo_wtm_ia != 0U) {
+    if (fifo_wtm_armed != 0U) {
+      fifo_stats.WatermarkHits++;
+      fifo_wtm_armed = 0U;
+    }
+  } else {
+    fifo_wtm_armed = 1U;
+  }
+
+  if (Status2->fifo_full_ia != 0U) {
+    if (fifo_full_armed != 0U) {
+      fifo_stats.FullHits++;
+      fifo_full_armed = 0U;
+    }
+  } else {
+    fifo_full_armed = 1U;
+  }
+
+  if (Status2->fifo_ovr_latched != 0U) {
+    fifo_stats.Overruns++;
+    fifo_ovr_seen = 1U;
+    if (fifo_loss_cb != NULL) {
+      fifo_loss_cb(0, &fifo_stats);
+    }
+  }
+}
+
+/**
+  * @brief  Estimate the time slots lost before a FIFO word
+  * @note   The 2-bit tag counter shows gaps of up to 3 slots. When timestamps are batched,
+  *         the time between two timestamp words across an overrun gives the rest, using
+  *         the slot duration measured on the intervals without loss.
+  * @param  Word pointer to the FIFO word, in read order
+  * @retval Number of time slots lost
+  */
+uint32_t LSM6DSV16XSensor::FIFO_Account_Word(const LSM6DSV16X_FIFO_Word_t *Word)
+{
+  uint32_t lost = 0;
+  uint32_t timestamp;
+
+  if (fifo_last_cnt != 0xFFU) {
+    uint8_t step = (uint8_t)((Word->Cnt - fifo_last_cnt) & 0x03U);
+
+    if (step > 1U) {
+      lost += step - 1U;
+    }
+    fifo_slots += step;
+  }
+  fifo_last_cnt = Word->Cnt;
+
+  if (Word->Tag != 0x04U) { /* TIMESTAMP_TAG */
+    return lost;
+  }
+
+  timestamp = (uint32_t)Word->Data[0] | ((uint32_t)Word->Data[1] << 8)
+              | ((uint32_t)Word->Data[2] << 16) | ((uint32_t)Word->Data[3] << 24);
+
+  if (fifo_ts_valid != 0U && fifo_slots > 0U) {
+    float ticks = (float)(timestamp - fifo_last_ts);
+
+    if (fifo_ovr_seen == 0U) {
+      fifo_slot_ticks = ticks / (float)fifo_slots;
+    } else if (fifo_slot_ticks > 0.0f) {
+      uint32_t elapsed = (uint32_t)(ticks / fifo_slot_ticks + 0.5f);
+
+      /* Multiples of 4 slots are invisible to the tag counter */
+      if (elapsed > fifo_slots) {
+        lost += elapsed - fifo_slots;
+      }
+    }
+  }
+
+  fifo_last_ts = timestamp;
+  fifo_ts_valid = 1U;
+  fifo_slots = 0U;
+  fifo_ovr_seen = 0U;
+
+  return lost;
+}
+
+/**
+  * @brief  Read and decode FIFO words with a single burst, the output address rolls back
+  *         to FIFO_DATA_OUT_TAG after each word
+  * @param  Words array where the FIFO words are written
+  * @param  Count number of words to read, at most fifo_burst_words
+  * @param  Lost pointer where the estimated time slots lost are accumulated
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Read_Burst(LSM6DSV16X_FIFO_Word_t *Words, uint16_t Count, uint32_t *Lost)
+{
+  uint8_t buff[LSM6DSV16X_FIFO_BURST_WORDS * LSM6DSV16X_FIFO_WORD_SIZE];
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FIFO_DATA_OUT_TAG, buff, Count * LSM6DSV16X_FIFO_WORD_SIZE) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  for (uint16_t i = 0; i < Count; i++) {
+    uint8_t *word = &buff[i * LSM6DSV16X_FIFO_WORD_SIZE];
+
+    Words[i].Tag = word[0] >> 3;
+    Words[i].Cnt = (word[0] >> 1) & 0x03U;
+    (void)memcpy(Words[i].Data, &word[1], 6);
+    *Lost += FIFO_Account_Word(&Words[i]);
+    FIFO_Track_Word(Words[i].Tag);
+    Words[i].Cfg = cfg_decode;
+    if (Words[i].Tag == 0x03U) { /* TEMPERATURE_TAG */
+      Thermal_Update(lsm6dsv16x_from_lsb_to_celsius((int16_t)((uint16_t)word[2] << 8 | word[1])));
+    }
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Update the loss counters at the end of a drain
+  * @param  Count number of words read
+  * @param  Lost estimated time slots lost
+  * @retval None
+  */
+void LSM6DSV16XSensor::FIFO_Account_Drain(uint16_t Count, uint32_t Lost)
+{
+  fifo_stats.Words += Count;
+  if (Count > 0U) {
+    /* Draining re-arms the hit counters even if the level never dropped between two reads */
+    fifo_wtm_armed = 1U;
+    fifo_full_armed = 1U;
+  }
+  if (Lost > 0U) {
+    fifo_stats.LostSamples += Lost;
+    if (fifo_loss_cb != NULL) {
+      fifo_loss_cb(Lost, &fifo_stats);
+    }
+  }
+}
+
+/**
+  * @brief  Arm an event-triggered FIFO capture
+  * @note   The trigger event is enabled and routed on IntPin as done by the related Enable_* function,
+  *         the batched sensors are selected with FIFO_Set_X_BDR and FIFO_Set_G_BDR. The FIFO mode,
+  *         watermark and stop on watermark setting are restored by FIFO_Disarm_Capture
+  * @param  Trigger event that switches the FIFO to FIFO mode
+  * @param  IntPin interrupt pin where the trigger event is routed
+  * @param  Window capture samples before (pre-trigger) or after (post-trigger) the event
+  * @param  Depth capture depth in FIFO words (0 to use the whole FIFO)
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Arm_Capture(LSM6DSV16X_Capture_Trigger_t Trigger, LSM6DSV16X_SensorIntPin_t IntPin, LSM6DSV16X_Capture_Window_t Window, uint8_t Depth)
+{
+  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
+  lsm6dsv16x_interrupt_mode_t irq;
+
+  switch (Window) {
+    case LSM6DSV16X_CAPTURE_PRE_TRIGGER:
+      capture_mode = LSM6DSV16X_STREAM_TO_FIFO_MODE;
+      break;
+
+    case LSM6DSV16X_CAPTURE_POST_TRIGGER:
+      capture_mode = LSM6DSV16X_BYPASS_TO_FIFO_MODE;
+      break;
+
+    default:
+      return LSM6DSV16X_ERROR;
+  }
+
+  if (capture_armed != 0U) {
+    if (FIFO_Disarm_Capture() != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  if (lsm6dsv16x_fifo_mode_get(&reg_ctx, &capture_saved_mode) != LSM6DSV16X_OK
+      || lsm6dsv16x_fifo_watermark_get(&reg_ctx, &capture_saved_wtm) != LSM6DSV16X_OK
+      || lsm6dsv16x_fifo_stop_on_wtm_get(&reg_ctx, &capture_saved_stop) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* Flush the FIFO */
+  if (lsm6dsv16x_fifo_mode_set(&reg_ctx, LSM6DSV16X_BYPASS_MODE) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  switch (Trigger) {
+    case LSM6DSV16X_CAPTURE_WAKE_UP:
+      ret = Enable_Wake_Up_Detection(IntPin);
+      break;
+
+    case LSM6DSV16X_CAPTURE_SINGLE_TAP:
+      ret = Enable_Single_Tap_Detection(IntPin);
+      break;
+
+    case LSM6DSV16X_CAPTURE_DOUBLE_TAP:
+      ret = Enable_Double_Tap_Detection(IntPin);
+      break;
+
+    case LSM6DSV16X_CAPTURE_FREE_FALL:
+      ret = Enable_Free_Fall_Detection(IntPin);
+      break;
+
+    case LSM6DSV16X_CAPTURE_6D_ORIENTATION:
+      ret = Enable_6D_Orientation(IntPin);
+      break;
+
+    default:
+      ret = LSM6DSV16X_ERROR;
+      break;
+  }
+
+  if (ret != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* Latch the event so that it is not missed between two status polls */
+  if (lsm6dsv16x_interrupt_enable_get(&reg_ctx, &irq) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  capture_lir = irq.lir;
+  irq.lir = PROPERTY_ENABLE;
+
+  if (lsm6dsv16x_interrupt_enable_set(&reg_ctx, irq) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* Limit the FIFO depth to the capture window */
+  if (lsm6dsv16x_fifo_watermark_set(&reg_ctx, Depth) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_fifo_stop_on_wtm_set(&reg_ctx, (Depth != 0U) ? PROPERTY_ENABLE : PROPERTY_DISABLE) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  capture_trigger = Trigger;
+  capture_depth = Depth;
+  capture_triggered = 0U;
+  capture_armed = 1U;
+
+  if (lsm6dsv16x_fifo_mode_set(&reg_ctx, capture_mode) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Disarm the event-triggered FIFO capture, disable the trigger event and flush the FIFO
+  * @note   The FIFO mode, watermark and stop on watermark setting in use before FIFO_Arm_Capture are restored
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Disarm_Capture()
+{
+  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
+  lsm6dsv16x_interrupt_mode_t irq;
+
+  if (capture_armed == 0U) {
+    return LSM6DSV16X_OK;
+  }
+
+  if (FIFO_Set_Mode(LSM6DSV16X_BYPASS_MODE) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  switch (capture_trigger) {
+    case LSM6DSV16X_CAPTURE_WAKE_UP:
+      ret = Disable_Wake_Up_Detection();
+      break;
+
+    case LSM6DSV16X_CAPTURE_SINGLE_TAP:
+      ret = Disable_Single_Tap_Detection();
+      break;
+
+    case LSM6DSV16X_CAPTURE_DOUBLE_TAP:
+      ret = Disable_Double_Tap_Detection();
+      break;
+
+    case LSM6DSV16X_CAPTURE_FREE_FALL:
+      ret = Disable_Free_Fall_Detection();
+      break;
+
+    case LSM6DSV16X_CAPTURE_6D_ORIENTATION:
+      ret = Disable_6D_Orientation();
+      break;
+
+    default:
+      ret = LSM6DSV16X_ERROR;
+      break;
+  }
+
+  if (ret != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_interrupt_enable_get(&reg_ctx, &irq) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  irq.lir = capture_lir;
+
+  if (lsm6dsv16x_interrupt_enable_set(&reg_ctx, irq) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_fifo_watermark_set(&reg_ctx, capture_saved_wtm) != LSM6DSV16X_OK
+      || lsm6dsv16x_fifo_stop_on_wtm_set(&reg_ctx, capture_saved_stop) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  capture_armed = 0U;
+  capture_triggered = 0U;
+
+  if (capture_saved_mode != LSM6DSV16X_BYPASS_MODE) {
+    if (FIFO_Set_Mode((uint8_t)capture_saved_mode) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Get the event-triggered FIFO capture status
+  * @param  Status 1 when the capture window is complete and can be read, 0 otherwise
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Capture_Status(uint8_t *Status)
+{
+  uint8_t buff[3];
+  lsm6dsv16x_fifo_status2_t fifo_status2;
+  lsm6dsv16x_all_int_src_t all_int_src;
+  uint16_t level;
+  uint8_t event = 0;
+
+  *Status = 0;
+
+  if (capture_armed == 0U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* FIFO_STATUS1, FIFO_STATUS2 and ALL_INT_SRC in a single burst (reading ALL_INT_SRC clears the latch) */
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FIFO_STATUS1, buff, 3) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  (void)memcpy((void *)&fifo_status2, &buff[1], 1);
+  (void)memcpy((void *)&all_int_src, &buff[2], 1);
+  level = ((uint16_t)fifo_status2.diff_fifo * 256U) + buff[0];
+  FIFO_Account_Status(level, &fifo_status2);
+
+  switch (capture_trigger) {
+    case LSM6DSV16X_CAPTURE_WAKE_UP:
+      event = all_int_src.wu_ia;
+      break;
+
+    case LSM6DSV16X_CAPTURE_SINGLE_TAP:
+    case LSM6DSV16X_CAPTURE_DOUBLE_TAP:
+      event = all_int_src.tap_ia;
+      break;
+
+    case LSM6DSV16X_CAPTURE_FREE_FALL:
+      event = all_int_src.ff_ia;
+      break;
+
+    case LSM6DSV16X_CAPTURE_6D_ORIENTATION:
+      event = all_int_src.d6d_ia;
+      break;
+
+    default:
+      return LSM6DSV16X_ERROR;
+  }
+
+  if (event != 0U) {
+    capture_triggered = 1U;
+  }
+
+  if (capture_triggered == 0U) {
+    return LSM6DSV16X_OK;
+  }
+
+  /* After the event both windows keep filling in FIFO mode until the FIFO is full or reaches the depth */
+  if (fifo_status2.fifo_full_ia != 0U || (capture_depth != 0U && level >= capture_depth)) {
+    *Status = 1;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Drain a completed FIFO capture and re-arm it for the next event
+  * @param  Words array where the captured FIFO words are written
+  * @param  MaxWords size of the Words array
+  * @param  NumWords pointer where the number of words read is written
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Read_Capture(LSM6DSV16X_FIFO_Word_t *Words, uint16_t MaxWords, uint16_t *NumWords)
+{
+  if (capture_armed == 0U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (FIFO_Get_Words(Words, MaxWords, NumWords) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* Flush what did not fit in Words and re-arm the trigger */
+  if (lsm6dsv16x_fifo_mode_set(&reg_ctx, LSM6DSV16X_BYPASS_MODE) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  capture_triggered = 0U;
+
+  if (lsm6dsv16x_fifo_mode_set(&reg_ctx, capture_mode) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Enable the LSM6DSV16X gyroscope sensor
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_G()
+{
+  /* Check if the component is already enabled */
+  if (gyro_is_enabled == 1U) {
+    return LSM6DSV16X_OK;
+  }
+
+  /* Output data rate selection. */
+  if (lsm6dsv16x_gy_data_rate_set(&reg_ctx, gyro_odr) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  gyro_is_enabled = 1U;
+
+  return FIFO_Track_Config();
+}
+
+/**
+ * @brief  Disable the LSM6DSV16X gyroscope sensor
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_G()
+{
+  /* Check if the component is already disabled */
+  if (gyro_is_enabled == 0U) {
+    return LSM6DSV16X_OK;
+  }
+
+  /* Get current output data rate. */
+  if (lsm6dsv16x_gy_data_rate_get(&reg_ctx, &gyro_odr) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* Output data rate selection - power down. */
+  if (lsm6dsv16x_gy_data_rate_set(&reg_ctx, LSM6DSV16X_ODR_OFF) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  gyro_is_enabled = 0U;
+
+  return FIFO_Track_Config();
+}
+
+/**
+ * @brief  Get the LSM6DSV16X gyroscope sensor sensitivity
+ * @param  Sensitivity pointer
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_G_Sensitivity(float *Sensitivity)
+{
+  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
+  lsm6dsv16x_gy_full_scale_t full_scale;
+
+  /* Read actual full scale selection from sensor. */
+  if (lsm6dsv16x_gy_full_scale_get(&reg_ctx, &full_scale) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* Store the sensitivity based on actual full scale. */
+  switch (full_scale) {
+    case LSM6DSV16X_125dps:
+      *Sensitivity = LSM6DSV16X_GYRO_SENSITIVITY_FS_125DPS;
+      break;
+
+    case LSM6DSV16X_250dps:
+      *Sensitivity = LSM6DSV16X_GYRO_SENSITIVITY_FS_250DPS;
+      break;
+
+    case LSM6DSV16X_500dps:
+      *Sensitivity = LSM6DSV16X_GYRO_SENSITIVITY_FS_500DPS;
+      break;
+
+    case LSM6DSV16X_1000dps:
+      *Sensitivity = LSM6DSV16X_GYRO_SENSITIVITY_FS_1000DPS;
+      break;
+
+    case LSM6DSV16X_2000dps:
+      *Sensitivity = LSM6DSV16X_GYRO_SENSITIVITY_FS_2000DPS;
+      break;
+
+    case LSM6DSV16X_4000dps:
+      *Sensitivity = LSM6DSV16X_GYRO_SENSITIVITY_FS_4000DPS;
+      break;
+
+    default:
+      ret = LSM6DSV16X_ERROR;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+ * @brief  Get the LSM6DSV16X gyroscope sensor output data rate
+ * @param  Odr pointer where the output data rate is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_G_ODR(float *Odr)
+{
+  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
+  lsm6dsv16x_data_rate_t odr_low_level;
+
+  /* Get current output data rate. */
+  if (lsm6dsv16x_gy_data_rate_get(&reg_ctx, &odr_low_level) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  switch (odr_low_level) {
+    case LSM6DSV16X_ODR_OFF:
+      *Odr = 0.0f;
+      break;
+
+    case LSM6DSV16X_ODR_AT_7Hz5:
+      *Odr = 7.5f;
+      break;
+
+    case LSM6DSV16X_ODR_AT_15Hz:
+      *Odr = 15.0f;
+      break;
+
+    case LSM6DSV16X_ODR_AT_30Hz:
+      *Odr = 30.0f;
+      break;
+
+    case LSM6DSV16X_ODR_AT_60Hz:
+      *Odr = 60.0f;
+      break;
+
+    case LSM6DSV16X_ODR_AT_120Hz:
+      *Odr = 120.0f;
+      break;
+
+    case LSM6DSV16X_ODR_AT_240Hz:
+      *Odr = 240.0f;
+      break;
+
+    case LSM6DSV16X_ODR_AT_480Hz:
+      *Odr = 480.0f;
+      break;
+
+    case LSM6DSV16X_ODR_AT_960Hz:
+      *Odr = 960.0f;
+      break;
+
+    case LSM6DSV16X_ODR_AT_1920Hz:
+      *Odr = 1920.0f;
+      break;
+
+    case LSM6DSV16X_ODR_AT_3840Hz:
+      *Odr = 3840.0f;
+      break;
+
+    case LSM6DSV16X_ODR_AT_7680Hz:
+      *Odr = 7680.0f;
+      break;
+
+    default:
+      ret = LSM6DSV16X_ERROR;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+ * @brief  Set the LSM6DSV16X gyroscope sensor output data rate with operating mode
+ * @param  Odr the output data rate value to be set
+ * @param  Mode the gyroscope operating mode
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_G_ODR(float Odr, LSM6DSV16X_GYRO_Operating_Mode_t Mode)
+{
+  switch (Mode) {
+    case LSM6DSV16X_GYRO_HIGH_PERFORMANCE_MODE: {
+        if (lsm6dsv16x_gy_mode_set(&reg_ctx, LSM6DSV16X_GY_HIGH_PERFORMANCE_MD) != LSM6DSV16X_OK) {
+          return LSM6DSV16X_ERROR;
+        }
+
+        /* Valid ODR: 7.5Hz <= Odr <= 7.68kHz */
+        Odr = (Odr <    7.5f) ?    7.5f
+              : (Odr > 7680.0f) ? 7680.0f
+              :                       Odr;
+        break;
+      }
+
+    case LSM6DSV16X_GYRO_HIGH_ACCURACY_MODE:
+      // TODO: Not implemented.
+      // NOTE: According to datasheet, section `6.5 High-accuracy ODR mode`:
+      // "... the other sensor also has to be configured in high-accuracy ODR (HAODR) mode."
+      return LSM6DSV16X_ERROR;
+
+    case LSM6DSV16X_GYRO_SLEEP_MODE:
+      // TODO: Not implemented.
+      // NOTE: Unknown ODR validity for this mode
+      return LSM6DSV16X_ERROR;
+
+    case LSM6DSV16X_GYRO_LOW_POWER_MODE: {
+        if (lsm6dsv16x_gy_mode_set(&reg_ctx, LSM6DSV16X_GY_LOW_POWER_MD) != LSM6DSV16X_OK) {
+          return LSM6DSV16X_ERROR;
+        }
+
+        /* Valid ODR: 7.5Hz <= Odr <= 240kHz */
+        Odr = (Odr <   7.5f) ?   7.5f
+              : (Odr > 240.0f) ? 240.0f
+              :                     Odr;
+        break;
+      }
+
+    default:
+      return LSM6DSV16X_ERROR;
+  }
+
+  if (gyro_is_enabled == 1U) {
+    if (Set_G_ODR_When_Enabled(Odr) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  } else {
+    if (Set_G_ODR_When_Disabled(Odr) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  return FIFO_Track_Config();
+}
+
+/**
+ * @brief  Set the LSM6DSV16X gyroscope sensor output data rate when enabled
+ * @param  Odr the functional output data rate to be set
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_G_ODR_When_Enabled(float Odr)
+{
+  lsm6dsv16x_data_rate_t new_odr;
+
+  new_odr = (Odr <=    7.5f) ? LSM6DSV16X_ODR_AT_7Hz5
+            : (Odr <=   15.0f) ? LSM6DSV16X_ODR_AT_15Hz
+            : (Odr <=   30.0f) ? LSM6DSV16X_ODR_AT_30Hz
+            : (Odr <=   60.0f) ? LSM6DSV16X_ODR_AT_60Hz
+            : (Odr <=  120.0f) ? LSM6DSV16X_ODR_AT_120Hz
+            : (Odr <=  240.0f) ? LSM6DSV16X_ODR_AT_240Hz
+            : (Odr <=  480.0f) ? LSM6DSV16X_ODR_AT_480Hz
+            : (Odr <=  960.0f) ? LSM6DSV16X_ODR_AT_960Hz
+            : (Odr <= 1920.0f) ? LSM6DSV16X_ODR_AT_1920Hz
+            : (Odr <= 3840.0f) ? LSM6DSV16X_ODR_AT_3840Hz
+            :                    LSM6DSV16X_ODR_AT_7680Hz;
+
+  /* Output data rate selection. */
+  if (lsm6dsv16x_gy_data_rate_set(&reg_ctx, new_odr) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Set the LSM6DSV16X gyroscope sensor output data rate when disabled
+ * @param  Odr the functional output data rate to be set
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_G_ODR_When_Disabled(float Odr)
+{
+  gyro_odr = (Odr <=    7.5f) ? LSM6DSV16X_ODR_AT_7Hz5
+             : (Odr <=   15.0f) ? LSM6DSV16X_ODR_AT_15Hz
+             : (Odr <=   30.0f) ? LSM6DSV16X_ODR_AT_30Hz
+             : (Odr <=   60.0f) ? LSM6DSV16X_ODR_AT_60Hz
+             : (Odr <=  120.0f) ? LSM6DSV16X_ODR_AT_120Hz
+             : (Odr <=  240.0f) ? LSM6DSV16X_ODR_AT_240Hz
+             : (Odr <=  480.0f) ? LSM6DSV16X_ODR_AT_480Hz
+             : (Odr <=  960.0f) ? LSM6DSV16X_ODR_AT_960Hz
+             : (Odr <= 1920.0f) ? LSM6DSV16X_ODR_AT_1920Hz
+             : (Odr <= 3840.0f) ? LSM6DSV16X_ODR_AT_3840Hz
+             :                    LSM6DSV16X_ODR_AT_7680Hz;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the LSM6DSV16X gyroscope sensor full scale
+ * @param  FullScale pointer where the full scale is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_G_FS(int32_t  *FullScale)
+{
+  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
+  lsm6dsv16x_gy_full_scale_t fs_low_level;
+
+  /* Read actual full scale selection from sensor. */
+  if (lsm6dsv16x_gy_full_scale_get(&reg_ctx, &fs_low_level) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  switch (fs_low_level) {
+    case LSM6DSV16X_125dps:
+      *FullScale =  125;
+      break;
+
+    case LSM6DSV16X_250dps:
+      *FullScale =  250;
+      break;
+
+    case LSM6DSV16X_500dps:
+      *FullScale =  500;
+      break;
+
+    case LSM6DSV16X_1000dps:
+      *FullScale = 1000;
+      break;
+
+    case LSM6DSV16X_2000dps:
+      *FullScale = 2000;
+      break;
+
+    case LSM6DSV16X_4000dps:
+      *FullScale = 4000;
+      break;
+
+    default:
+      ret = LSM6DSV16X_ERROR;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+ * @brief  Set the LSM6DSV16X gyroscope sensor full scale
+ * @param  FullScale the functional full scale to be set
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_G_FS(int32_t FullScale)
+{
+  lsm6dsv16x_gy_full_scale_t new_fs;
+
+  new_fs = (FullScale <= 125)  ? LSM6DSV16X_125dps
+           : (FullScale <= 250)  ? LSM6DSV16X_250dps
+           : (FullScale <= 500)  ? LSM6DSV16X_500dps
+           : (FullScale <= 1000) ? LSM6DSV16X_1000dps
+           : (FullScale <= 2000) ? LSM6DSV16X_2000dps
+           :                       LSM6DSV16X_4000dps;
+
+  /* Invalidate the cached sensitivity */
+  gyro_sensitivity = 0.0f;
+
+  if (lsm6dsv16x_gy_full_scale_set(&reg_ctx, new_fs) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return FIFO_Track_Config();
+}
+
+/**
+ * @brief  Get the LSM6DSV16X gyroscope sensor raw axes
+ * @param  Value pointer where the raw values of the axes are written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_G_AxesRaw(int16_t *Value)
+{
+  lsm6dsv16x_axis3bit16_t data_raw;
+
+  /* Read raw data values. */
+  if (lsm6dsv16x_angular_rate_raw_get(&reg_ctx, data_raw.i16bit) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* Format the data. */
+  Value[0] = data_raw.i16bit[0];
+  Value[1] = data_raw.i16bit[1];
+  Value[2] = data_raw.i16bit[2];
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the LSM6DSV16X gyroscope sensor axes
+ * @param  AngularRate pointer where the values of the axes are written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_G_Axes(int32_t *AngularRate)
+{
+  lsm6dsv16x_axis3bit16_t data_raw;
+  float sensitivity;
+
+  /* Read raw data values. */
+  if (lsm6dsv16x_angular_rate_raw_get(&reg_ctx, data_raw.i16bit) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* Get LSM6DSV16X actual sensitivity. */
+  if (Get_G_Sensitivity(&sensitivity) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* Calculate the data. */
+  AngularRate[0] = (int32_t)((float)((float)data_raw.i16bit[0] * sensitivity));
+  AngularRate[1] = (int32_t)((float)((float)data_raw.i16bit[1] * sensitivity));
+  AngularRate[2] = (int32_t)((float)((float)data_raw.i16bit[2] * sensitivity));
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the LSM6DSV16X gyroscope and accelerometer raw axes with a single burst read
+ * @param  AngularRate pointer where the raw values of the gyroscope axes are written
+ * @param  Acceleration pointer where the raw values of the accelerometer axes are written
+ * @param  Temperature pointer where the raw temperature is written (NULL to skip it)
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_XG_AxesRaw(int16_t *AngularRate, int16_t *Acceleration, int16_t *Temperature)
+{
+  uint8_t buff[14];
+  uint8_t *data = &buff[2];
+  uint8_t i;
+
+  /* OUT_TEMP_L, OUTX_L_G ... OUTZ_H_A are contiguous: one burst reads both sensors under BDU. */
+  if (Temperature != NULL) {
+    if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_OUT_TEMP_L, buff, 14) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+    *Temperature = (int16_t)buff[1];
+    *Temperature = (*Temperature * 256) + (int16_t)buff[0];
+  } else {
+    if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_OUTX_L_G, data, 12) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  for (i = 0; i < 3U; i++) {
+    AngularRate[i] = (int16_t)data[(2 * i) + 1];
+    AngularRate[i] = (AngularRate[i] * 256) + (int16_t)data[2 * i];
+    Acceleration[i] = (int16_t)data[(2 * i) + 7];
+    Acceleration[i] = (Acceleration[i] * 256) + (int16_t)data[(2 * i) + 6];
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the LSM6DSV16X gyroscope and accelerometer axes with a single burst read
+ * @param  AngularRate pointer where the values of the gyroscope axes are written [mdps]
+ * @param  Acceleration pointer where the values of the accelerometer axes are written [mg]
+ * @param  Temperature pointer where the temperature is written [degC] (NULL to skip it)
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_XG_Axes(int32_t *AngularRate, int32_t *Acceleration, float *Temperature)
+{
+  int16_t gyro_raw[3];
+  int16_t acc_raw[3];
+  int16_t temp_raw = 0;
+
+  if (Get_XG_AxesRaw(gyro_raw, acc_raw, (Temperature != NULL) ? &temp_raw : NULL) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* The sensitivities are cached, the full scale registers are only read after a change. */
+  if (acc_sensitivity == 0.0f) {
+    if (Get_X_Sensitivity(&acc_sensitivity) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  if (gyro_sensitivity == 0.0f) {
+    if (Get_G_Sensitivity(&gyro_sensitivity) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  /* Calculate the data. */
+  AngularRate[0] = (int32_t)((float)gyro_raw[0] * gyro_sensitivity);
+  AngularRate[1] = (int32_t)((float)gyro_raw[1] * gyro_sensitivity);
+  AngularRate[2] = (int32_t)((float)gyro_raw[2] * gyro_sensitivity);
+  Acceleration[0] = (int32_t)((float)acc_raw[0] * acc_sensitivity);
+  Acceleration[1] = (int32_t)((float)acc_raw[1] * acc_sensitivity);
+  Acceleration[2] = (int32_t)((float)acc_raw[2] * acc_sensitivity);
+
+  if (Temperature != NULL) {
+    *Temperature = lsm6dsv16x_from_lsb_to_celsius(temp_raw);
+    Thermal_Update(*Temperature);
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the LSM6DSV16X temperature raw data
+ * @note   The temperature sensor runs only while the accelerometer or the gyroscope is enabled
+ * @param  Value pointer where the raw value is written [LSB]
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_Temperature_Raw(int16_t *Value)
+{
+  if (lsm6dsv16x_temperature_raw_get(&reg_ctx, Value) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the LSM6DSV16X temperature, which also updates the thermal compensation
+ * @param  Temperature pointer where the temperature is written [degC]
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_Temperature(float *Temperature)
+{
+  int16_t raw;
+
+  if (Get_Temperature_Raw(&raw) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  *Temperature = lsm6dsv16x_from_lsb_to_celsius(raw);
+  Thermal_Update(*Temperature);
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Correct the FIFO samples for the drift of each axis with the temperature
+ * @note   The samples are converted at the last temperature read, from a temperature word
+ *         of FIFO_Get_Words (see FIFO_Set_Temperature_BDR) or with Get_Temperature.
+ *         The current temperature is read here. The model is rejected if its sensitivity
+ *         drift can reach LSM6DSV16X_THERMAL_MAX_DRIFT in the operating range.
+ * @param  Model pointer to the drift model
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Thermal_Compensation(const LSM6DSV16X_Thermal_Model_t *Model)
+{
+  float temperature;
+
+  if (Check_Thermal_Model(Model) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  thermal_model = *Model;
+  thermal_enabled = 1U;
+
+  return Get_Temperature(&temperature);
+}
+
+/**
+ * @brief  Stop correcting the FIFO samples for the temperature
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Thermal_Compensation()
+{
+  thermal_enabled = 0U;
+  Thermal_Update(0.0f);
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Compute the offset and gain of each axis at a new temperature
+ * @param  Temperature temperature [degC]
+ * @retval None
+ */
+void LSM6DSV16XSensor::Thermal_Update(float Temperature)
+{
+  Get_Thermal_Correction((thermal_enabled != 0U) ? &thermal_model : NULL, Temperature,
+                         thermal_xl_offset, thermal_xl_gain, thermal_g_offset, thermal_g_gain);
+}
+
+/**
+ * @brief  Check that a drift model keeps the sensitivity drift bounded over the operating range
+ * @note   The sensitivity drift is linear, so it is checked at both ends of the range
+ *         and the compensation gain 1 / (1 + drift) never divides by zero
+ * @param  Model pointer to the drift model
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Check_Thermal_Model(const LSM6DSV16X_Thermal_Model_t *Model)
+{
+  const float low = LSM6DSV16X_THERMAL_MIN_C - Model->Reference;
+  const float high = LSM6DSV16X_THERMAL_MAX_C - Model->Reference;
+  float drift;
+
+  for (uint8_t i = 0U; i < 6U; i++) {
+    drift = (i < 3U) ? Model->XLSensitivity[i] : Model->GSensitivity[i - 3U];
+    /* Written so that NaN values are rejected too */
+    if (!(drift * low < LSM6DSV16X_THERMAL_MAX_DRIFT && drift * low > -LSM6DSV16X_THERMAL_MAX_DRIFT
+          && drift * high < LSM6DSV16X_THERMAL_MAX_DRIFT && drift * high > -LSM6DSV16X_THERMAL_MAX_DRIFT)) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Compute the offset and gain of each axis at a temperature,
+ *         value = (raw * sensitivity - offset) * gain
+ * @note   The temperature is clamped to the operating range checked by Check_Thermal_Model.
+ *         The divisions run once per temperature update, not once per sample.
+ * @param  Model pointer to the drift model, NULL for no correction
+ * @param  Temperature temperature [degC]
+ * @param  XLOffset pointer where the accelerometer offsets are written [mg]
+ * @param  XLGain pointer where the accelerometer gains are written
+ * @param  GOffset pointer where the gyroscope offsets are written [mdps]
+ * @param  GGain pointer where the gyroscope gains are written
+ * @retval None
+ */
+void LSM6DSV16XSensor::Get_Thermal_Correction(const LSM6DSV16X_Thermal_Model_t *Model, float Temperature, float XLOffset[3], float XLGain[3], float GOffset[3], float GGain[3])
+{
+  float delta;
+
+  if (Model == NULL) {
+    for (uint8_t i = 0U; i < 3U; i++) {
+      XLOffset[i] = 0.0f;
+      XLGain[i] = 1.0f;
+      GOffset[i] = 0.0f;
+      GGain[i] = 1.0f;
+    }
+    return;
+  }
+
+  Temperature = (Temperature < LSM6DSV16X_THERMAL_MIN_C) ? LSM6DSV16X_THERMAL_MIN_C
+                : (Temperature > LSM6DSV16X_THERMAL_MAX_C) ? LSM6DSV16X_THERMAL_MAX_C
+                : Temperature;
+  delta = Temperature - Model->Reference;
+  for (uint8_t i = 0U; i < 3U; i++) {
+    XLOffset[i] = Model->XLOffset[i] * delta;
+    XLGain[i] = 1.0f / (1.0f + Model->XLSensitivity[i] * delta);
+    GOffset[i] = Model->GOffset[i] * delta;
+    GGain[i] = 1.0f / (1.0f + Model->GSensitivity[i] * delta);
+  }
+}
+
+/**
+ * @brief  Get the LSM6DSV16X GYRO data ready bit value
+ * @param  Status the status of data ready bit
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_G_DRDY_Status(uint8_t *Status)
+{
+  lsm6dsv16x_all_sources_t val;
+
+  if (lsm6dsv16x_all_sources_get(&reg_ctx, &val) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  *Status = val.drdy_gy;
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Set the LSM6DSV16X gyroscope power mode
+ * @param  PowerMode Value of the powerMode
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_G_Power_Mode(uint8_t PowerMode)
+{
+  if (lsm6dsv16x_gy_mode_set(&reg_ctx, (lsm6dsv16x_gy_mode_t)PowerMode) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Set the LSM6DSV16X gyroscope filter mode
+ * @param  LowHighPassFlag 0/1 for setting low-pass/high-pass filter mode
+ * @param  FilterMode Value of the filter Mode
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_G_Filter_Mode(uint8_t LowHighPassFlag, uint8_t FilterMode)
+{
+  if (LowHighPassFlag == 0) {
+    /*Set gyroscope low_pass 1 filter-mode*/
+    /* Enable low-pass filter */
+    if (lsm6dsv16x_filt_gy_lp1_set(&reg_ctx, 1) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+    if (lsm6dsv16x_filt_gy_lp1_bandwidth_set(&reg_ctx, (lsm6dsv16x_filt_gy_lp1_bandwidth_t)FilterMode) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  } else {
+    /*Set gyroscope high_pass filter-mode*/
+    /* Enable high-pass filter */
+    if (lsm6dsv16x_filt_gy_lp1_set(&reg_ctx, 0) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+    if (lsm6dsv16x_filt_gy_lp1_bandwidth_set(&reg_ctx, (lsm6dsv16x_filt_gy_lp1_bandwidth_t)FilterMode) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+  return LSM6DSV16X_OK;
+}
+
+
+/**
+ * @brief  Enable the LSM6DSV16X QVAR feature
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::QVAR_Enable()
+{
+  lsm6dsv16x_ctrl7_t ctrl7;
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_CTRL7, (uint8_t *)&ctrl7, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  ctrl7.ah_qvar_en = 1;
+  ctrl7.int2_drdy_ah_qvar = 1;
+
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_CTRL7, (uint8_t *)&ctrl7, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Disable the LSM6DSV16X QVAR feature
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::QVAR_Disable()
+{
+  lsm6dsv16x_ctrl7_t ctrl7;
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_CTRL7, (uint8_t *)&ctrl7, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  ctrl7.ah_qvar_en = 0;
+  ctrl7.int2_drdy_ah_qvar = 0;
+
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_CTRL7, (uint8_t *)&ctrl7, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+
+/**
+ * @brief  Read LSM6DSV16X QVAR output data
+ * @param  Data pointer where the value is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::QVAR_GetData(float *Data)
+{
+  lsm6dsv16x_axis1bit16_t data_raw;
+  (void)memset(data_raw.u8bit, 0x00, sizeof(int16_t));
+
+  if (lsm6dsv16x_ah_qvar_raw_get(&reg_ctx, &data_raw.i16bit) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  *Data = ((float)data_raw.i16bit) / LSM6DSV16X_QVAR_GAIN;
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Read LSM6DSV16X QVAR output data and the timestamp with a single burst
+ * @note   The QVAR output is not batched in the FIFO, read each sample on the data-ready
+ *         signal routed on INT2 by QVAR_Enable. The timestamp counter runs after Enable_Timestamp.
+ * @param  Sample pointer where the sample is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::QVAR_Get_Sample(LSM6DSV16X_QVAR_Sample_t *Sample)
+{
+  uint8_t buff[10];
+
+  /* AH_QVAR_OUT_L (3Ah) .. AH_QVAR_OUT_H (3Bh), reserved (3Ch .. 3Fh), TIMESTAMP0 (40h) .. TIMESTAMP3 (43h) */
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_AH_QVAR_OUT_L, buff, 10) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  Sample->Value = (float)(int16_t)((uint16_t)buff[1] << 8 | buff[0]) / LSM6DSV16X_QVAR_GAIN;
+  Sample->Timestamp = (uint32_t)buff[9] << 24 | (uint32_t)buff[8] << 16 | (uint32_t)buff[7] << 8 | buff[6];
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get LSM6DSV16X QVAR equivalent input impedance
+ * @param  val pointer where the value is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::QVAR_GetImpedance(uint16_t *val)
+{
+  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
+  lsm6dsv16x_ah_qvar_zin_t imp;
+
+  if (lsm6dsv16x_ah_qvar_zin_get(&reg_ctx, &imp) != LSM6DSV16X_OK) {
+    ret = LSM6DSV16X_ERROR;
+  }
+  switch (imp) {
+    case LSM6DSV16X_2400MOhm:
+      *val = 2400;
+      break;
+    case LSM6DSV16X_730MOhm:
+      *val = 730;
+      break;
+    case LSM6DSV16X_300MOhm:
+      *val = 300;
+      break;
+    case LSM6DSV16X_255MOhm:
+      *val = 255;
+      break;
+    default:
+      ret = LSM6DSV16X_ERROR;
+      break;
+  }
+
+  return ret;
+}
+
+
+/**
+ * @brief  Set LSM6DSV16X QVAR equivalent input impedance
+ * @param  val impedance in MOhm (2400MOhm, 730MOhm, 300MOhm, 255MOhm)
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::QVAR_SetImpedance(uint16_t val)
+{
+  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
+  lsm6dsv16x_ah_qvar_zin_t imp;
+  switch (val) {
+    case 2400:
+      imp = LSM6DSV16X_2400MOhm;
+      break;
+    case 730:
+      imp = LSM6DSV16X_730MOhm;
+      break;
+    case 300:
+      imp = LSM6DSV16X_300MOhm;
+      break;
+    case 255:
+      imp = LSM6DSV16X_255MOhm;
+      break;
+    default:
+      ret = LSM6DSV16X_ERROR;
+      break;
+  }
+  if (ret != LSM6DSV16X_ERROR) {
+    if (lsm6dsv16x_ah_qvar_zin_set(&reg_ctx, imp) != LSM6DSV16X_OK) {
+      ret = LSM6DSV16X_ERROR;
+    }
+  }
+  return ret;
+}
+
+/**
+ * @brief  Read LSM6DSV16X QVAR status
+ * @param  val pointer where the value is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::QVAR_GetStatus(uint8_t *val)
+{
+  lsm6dsv16x_status_reg_t status;
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_STATUS_REG, (uint8_t *)&status, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  *val = status.ah_qvarda;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get MLC status
+ * @param  status pointer where the MLC status is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_MLC_Status(lsm6dsv16x_mlc_status_mainpage_t *status)
+{
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MLC_STATUS_MAINPAGE, (uint8_t *)status, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get MLC output
+ * @param  output pointer where the MLC output is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_MLC_Output(lsm6dsv16x_mlc_out_t *output)
+{
+  if (lsm6dsv16x_mlc_out_get(&reg_ctx, output) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Configure the sensor hub read of an external sensor
+ * @param  Slave slave index (0 to 3)
+ * @param  Address 7-bit I2C address of the external sensor
+ * @param  Reg first register to be read
+ * @param  Len number of bytes to be read (1 to 7)
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::SH_Set_Slave(uint8_t Slave, uint8_t Address, uint8_t Reg, uint8_t Len)
+{
+  if (Slave >= LSM6DSV16X_SH_MAX_SLAVES || Len == 0U || Len > 7U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  sh_slave[Slave].slv_add = Address;
+  sh_slave[Slave].slv_subadd = Reg;
+  sh_slave[Slave].slv_len = Len;
+
+  if (lsm6dsv16x_sh_slv_cfg_read(&reg_ctx, Slave, &sh_slave[Slave]) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Write a register of an external sensor through the sensor hub
+ * @note   The sensor hub must be disabled, the slave 0 read configuration is restored afterwards
+ * @param  Address 7-bit I2C address of the external sensor
+ * @param  Reg register to be written
+ * @param  Data value to be written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::SH_Write_Reg(uint8_t Address, uint8_t Reg, uint8_t Data)
+{
+  LSM6DSV16XStatusTypeDef ret;
+  lsm6dsv16x_sh_cfg_write_t sh_cfg_write;
+
+  if (sh_enabled != 0U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  sh_cfg_write.slv0_add = Address;
+  sh_cfg_write.slv0_subadd = Reg;
+  sh_cfg_write.slv0_data = Data;
+
+  if (lsm6dsv16x_sh_cfg_write(&reg_ctx, &sh_cfg_write) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_sh_write_mode_set(&reg_ctx, LSM6DSV16X_ONLY_FIRST_CYCLE) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_sh_slave_connected_set(&reg_ctx, LSM6DSV16X_SLV_0) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  ret = SH_Run_Cycle(1);
+
+  /* Slave 0 registers are shared between write and read operations */
+  if (sh_slave[0].slv_len != 0U) {
+    if (lsm6dsv16x_sh_slv_cfg_read(&reg_ctx, 0, &sh_slave[0]) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  return ret;
+}
+
+/**
+ * @brief  Read registers of an external sensor through the sensor hub with a single cycle
+ * @note   The sensor hub must be disabled, the slave 0 read configuration is restored afterwards
+ * @param  Address 7-bit I2C address of the external sensor
+ * @param  Reg first register to be read
+ * @param  Data pointer where the values are written
+ * @param  Len number of bytes to be read (1 to 7)
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::SH_Read_Reg(uint8_t Address, uint8_t Reg, uint8_t *Data, uint8_t Len)
+{
+  lsm6dsv16x_sh_cfg_read_t sh_cfg_read;
+
+  if (sh_enabled != 0U || Len == 0U || Len > 7U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  sh_cfg_read.slv_add = Address;
+  sh_cfg_read.slv_subadd = Reg;
+  sh_cfg_read.slv_len = Len;
+
+  if (lsm6dsv16x_sh_slv_cfg_read(&reg_ctx, 0, &sh_cfg_read) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_sh_slave_connected_set(&reg_ctx, LSM6DSV16X_SLV_0) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (SH_Run_Cycle(0) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_sh_read_data_raw_get(&reg_ctx, Data, Len) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (sh_slave[0].slv_len != 0U) {
+    if (lsm6dsv16x_sh_slv_cfg_read(&reg_ctx, 0, &sh_slave[0]) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Enable the internal pull-up on the sensor hub master I2C lines
+ * @param  Status 1 to enable the pull-up, 0 to disable it
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::SH_Set_Pull_Up(uint8_t Status)
+{
+  if (lsm6dsv16x_sh_master_interface_pull_up_set(&reg_ctx, Status) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Enable the sensor hub, the external sensors are read at each accelerometer/gyroscope sample
+ * @param  Rate sensor hub rate [Hz] (15 to 480 Hz, not higher than the accelerometer/gyroscope ODR)
+ * @param  NumSlaves number of slaves configured with SH_Set_Slave, starting from slave 0
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::SH_Enable(float Rate, uint8_t NumSlaves)
+{
+  lsm6dsv16x_sh_data_rate_t new_rate;
+
+  if (NumSlaves == 0U || NumSlaves > LSM6DSV16X_SH_MAX_SLAVES) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  new_rate = (Rate <=  15.0f) ? LSM6DSV16X_SH_15Hz
+             : (Rate <=  30.0f) ? LSM6DSV16X_SH_30Hz
+             : (Rate <=  60.0f) ? LSM6DSV16X_SH_60Hz
+             : (Rate <= 120.0f) ? LSM6DSV16X_SH_120Hz
+             : (Rate <= 240.0f) ? LSM6DSV16X_SH_240Hz
+             :                    LSM6DSV16X_SH_480Hz;
+
+  if (lsm6dsv16x_sh_data_rate_set(&reg_ctx, new_rate) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_sh_slave_connected_set(&reg_ctx, (lsm6dsv16x_sh_slave_connected_t)(NumSlaves - 1U)) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_sh_syncro_mode_set(&reg_ctx, LSM6DSV16X_SH_TRG_XL_GY_DRDY) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_sh_master_set(&reg_ctx, PROPERTY_ENABLE) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  sh_enabled = 1U;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Disable the sensor hub
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::SH_Disable()
+{
+  if (lsm6dsv16x_sh_master_set(&reg_ctx, PROPERTY_DISABLE) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  sh_enabled = 0U;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the last data read by the sensor hub
+ * @param  Data pointer where the data of the slaves are written, in slave order
+ * @param  Len number of bytes to be read (up to 18)
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::SH_Get_Data(uint8_t *Data, uint8_t Len)
+{
+  if (lsm6dsv16x_sh_read_data_raw_get(&reg_ctx, Data, Len) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Enable the FIFO batching of a sensor hub slave
+ * @param  Slave slave index (0 to 3)
+ * @param  Status 1 to batch the slave data, 0 otherwise
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_SH_Set_Batch(uint8_t Slave, uint8_t Status)
+{
+  if (Slave >= LSM6DSV16X_SH_MAX_SLAVES) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_fifo_sh_batch_slave_set(&reg_ctx, Slave, Status) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the sensor hub slave a FIFO tag belongs to
+ * @param  Tag FIFO tag
+ * @param  Slave pointer where the slave index is written
+ * @retval 0 in case of success, an error code otherwise (not a sensor hub tag)
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_SH_Slave(uint8_t Tag, uint8_t *Slave)
+{
+  /* SENSORHUB_SLAVE0_TAG to SENSORHUB_SLAVE3_TAG */
+  if (Tag < 0x0EU || Tag > 0x11U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  *Slave = Tag - 0x0EU;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Run a single sensor hub cycle, triggered by the accelerometer
+ * @param  WriteOnce 1 to wait for the write once operation, 0 to wait for the end of the read operations
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::SH_Run_Cycle(uint8_t WriteOnce)
+{
+  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_ERROR;
+  lsm6dsv16x_data_rate_t odr;
+  lsm6dsv16x_status_master_t status;
+  unsigned long start;
+
+  /* The sensor hub is triggered by the accelerometer data-ready */
+  if (lsm6dsv16x_xl_data_rate_get(&reg_ctx, &odr) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (odr == LSM6DSV16X_ODR_OFF) {
+    if (lsm6dsv16x_xl_data_rate_set(&reg_ctx, LSM6DSV16X_ODR_AT_120Hz) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  /* Clear the status of a previous cycle */
+  if (lsm6dsv16x_sh_status_get(&reg_ctx, &status) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_sh_master_set(&reg_ctx, PROPERTY_ENABLE) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  start = millis();
+  do {
+    if (lsm6dsv16x_sh_status_get(&reg_ctx, &status) != LSM6DSV16X_OK) {
+      break;
+    }
+
+    if ((WriteOnce != 0U) ? (status.wr_once_done == 1U) : (status.sens_hub_endop == 1U)) {
+      ret = LSM6DSV16X_OK;
+      break;
+    }
+  } while ((millis() - start) < LSM6DSV16X_SH_TIMEOUT_MS);
+
+  if (lsm6dsv16x_sh_master_set(&reg_ctx, PROPERTY_DISABLE) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (odr == LSM6DSV16X_ODR_OFF) {
+    if (lsm6dsv16x_xl_data_rate_set(&reg_ctx, LSM6DSV16X_ODR_OFF) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  return ret;
+}
+
+/**
+ * @brief  Enable the SFLP features in a single pass
+ * @note   The accelerometer and gyroscope ODRs are raised to the SFLP rate if lower,
+ *         higher ODRs are kept
+ * @param  Rate SFLP output data rate [Hz] (15 to 480 Hz)
+ * @param  Outputs SFLP outputs batched in FIFO, a combination of LSM6DSV16X_SFLP_Output_t
+ * @param  Mode FIFO mode
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_SFLP(float Rate, uint8_t Outputs, lsm6dsv16x_fifo_mode_t Mode)
+{
+  lsm6dsv16x_fifo_sflp_raw_t fifo_sflp;
+  lsm6dsv16x_sflp_data_rate_t sflp_odr;
+  lsm6dsv16x_data_rate_t odr;
+  lsm6dsv16x_data_rate_t min_odr;
+
+  if (Outputs == 0U || (Outputs & ~LSM6DSV16X_SFLP_OUT_ALL) != 0U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  sflp_odr = (Rate <=  15.0f) ? LSM6DSV16X_SFLP_15Hz
+             : (Rate <=  30.0f) ? LSM6DSV16X_SFLP_30Hz
+             : (Rate <=  60.0f) ? LSM6DSV16X_SFLP_60Hz
+             : (Rate <= 120.0f) ? LSM6DSV16X_SFLP_120Hz
+             : (Rate <= 240.0f) ? LSM6DSV16X_SFLP_240Hz
+             :                    LSM6DSV16X_SFLP_480Hz;
+
+  /* SFLP_15Hz matches ODR_AT_15Hz, and so on */
+  min_odr = (lsm6dsv16x_data_rate_t)(LSM6DSV16X_ODR_AT_15Hz + sflp_odr);
+
+  /* Set full scale, skipped if already known */
+  if (acc_sensitivity != LSM6DSV16X_ACC_SENSITIVITY_FS_4G) {
+    if (lsm6dsv16x_xl_full_scale_set(&reg_ctx, LSM6DSV16X_4g)) {
+      return LSM6DSV16X_ERROR;
+    }
+    acc_sensitivity = LSM6DSV16X_ACC_SENSITIVITY_FS_4G;
+  }
+  if (gyro_sensitivity != LSM6DSV16X_GYRO_SENSITIVITY_FS_2000DPS) {
+    if (lsm6dsv16x_gy_full_scale_set(&reg_ctx, LSM6DSV16X_2000dps)) {
+      return LSM6DSV16X_ERROR;
+    }
+    gyro_sensitivity = LSM6DSV16X_GYRO_SENSITIVITY_FS_2000DPS;
+  }
+
+  fifo_sflp.game_rotation = ((Outputs & LSM6DSV16X_SFLP_OUT_GAME_ROTATION) != 0U) ? 1 : 0;
+  fifo_sflp.gravity = ((Outputs & LSM6DSV16X_SFLP_OUT_GRAVITY) != 0U) ? 1 : 0;
+  fifo_sflp.gbias = ((Outputs & LSM6DSV16X_SFLP_OUT_GYRO_BIAS) != 0U) ? 1 : 0;
+
+  if (lsm6dsv16x_fifo_sflp_batch_set(&reg_ctx, fifo_sflp)) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_fifo_mode_set(&reg_ctx, Mode)) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* Keep the sensors at least as fast as the SFLP (the low nibble is the ODR index,
+     the high nibble the HAODR selection, which is kept) */
+  if (lsm6dsv16x_xl_data_rate_get(&reg_ctx, &odr)) {
+    return LSM6DSV16X_ERROR;
+  }
+  if ((odr & 0x0F) < min_odr) {
+    odr = (lsm6dsv16x_data_rate_t)((odr & 0xF0) | min_odr);
+    if (lsm6dsv16x_xl_data_rate_set(&reg_ctx, odr)) {
+      return LSM6DSV16X_ERROR;
+    }
+    acc_odr = odr;
+    acc_is_enabled = 1U;
+  }
+  if (lsm6dsv16x_gy_data_rate_get(&reg_ctx, &odr)) {
+    return LSM6DSV16X_ERROR;
+  }
+  if ((odr & 0x0F) < min_odr) {
+    odr = (lsm6dsv16x_data_rate_t)((odr & 0xF0) | min_odr);
+    if (lsm6dsv16x_gy_data_rate_set(&reg_ctx, odr)) {
+      return LSM6DSV16X_ERROR;
+    }
+    gyro_odr = odr;
+    gyro_is_enabled = 1U;
+  }
+
+  if (lsm6dsv16x_sflp_data_rate_set(&reg_ctx, sflp_odr)) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* Enable SFLP low power */
+  if (lsm6dsv16x_sflp_game_rotation_set(&reg_ctx, PROPERTY_ENABLE)) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return FIFO_Track_Config();
+}
+
+/**
+ * @brief  Disable all the SFLP features
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_SFLP()
+{
+  lsm6dsv16x_fifo_sflp_raw_t fifo_sflp;
+
+  fifo_sflp.game_rotation = 0;
+  fifo_sflp.gravity = 0;
+  fifo_sflp.gbias = 0;
+
+  if (lsm6dsv16x_fifo_sflp_batch_set(&reg_ctx, fifo_sflp)) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_sflp_game_rotation_set(&reg_ctx, PROPERTY_DISABLE)) {
+    return LSM6DSV16X_ERROR;
+  }
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the SFLP outputs batched in FIFO
+ * @param  Outputs pointer where the combination of LSM6DSV16X_SFLP_Output_t is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_SFLP_Outputs(uint8_t *Outputs)
+{
+  lsm6dsv16x_fifo_sflp_raw_t fifo_sflp;
+
+  if (lsm6dsv16x_fifo_sflp_batch_get(&reg_ctx, &fifo_sflp)) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  *Outputs = 0U;
+  if (fifo_sflp.game_rotation) {
+    *Outputs |= LSM6DSV16X_SFLP_OUT_GAME_ROTATION;
+  }
+  if (fifo_sflp.gravity) {
+    *Outputs |= LSM6DSV16X_SFLP_OUT_GRAVITY;
+  }
+  if (fifo_sflp.gbias) {
+    *Outputs |= LSM6DSV16X_SFLP_OUT_GYRO_BIAS;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Add an output to the SFLP features
+ * @note   The SFLP starts at 120 Hz in Stream mode, an active session keeps its rate and FIFO mode
+ * @param  Output SFLP output to be added
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::SFLP_Add_Output(uint8_t Output)
+{
+  lsm6dsv16x_sflp_data_rate_t sflp_odr;
+  lsm6dsv16x_fifo_mode_t mode = LSM6DSV16X_STREAM_MODE;
+  float rate = 120.0f;
+  uint8_t outputs;
+
+  if (Get_SFLP_Outputs(&outputs) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (outputs != 0U) {
+    if (lsm6dsv16x_sflp_data_rate_get(&reg_ctx, &sflp_odr) != LSM6DSV16X_OK
+        || lsm6dsv16x_fifo_mode_get(&reg_ctx, &mode) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+
+    /* SFLP_15Hz to SFLP_480Hz, doubling at each step */
+    rate = 15.0f * (float)(1U << (uint8_t)sflp_odr);
+  }
+
+  return Enable_SFLP(rate, outputs | Output, mode);
+}
+
+/**
+ * @brief  Remove an output from the SFLP features, the SFLP is disabled with the last one
+ * @param  Output SFLP output to be removed
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::SFLP_Remove_Output(uint8_t Output)
+{
+  lsm6dsv16x_fifo_sflp_raw_t fifo_sflp;
+  uint8_t outputs;
+
+  if (Get_SFLP_Outputs(&outputs) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  outputs &= ~Output;
+  if (outputs == 0U) {
+    return Disable_SFLP();
+  }
+
+  fifo_sflp.game_rotation = ((outputs & LSM6DSV16X_SFLP_OUT_GAME_ROTATION) != 0U) ? 1 : 0;
+  fifo_sflp.gravity = ((outputs & LSM6DSV16X_SFLP_OUT_GRAVITY) != 0U) ? 1 : 0;
+  fifo_sflp.gbias = ((outputs & LSM6DSV16X_SFLP_OUT_GYRO_BIAS) != 0U) ? 1 : 0;
+
+  if (lsm6dsv16x_fifo_sflp_batch_set(&reg_ctx, fifo_sflp)) {
+    return LSM6DSV16X_ERROR;
+  }
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Enable Rotation Vector SFLP feature
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Rotation_Vector()
+{
+  return SFLP_Add_Output(LSM6DSV16X_SFLP_OUT_GAME_ROTATION);
+}
+
+/**
+ * @brief  Disable Rotation Vector SFLP feature
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Rotation_Vector()
+{
+  return SFLP_Remove_Output(LSM6DSV16X_SFLP_OUT_GAME_ROTATION);
+}
+
+/**
+ * @brief  Enable Gravity Vector SFLP feature
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Gravity_Vector()
+{
+  return SFLP_Add_Output(LSM6DSV16X_SFLP_OUT_GRAVITY);
+}
+
+/**
+ * @brief  Disable Gravity Vector SFLP feature
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Gravity_Vector()
+{
+  return SFLP_Remove_Output(LSM6DSV16X_SFLP_OUT_GRAVITY);
+}
+
+/**
+ * @brief  Enable Gyroscope Bias SFLP feature
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Gyroscope_Bias()
+{
+  return SFLP_Add_Output(LSM6DSV16X_SFLP_OUT_GYRO_BIAS);
+}
+
+/**
+ * @brief  Disable Gyroscope Bias SFLP feature
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Gyroscope_Bias()
+{
+  return SFLP_Remove_Output(LSM6DSV16X_SFLP_OUT_GYRO_BIAS);
+}
+
+/**
+  * @brief  Get the Rotation Vector values
+  * @param  rvec pointer where the Rotation Vector values are written
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Rotation_Vector(float *rvec)
+{
+  lsm6dsv16x_axis3bit16_t data_raw;
+
+  if (FIFO_Get_Data(data_raw.u8bit) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+  sflp2q(rvec, (uint16_t *)&data_raw.i16bit[0]);
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Decode the Rotation Vector values of a FIFO word read with FIFO_Get_Words
+  * @param  Word pointer to the FIFO word (SFLP game rotation vector tag)
+  * @param  rvec pointer where the Rotation Vector values are written
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Decode_Rotation_Vector(const LSM6DSV16X_FIFO_Word_t *Word, float *rvec)
+{
+  uint16_t sflp[3];
+
+  if (Word->Tag != 0x13U) { /* SFLP_GAME_ROTATION_VECTOR_TAG */
+    return LSM6DSV16X_ERROR;
+  }
+
+  sflp[0] = (uint16_t)Word->Data[1] << 8 | Word->Data[0];
+  sflp[1] = (uint16_t)Word->Data[3] << 8 | Word->Data[2];
+  sflp[2] = (uint16_t)Word->Data[5] << 8 | Word->Data[4];
+
+  return sflp2q(rvec, sflp);
 }
 
 /**
- * @brief  Set the LSM6DSV16X gyroscope sensor output data rate with operating mode
- * @param  Odr the output data rate value to be set
- * @param  Mode the gyroscope operating mode
- * @retval 0 in case of success, an error code otherwise
- */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_G_ODR(float Odr, LSM6DSV16X_GYRO_Operating_Mode_t Mode)
+  * @brief  Get the Gravity Vector values
+  * @param  gvec pointer where the Gravity Vector values are written
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Gravity_Vector(float *gvec)
 {
-  switch (Mode) {
-    case LSM6DSV16X_GYRO_HIGH_PERFORMANCE_MODE: {
-        if (lsm6dsv16x_gy_mode_set(&reg_ctx, LSM6DSV16X_GY_HIGH_PERFORMANCE_MD) != LSM6DSV16X_OK) {
-          return LSM6DSV16X_ERROR;
-        }
+  lsm6dsv16x_axis3bit16_t data_raw;
 
-        /* Valid ODR: 7.5Hz <= Odr <= 7.68kHz */
-        Odr = (Odr <    7.5f) ?    7.5f
-              : (Odr > 7680.0f) ? 7680.0f
-              :                       Odr;
-        break;
-      }
+  if (FIFO_Get_Data(data_raw.u8bit) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-    case LSM6DSV16X_GYRO_HIGH_ACCURACY_MODE:
-      // TODO: Not implemented.
-      // NOTE: According to datasheet, section `6.5 High-accuracy ODR mode`:
-      // "... the other sensor also has to be configured in high-accuracy ODR (HAODR) mode."
-      return LSM6DSV16X_ERROR;
+  gvec[0] = lsm6dsv16x_from_sflp_to_mg(data_raw.i16bit[0]);
+  gvec[1] = lsm6dsv16x_from_sflp_to_mg(data_raw.i16bit[1]);
+  gvec[2] = lsm6dsv16x_from_sflp_to_mg(data_raw.i16bit[2]);
 
-    case LSM6DSV16X_GYRO_SLEEP_MODE:
-      // TODO: Not implemented.
-      // NOTE: Unknown ODR validity for this mode
-      return LSM6DSV16X_ERROR;
+  return LSM6DSV16X_OK;
+}
 
-    case LSM6DSV16X_GYRO_LOW_POWER_MODE: {
-        if (lsm6dsv16x_gy_mode_set(&reg_ctx, LSM6DSV16X_GY_LOW_POWER_MD) != LSM6DSV16X_OK) {
-          return LSM6DSV16X_ERROR;
-        }
+/**
+  * @brief  Decode the Gravity Vector values of a FIFO word read with FIFO_Get_Words
+  * @param  Word pointer to the FIFO word (SFLP gravity vector tag)
+  * @param  gvec pointer where the Gravity Vector values are written [mg]
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Decode_Gravity_Vector(const LSM6DSV16X_FIFO_Word_t *Word, float *gvec)
+{
+  if (Word->Tag != 0x17U) { /* SFLP_GRAVITY_VECTOR_TAG */
+    return LSM6DSV16X_ERROR;
+  }
 
-        /* Valid ODR: 7.5Hz <= Odr <= 240kHz */
-        Odr = (Odr <   7.5f) ?   7.5f
-              : (Odr > 240.0f) ? 240.0f
-              :                     Odr;
-        break;
-      }
+  gvec[0] = lsm6dsv16x_from_sflp_to_mg((int16_t)((uint16_t)Word->Data[1] << 8 | Word->Data[0]));
+  gvec[1] = lsm6dsv16x_from_sflp_to_mg((int16_t)((uint16_t)Word->Data[3] << 8 | Word->Data[2]));
+  gvec[2] = lsm6dsv16x_from_sflp_to_mg((int16_t)((uint16_t)Word->Data[5] << 8 | Word->Data[4]));
 
-    default:
-      return LSM6DSV16X_ERROR;
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Get the Gravity Bias values
+  * @param  gbias pointer where the Gravity Bias values are written
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Gyroscope_Bias(float *gbias)
+{
+  lsm6dsv16x_axis3bit16_t data_raw;
+
+  if (FIFO_Get_Data(data_raw.u8bit) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
   }
 
-  if (gyro_is_enabled == 1U) {
-    return Set_G_ODR_When_Enabled(Odr);
-  } else {
-    return Set_G_ODR_When_Disabled(Odr);
+  gbias[0] = lsm6dsv16x_from_fs125_to_mdps(data_raw.i16bit[0]);
+  gbias[1] = lsm6dsv16x_from_fs125_to_mdps(data_raw.i16bit[1]);
+  gbias[2] = lsm6dsv16x_from_fs125_to_mdps(data_raw.i16bit[2]);
+
+  /* Keep the last estimate for a later warm start */
+  (void)memcpy((void *)sflp_gbias, (void *)gbias, sizeof(sflp_gbias));
+  sflp_gbias_valid = 1U;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+  * @brief  Decode the Gyroscope Bias values of a FIFO word read with FIFO_Get_Words
+  * @param  Word pointer to the FIFO word (SFLP gyroscope bias tag)
+  * @param  gbias pointer where the Gyroscope Bias values are written
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Decode_Gyroscope_Bias(const LSM6DSV16X_FIFO_Word_t *Word, float *gbias)
+{
+  if (Word->Tag != 0x16U) { /* SFLP_GYROSCOPE_BIAS_TAG */
+    return LSM6DSV16X_ERROR;
   }
+
+  gbias[0] = lsm6dsv16x_from_fs125_to_mdps((int16_t)((uint16_t)Word->Data[1] << 8 | Word->Data[0]));
+  gbias[1] = lsm6dsv16x_from_fs125_to_mdps((int16_t)((uint16_t)Word->Data[3] << 8 | Word->Data[2]));
+  gbias[2] = lsm6dsv16x_from_fs125_to_mdps((int16_t)((uint16_t)Word->Data[5] << 8 | Word->Data[4]));
+
+  (void)memcpy((void *)sflp_gbias, (void *)gbias, sizeof(sflp_gbias));
+  sflp_gbias_valid = 1U;
+
+  return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Set the LSM6DSV16X gyroscope sensor output data rate when enabled
- * @param  Odr the functional output data rate to be set
- * @retval 0 in case of success, an error code otherwise
- */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_G_ODR_When_Enabled(float Odr)
+  * @brief Reset SFLP
+  * @retval 0 in case of success, an error code otherwise
+  */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Reset_SFLP(void)
 {
-  lsm6dsv16x_data_rate_t new_odr;
+  lsm6dsv16x_emb_func_init_a_t emb_func_init_a;
 
-  new_odr = (Odr <=    7.5f) ? LSM6DSV16X_ODR_AT_7Hz5
-            : (Odr <=   15.0f) ? LSM6DSV16X_ODR_AT_15Hz
-            : (Odr <=   30.0f) ? LSM6DSV16X_ODR_AT_30Hz
-            : (Odr <=   60.0f) ? LSM6DSV16X_ODR_AT_60Hz
-            : (Odr <=  120.0f) ? LSM6DSV16X_ODR_AT_120Hz
-            : (Odr <=  240.0f) ? LSM6DSV16X_ODR_AT_240Hz
-            : (Odr <=  480.0f) ? LSM6DSV16X_ODR_AT_480Hz
-            : (Odr <=  960.0f) ? LSM6DSV16X_ODR_AT_960Hz
-            : (Odr <= 1920.0f) ? LSM6DSV16X_ODR_AT_1920Hz
-            : (Odr <= 3840.0f) ? LSM6DSV16X_ODR_AT_3840Hz
-            :                    LSM6DSV16X_ODR_AT_7680Hz;
+  if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_EMBED_FUNC_MEM_BANK) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-  /* Output data rate selection. */
-  if (lsm6dsv16x_gy_data_rate_set(&reg_ctx, new_odr) != LSM6DSV16X_OK) {
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INIT_A, (uint8_t *)&emb_func_init_a, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  emb_func_init_a.sflp_game_init = 1;
+
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INIT_A, (uint8_t *)&emb_func_init_a, 1) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
+  if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Set the LSM6DSV16X gyroscope sensor output data rate when disabled
- * @param  Odr the functional output data rate to be set
- * @retval 0 in case of success, an error code otherwise
+ * @brief  Get the last SFLP gyroscope bias read from FIFO
+ * @param  gbias pointer where the Gyroscope Bias values are written [mdps]
+ * @retval 0 in case of success, an error code otherwise (no bias read yet)
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_G_ODR_When_Disabled(float Odr)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_SFLP_Gyroscope_Bias(float *gbias)
 {
-  gyro_odr = (Odr <=    7.5f) ? LSM6DSV16X_ODR_AT_7Hz5
-             : (Odr <=   15.0f) ? LSM6DSV16X_ODR_AT_15Hz
-             : (Odr <=   30.0f) ? LSM6DSV16X_ODR_AT_30Hz
-             : (Odr <=   60.0f) ? LSM6DSV16X_ODR_AT_60Hz
-             : (Odr <=  120.0f) ? LSM6DSV16X_ODR_AT_120Hz
-             : (Odr <=  240.0f) ? LSM6DSV16X_ODR_AT_240Hz
-             : (Odr <=  480.0f) ? LSM6DSV16X_ODR_AT_480Hz
-             : (Odr <=  960.0f) ? LSM6DSV16X_ODR_AT_960Hz
-             : (Odr <= 1920.0f) ? LSM6DSV16X_ODR_AT_1920Hz
-             : (Odr <= 3840.0f) ? LSM6DSV16X_ODR_AT_3840Hz
-             :                    LSM6DSV16X_ODR_AT_7680Hz;
+  if (sflp_gbias_valid == 0U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  (void)memcpy((void *)gbias, (void *)sflp_gbias, sizeof(sflp_gbias));
 
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Get the LSM6DSV16X gyroscope sensor full scale
- * @param  FullScale pointer where the full scale is written
+ * @brief  Set the initial SFLP gyroscope bias, so that the filter does not converge from zero
+ * @note   To be called after Enable_SFLP or Reset_SFLP, the SFLP game rotation is enabled
+ * @param  gbias Gyroscope Bias values [mdps]
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_G_FS(int32_t  *FullScale)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_SFLP_Gyroscope_Bias(const float *gbias)
 {
-  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
-  lsm6dsv16x_gy_full_scale_t fs_low_level;
+  lsm6dsv16x_sflp_gbias_t val;
 
-  /* Read actual full scale selection from sensor. */
-  if (lsm6dsv16x_gy_full_scale_get(&reg_ctx, &fs_low_level) != LSM6DSV16X_OK) {
+  val.gbias_x = gbias[0] / 1000.0f;
+  val.gbias_y = gbias[1] / 1000.0f;
+  val.gbias_z = gbias[2] / 1000.0f;
+
+  if (lsm6dsv16x_sflp_game_gbias_set(&reg_ctx, &val) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  switch (fs_low_level) {
-    case LSM6DSV16X_125dps:
-      *FullScale =  125;
-      break;
+  if (gbias != sflp_gbias) {
+    (void)memcpy((void *)sflp_gbias, (const void *)gbias, sizeof(sflp_gbias));
+  }
+  sflp_gbias_valid = 1U;
 
-    case LSM6DSV16X_250dps:
-      *FullScale =  250;
-      break;
+  return LSM6DSV16X_OK;
+}
 
-    case LSM6DSV16X_500dps:
-      *FullScale =  500;
-      break;
+/**
+ * @brief  Write back the last SFLP gyroscope bias, e.g. after Reset_SFLP
+ * @retval 0 in case of success, an error code otherwise (no bias read yet)
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Restore_SFLP_Gyroscope_Bias()
+{
+  if (sflp_gbias_valid == 0U) {
+    return LSM6DSV16X_ERROR;
+  }
 
-    case LSM6DSV16X_1000dps:
-      *FullScale = 1000;
-      break;
+  return Set_SFLP_Gyroscope_Bias(sflp_gbias);
+}
 
-    case LSM6DSV16X_2000dps:
-      *FullScale = 2000;
-      break;
+/**
+ * @brief  Serialize the SFLP configuration and the last gyroscope bias
+ * @note   The state is LSM6DSV16X_SFLP_STATE_SIZE bytes long, little-endian and
+ *         protected by a CRC, it can be stored in non-volatile memory
+ * @param  Buffer pointer where the state is written
+ * @param  Size size of the buffer
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_SFLP_State(uint8_t *Buffer, uint16_t Size)
+{
+  lsm6dsv16x_sflp_data_rate_t sflp_odr;
+  uint8_t outputs;
+  uint16_t crc;
+  int32_t bias;
 
-    case LSM6DSV16X_4000dps:
-      *FullScale = 4000;
-      break;
+  if (Size < LSM6DSV16X_SFLP_STATE_SIZE || sflp_gbias_valid == 0U) {
+    return LSM6DSV16X_ERROR;
+  }
 
-    default:
-      ret = LSM6DSV16X_ERROR;
-      break;
+  if (lsm6dsv16x_sflp_data_rate_get(&reg_ctx, &sflp_odr) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
   }
 
-  return ret;
+  if (Get_SFLP_Outputs(&outputs) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  Buffer[0] = LSM6DSV16X_SFLP_STATE_MAGIC & 0xFFU;
+  Buffer[1] = LSM6DSV16X_SFLP_STATE_MAGIC >> 8;
+  Buffer[2] = LSM6DSV16X_SFLP_STATE_VERSION;
+  Buffer[3] = (uint8_t)sflp_odr;
+  Buffer[4] = outputs;
+  Buffer[5] = 0U;
+
+  /* Bias in udps */
+  for (uint8_t i = 0U; i < 3U; i++) {
+    bias = (int32_t)(sflp_gbias[i] * 1000.0f);
+    Buffer[6U + 4U * i] = (uint8_t)bias;
+    Buffer[7U + 4U * i] = (uint8_t)(bias >> 8);
+    Buffer[8U + 4U * i] = (uint8_t)(bias >> 16);
+    Buffer[9U + 4U * i] = (uint8_t)(bias >> 24);
+  }
+
+  crc = State_Crc(Buffer, LSM6DSV16X_SFLP_STATE_SIZE - 2U);
+  Buffer[LSM6DSV16X_SFLP_STATE_SIZE - 2U] = (uint8_t)crc;
+  Buffer[LSM6DSV16X_SFLP_STATE_SIZE - 1U] = (uint8_t)(crc >> 8);
+
+  return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Set the LSM6DSV16X gyroscope sensor full scale
- * @param  FullScale the functional full scale to be set
- * @retval 0 in case of success, an error code otherwise
+ * @brief  Restart the SFLP from a state saved with Get_SFLP_State
+ * @note   The saved rate and outputs are enabled in Stream mode and the
+ *         saved gyroscope bias is written before the first output. With no
+ *         saved output the SFLP is left disabled and the bias is only kept for
+ *         Restore_SFLP_Gyroscope_Bias
+ * @param  Buffer pointer to the saved state
+ * @param  Size size of the saved state
+ * @retval 0 in case of success, an error code otherwise (invalid state)
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_G_FS(int32_t FullScale)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Restore_SFLP_State(const uint8_t *Buffer, uint16_t Size)
 {
-  lsm6dsv16x_gy_full_scale_t new_fs;
+  uint16_t crc;
+  float gbias[3];
 
-  new_fs = (FullScale <= 125)  ? LSM6DSV16X_125dps
-           : (FullScale <= 250)  ? LSM6DSV16X_250dps
-           : (FullScale <= 500)  ? LSM6DSV16X_500dps
-           : (FullScale <= 1000) ? LSM6DSV16X_1000dps
-           : (FullScale <= 2000) ? LSM6DSV16X_2000dps
-           :                       LSM6DSV16X_4000dps;
+  if (Size < LSM6DSV16X_SFLP_STATE_SIZE) {
+    return LSM6DSV16X_ERROR;
+  }
 
-  if (lsm6dsv16x_gy_full_scale_set(&reg_ctx, new_fs) != LSM6DSV16X_OK) {
+  crc = (uint16_t)Buffer[LSM6DSV16X_SFLP_STATE_SIZE - 1U] << 8 | Buffer[LSM6DSV16X_SFLP_STATE_SIZE - 2U];
+  if (((uint16_t)Buffer[1] << 8 | Buffer[0]) != LSM6DSV16X_SFLP_STATE_MAGIC
+      || Buffer[2] != LSM6DSV16X_SFLP_STATE_VERSION
+      || Buffer[3] > (uint8_t)LSM6DSV16X_SFLP_480Hz
+      || crc != State_Crc(Buffer, LSM6DSV16X_SFLP_STATE_SIZE - 2U)) {
     return LSM6DSV16X_ERROR;
   }
 
-  return LSM6DSV16X_OK;
+  for (uint8_t i = 0U; i < 3U; i++) {
+    gbias[i] = (float)(int32_t)((uint32_t)Buffer[6U + 4U * i]
+                                | (uint32_t)Buffer[7U + 4U * i] << 8
+                                | (uint32_t)Buffer[8U + 4U * i] << 16
+                                | (uint32_t)Buffer[9U + 4U * i] << 24) / 1000.0f;
+  }
+
+  /* Writing the bias enables the SFLP game rotation */
+  if (Buffer[4] == 0U) {
+    (void)memcpy((void *)sflp_gbias, (const void *)gbias, sizeof(sflp_gbias));
+    sflp_gbias_valid = 1U;
+    return LSM6DSV16X_OK;
+  }
+
+  if (Enable_SFLP((float)(15U << Buffer[3]), Buffer[4]) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return Set_SFLP_Gyroscope_Bias(gbias);
 }
 
 /**
- * @brief  Get the LSM6DSV16X gyroscope sensor raw axes
- * @param  Value pointer where the raw values of the axes are written
+ * @brief  Program the accelerometer user offset, subtracted in hardware from the output and FIFO data
+ * @note   The finest weight able to represent all the axes is selected
+ * @param  Offset pointer to the offset of the three axes [mg]
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_G_AxesRaw(int16_t *Value)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_X_User_Offset(const float *Offset)
 {
-  lsm6dsv16x_axis3bit16_t data_raw;
+  lsm6dsv16x_ctrl9_t ctrl9;
+  uint8_t ofs[3];
+  float max_abs = 0.0f;
+  float lsb;
+  float tmp;
 
-  /* Read raw data values. */
-  if (lsm6dsv16x_angular_rate_raw_get(&reg_ctx, data_raw.i16bit) != LSM6DSV16X_OK) {
+  for (uint8_t i = 0U; i < 3U; i++) {
+    tmp = (Offset[i] < 0.0f) ? -Offset[i] : Offset[i];
+    max_abs = (tmp > max_abs) ? tmp : max_abs;
+  }
+
+  if (max_abs > 127.0f * LSM6DSV16X_XL_OFFSET_LSB_HIGH) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Format the data. */
-  Value[0] = data_raw.i16bit[0];
-  Value[1] = data_raw.i16bit[1];
-  Value[2] = data_raw.i16bit[2];
+  lsb = (max_abs > 127.0f * LSM6DSV16X_XL_OFFSET_LSB_LOW) ? LSM6DSV16X_XL_OFFSET_LSB_HIGH : LSM6DSV16X_XL_OFFSET_LSB_LOW;
+
+  /* Two's complement, rounded to the nearest step */
+  for (uint8_t i = 0U; i < 3U; i++) {
+    tmp = Offset[i] / lsb;
+    tmp += (tmp < 0.0f) ? -0.5f : 0.5f;
+    tmp = (tmp > 127.0f) ? 127.0f : (tmp < -127.0f) ? -127.0f : tmp;
+    ofs[i] = (uint8_t)(int8_t)tmp;
+  }
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_CTRL9, (uint8_t *)&ctrl9, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* X_OFS_USR, Y_OFS_USR and Z_OFS_USR are contiguous */
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_X_OFS_USR, ofs, 3) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  ctrl9.usr_off_w = (lsb == LSM6DSV16X_XL_OFFSET_LSB_HIGH) ? 1U : 0U;
+  ctrl9.usr_off_on_out = PROPERTY_ENABLE;
+
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_CTRL9, (uint8_t *)&ctrl9, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Get the LSM6DSV16X gyroscope sensor axes
- * @param  AngularRate pointer where the values of the axes are written
+ * @brief  Get the accelerometer user offset
+ * @param  Offset pointer where the offset of the three axes is written [mg]
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_G_Axes(int32_t *AngularRate)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_X_User_Offset(float *Offset)
 {
-  lsm6dsv16x_axis3bit16_t data_raw;
-  float sensitivity;
+  lsm6dsv16x_ctrl9_t ctrl9;
+  uint8_t ofs[3];
+  float lsb;
 
-  /* Read raw data values. */
-  if (lsm6dsv16x_angular_rate_raw_get(&reg_ctx, data_raw.i16bit) != LSM6DSV16X_OK) {
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_CTRL9, (uint8_t *)&ctrl9, 1) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Get LSM6DSV16X actual sensitivity. */
-  if (Get_G_Sensitivity(&sensitivity) != LSM6DSV16X_OK) {
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_X_OFS_USR, ofs, 3) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Calculate the data. */
-  AngularRate[0] = (int32_t)((float)((float)data_raw.i16bit[0] * sensitivity));
-  AngularRate[1] = (int32_t)((float)((float)data_raw.i16bit[1] * sensitivity));
-  AngularRate[2] = (int32_t)((float)((float)data_raw.i16bit[2] * sensitivity));
+  lsb = (ctrl9.usr_off_w != 0U) ? LSM6DSV16X_XL_OFFSET_LSB_HIGH : LSM6DSV16X_XL_OFFSET_LSB_LOW;
+
+  Offset[0] = (float)(int8_t)ofs[0] * lsb;
+  Offset[1] = (float)(int8_t)ofs[1] * lsb;
+  Offset[2] = (float)(int8_t)ofs[2] * lsb;
 
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Get the LSM6DSV16X GYRO data ready bit value
- * @param  Status the status of data ready bit
+ * @brief  Start the accelerometer offset calibration
+ * @note   The device must be still on a level surface, in any of the six 6D positions:
+ *         the vertical axis is calibrated against 1 g and the horizontal axes against 0 g.
+ *         The user offset is not applied to the output until the calibration is stopped.
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_G_DRDY_Status(uint8_t *Status)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Start_X_Offset_Calibration()
 {
-  lsm6dsv16x_all_sources_t val;
+  lsm6dsv16x_ctrl9_t ctrl9;
 
-  if (lsm6dsv16x_all_sources_get(&reg_ctx, &val) != LSM6DSV16X_OK) {
+  if (xl_cal_running != 0U) {
     return LSM6DSV16X_ERROR;
   }
 
-  *Status = val.drdy_gy;
-  return LSM6DSV16X_OK;
-}
+  if (acc_sensitivity == 0.0f) {
+    if (Get_X_Sensitivity(&acc_sensitivity) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
 
-/**
- * @brief  Set the LSM6DSV16X gyroscope power mode
- * @param  PowerMode Value of the powerMode
- * @retval 0 in case of success, an error code otherwise
- */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_G_Power_Mode(uint8_t PowerMode)
-{
-  if (lsm6dsv16x_gy_mode_set(&reg_ctx, (lsm6dsv16x_gy_mode_t)PowerMode) != LSM6DSV16X_OK) {
+  /* Estimate on the uncorrected data */
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_CTRL9, (uint8_t *)&ctrl9, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  xl_cal_on_out = ctrl9.usr_off_on_out;
+  ctrl9.usr_off_on_out = PROPERTY_DISABLE;
+
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_CTRL9, (uint8_t *)&ctrl9, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  /* The 6D position is only tracked while the basic interrupts are enabled */
+  int_route_irq_hold++;
+  if (Commit_Interrupt_Routing() != LSM6DSV16X_OK) {
+    int_route_irq_hold--;
     return LSM6DSV16X_ERROR;
   }
 
+  (void)memset((void *)xl_cal_sum, 0x0, sizeof(xl_cal_sum));
+  (void)memset((void *)xl_cal_count, 0x0, sizeof(xl_cal_count));
+  xl_cal_prev_valid = 0U;
+  xl_cal_running = 1U;
+
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Set the LSM6DSV16X gyroscope filter mode
- * @param  LowHighPassFlag 0/1 for setting low-pass/high-pass filter mode
- * @param  FilterMode Value of the filter Mode
+ * @brief  Feed the accelerometer offset calibration with the last sample, to be called periodically
+ * @note   Samples taken while the device moves or is not in a 6D position are discarded
+ * @param  Done pointer where 1 is written when enough static samples have been collected
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_G_Filter_Mode(uint8_t LowHighPassFlag, uint8_t FilterMode)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Service_X_Offset_Calibration(uint8_t *Done)
 {
-  if (LowHighPassFlag == 0) {
-    /*Set gyroscope low_pass 1 filter-mode*/
-    /* Enable low-pass filter */
-    if (lsm6dsv16x_filt_gy_lp1_set(&reg_ctx, 1) != LSM6DSV16X_OK) {
+  lsm6dsv16x_d6d_src_t d6d_src;
+  uint8_t drdy = 0U;
+  int16_t raw[3];
+  int32_t delta;
+  uint8_t axis = 3U;
+  float up = 0.0f;
+  uint8_t still = 1U;
+
+  *Done = 0U;
+
+  if (xl_cal_running == 0U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (Get_X_DRDY_Status(&drdy) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (drdy != 0U) {
+    if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_D6D_SRC, (uint8_t *)&d6d_src, 1) != LSM6DSV16X_OK) {
       return LSM6DSV16X_ERROR;
     }
-    if (lsm6dsv16x_filt_gy_lp1_bandwidth_set(&reg_ctx, (lsm6dsv16x_filt_gy_lp1_bandwidth_t)FilterMode) != LSM6DSV16X_OK) {
+
+    if (Get_X_AxesRaw(raw) != LSM6DSV16X_OK) {
       return LSM6DSV16X_ERROR;
     }
-  } else {
-    /*Set gyroscope high_pass filter-mode*/
-    /* Enable high-pass filter */
-    if (lsm6dsv16x_filt_gy_lp1_set(&reg_ctx, 0) != LSM6DSV16X_OK) {
-      return LSM6DSV16X_ERROR;
+
+    /* Axis pointing up or down, only one bit is set in a 6D position */
+    switch (*(uint8_t *)&d6d_src & 0x3FU) {
+      case 0x01U:
+        axis = 0U;
+        up = -1000.0f;
+        break;
+      case 0x02U:
+        axis = 0U;
+        up = 1000.0f;
+        break;
+      case 0x04U:
+        axis = 1U;
+        up = -1000.0f;
+        break;
+      case 0x08U:
+        axis = 1U;
+        up = 1000.0f;
+        break;
+      case 0x10U:
+        axis = 2U;
+        up = -1000.0f;
+        break;
+      case 0x20U:
+        axis = 2U;
+        up = 1000.0f;
+        break;
+      default:
+        break;
     }
-    if (lsm6dsv16x_filt_gy_lp1_bandwidth_set(&reg_ctx, (lsm6dsv16x_filt_gy_lp1_bandwidth_t)FilterMode) != LSM6DSV16X_OK) {
-      return LSM6DSV16X_ERROR;
+
+    for (uint8_t i = 0U; i < 3U; i++) {
+      delta = (int32_t)raw[i] - xl_cal_prev[i];
+      delta = (delta < 0) ? -delta : delta;
+      if (xl_cal_prev_valid == 0U || (float)delta * acc_sensitivity > LSM6DSV16X_XL_CAL_MOTION_MG) {
+        still = 0U;
+      }
+      xl_cal_prev[i] = raw[i];
+    }
+    xl_cal_prev_valid = 1U;
+
+    if (axis < 3U && still != 0U) {
+      for (uint8_t i = 0U; i < 3U; i++) {
+        if (xl_cal_count[i] < LSM6DSV16X_XL_CAL_SAMPLES) {
+          xl_cal_sum[i] += (float)raw[i] * acc_sensitivity - ((i == axis) ? up : 0.0f);
+          xl_cal_count[i]++;
+        }
+      }
     }
   }
+
+  if (xl_cal_count[0] >= LSM6DSV16X_XL_CAL_SAMPLES
+      && xl_cal_count[1] >= LSM6DSV16X_XL_CAL_SAMPLES
+      && xl_cal_count[2] >= LSM6DSV16X_XL_CAL_SAMPLES) {
+    *Done = 1U;
+  }
+
   return LSM6DSV16X_OK;
 }
 
-
 /**
- * @brief  Enable the LSM6DSV16X QVAR feature
+ * @brief  Stop the accelerometer offset calibration and program the estimated offset
+ * @note   If not enough static samples have been collected the previous offset is kept
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::QVAR_Enable()
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Stop_X_Offset_Calibration()
 {
-  lsm6dsv16x_ctrl7_t ctrl7;
+  lsm6dsv16x_ctrl9_t ctrl9;
+  float offset[3];
 
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_CTRL7, (uint8_t *)&ctrl7, 1) != LSM6DSV16X_OK) {
+  if (xl_cal_running == 0U) {
     return LSM6DSV16X_ERROR;
   }
 
-  ctrl7.ah_qvar_en = 1;
-  ctrl7.int2_drdy_ah_qvar = 1;
+  xl_cal_running = 0U;
 
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_CTRL7, (uint8_t *)&ctrl7, 1) != LSM6DSV16X_OK) {
+  /* INTERRUPTS_ENABLE is kept if routed basic interrupts still need it */
+  int_route_irq_hold--;
+  if (Commit_Interrupt_Routing() != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  return LSM6DSV16X_OK;
+  if (xl_cal_count[0] < LSM6DSV16X_XL_CAL_SAMPLES
+      || xl_cal_count[1] < LSM6DSV16X_XL_CAL_SAMPLES
+      || xl_cal_count[2] < LSM6DSV16X_XL_CAL_SAMPLES) {
+    /* Not converged, restore the previous correction */
+    if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_CTRL9, (uint8_t *)&ctrl9, 1) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+
+    ctrl9.usr_off_on_out = xl_cal_on_out;
+
+    if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_CTRL9, (uint8_t *)&ctrl9, 1) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+
+    return LSM6DSV16X_ERROR;
+  }
+
+  for (uint8_t i = 0U; i < 3U; i++) {
+    offset[i] = xl_cal_sum[i] / (float)xl_cal_count[i];
+  }
+
+  return Set_X_User_Offset(offset);
 }
 
 /**
- * @brief  Disable the LSM6DSV16X QVAR feature
+ * @brief  Serialize the accelerometer user offset
+ * @note   The state is LSM6DSV16X_XL_OFFSET_STATE_SIZE bytes long and protected
+ *         by a CRC, it can be stored in non-volatile memory
+ * @param  Buffer pointer where the state is written
+ * @param  Size size of the buffer
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::QVAR_Disable()
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_X_Offset_State(uint8_t *Buffer, uint16_t Size)
 {
-  lsm6dsv16x_ctrl7_t ctrl7;
+  lsm6dsv16x_ctrl9_t ctrl9;
+  uint16_t crc;
 
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_CTRL7, (uint8_t *)&ctrl7, 1) != LSM6DSV16X_OK) {
+  if (Size < LSM6DSV16X_XL_OFFSET_STATE_SIZE) {
     return LSM6DSV16X_ERROR;
   }
 
-  ctrl7.ah_qvar_en = 0;
-  ctrl7.int2_drdy_ah_qvar = 0;
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_CTRL9, (uint8_t *)&ctrl9, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_CTRL7, (uint8_t *)&ctrl7, 1) != LSM6DSV16X_OK) {
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_X_OFS_USR, &Buffer[4], 3) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
+  Buffer[0] = LSM6DSV16X_XL_OFFSET_STATE_MAGIC & 0xFFU;
+  Buffer[1] = LSM6DSV16X_XL_OFFSET_STATE_MAGIC >> 8;
+  Buffer[2] = LSM6DSV16X_XL_OFFSET_STATE_VERSION;
+  Buffer[3] = ctrl9.usr_off_w;
+  Buffer[7] = 0U;
+
+  crc = State_Crc(Buffer, LSM6DSV16X_XL_OFFSET_STATE_SIZE - 2U);
+  Buffer[LSM6DSV16X_XL_OFFSET_STATE_SIZE - 2U] = (uint8_t)crc;
+  Buffer[LSM6DSV16X_XL_OFFSET_STATE_SIZE - 1U] = (uint8_t)(crc >> 8);
+
   return LSM6DSV16X_OK;
 }
 
-
 /**
- * @brief  Read LSM6DSV16X QVAR output data
- * @param  Data pointer where the value is written
+ * @brief  Restore an accelerometer user offset saved with Get_X_Offset_State
+ * @param  Buffer pointer to the saved state
+ * @param  Size size of the buffer
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::QVAR_GetData(float *Data)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Restore_X_Offset_State(const uint8_t *Buffer, uint16_t Size)
 {
-  lsm6dsv16x_axis1bit16_t data_raw;
-  (void)memset(data_raw.u8bit, 0x00, sizeof(int16_t));
+  lsm6dsv16x_ctrl9_t ctrl9;
+  uint16_t crc;
 
-  if (lsm6dsv16x_ah_qvar_raw_get(&reg_ctx, &data_raw.i16bit) != LSM6DSV16X_OK) {
+  if (Size < LSM6DSV16X_XL_OFFSET_STATE_SIZE) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  crc = (uint16_t)Buffer[LSM6DSV16X_XL_OFFSET_STATE_SIZE - 1U] << 8 | Buffer[LSM6DSV16X_XL_OFFSET_STATE_SIZE - 2U];
+  if (((uint16_t)Buffer[1] << 8 | Buffer[0]) != LSM6DSV16X_XL_OFFSET_STATE_MAGIC
+      || Buffer[2] != LSM6DSV16X_XL_OFFSET_STATE_VERSION
+      || Buffer[3] > 1U
+      || crc != State_Crc(Buffer, LSM6DSV16X_XL_OFFSET_STATE_SIZE - 2U)) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_CTRL9, (uint8_t *)&ctrl9, 1) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_X_OFS_USR, (uint8_t *)&Buffer[4], 3) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  ctrl9.usr_off_w = Buffer[3];
+  ctrl9.usr_off_on_out = PROPERTY_ENABLE;
+
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_CTRL9, (uint8_t *)&ctrl9, 1) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  *Data = ((float)data_raw.i16bit) / LSM6DSV16X_QVAR_GAIN;
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Get LSM6DSV16X QVAR equivalent input impedance
- * @param  val pointer where the value is written
- * @retval 0 in case of success, an error code otherwise
+ * @brief  Run the accelerometer and gyroscope self-test
+ * @note   Datasheet procedure: XL at 60 Hz and +/-4 g, gyroscope at 240 Hz and +/-2000 dps,
+ *         average of Samples outputs without and with the positive stimulus.
+ *         The settling time is counted in data-ready periods and the reference phase
+ *         is shared by both sensors. The previous configuration is restored.
+ * @param  Result pointer where the output changes and the pass flags are written
+ * @param  Samples number of averaged samples per phase
+ * @retval 0 in case of success, an error code otherwise (bus error, timeout or failed test)
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::QVAR_GetImpedance(uint16_t *val)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Run_Self_Test(LSM6DSV16X_Self_Test_Result_t *Result, uint8_t Samples)
 {
   LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
-  lsm6dsv16x_ah_qvar_zin_t imp;
+  uint8_t saved[10];
+  uint8_t ctrl[10];
+  float xl_nost[3];
+  float g_nost[3];
+  float st[3];
+  /* First sample after a change is discarded, then the settling time */
+  uint8_t xl_skip = (uint8_t)(1U + (60U * LSM6DSV16X_SELF_TEST_SETTLE_MS + 999U) / 1000U);
+  uint8_t g_skip = (uint8_t)(1U + (240U * LSM6DSV16X_SELF_TEST_SETTLE_MS + 999U) / 1000U);
 
-  if (lsm6dsv16x_ah_qvar_zin_get(&reg_ctx, &imp) != LSM6DSV16X_OK) {
-    ret = LSM6DSV16X_ERROR;
+  if (Samples == 0U) {
+    return LSM6DSV16X_ERROR;
   }
-  switch (imp) {
-    case LSM6DSV16X_2400MOhm:
-      *val = 2400;
-      break;
-    case LSM6DSV16X_730MOhm:
-      *val = 730;
-      break;
-    case LSM6DSV16X_300MOhm:
-      *val = 300;
-      break;
-    case LSM6DSV16X_255MOhm:
-      *val = 255;
-      break;
-    default:
-      ret = LSM6DSV16X_ERROR;
-      break;
+
+  (void)memset((void *)Result, 0x0, sizeof(LSM6DSV16X_Self_Test_Result_t));
+
+  /* CTRL1 .. CTRL10 */
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_CTRL1, saved, 10) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
   }
 
-  return ret;
-}
+  (void)memcpy((void *)ctrl, (void *)saved, sizeof(ctrl));
+  ((lsm6dsv16x_ctrl1_t *)&ctrl[0])->odr_xl = LSM6DSV16X_ODR_AT_60Hz;
+  ((lsm6dsv16x_ctrl1_t *)&ctrl[0])->op_mode_xl = LSM6DSV16X_XL_HIGH_PERFORMANCE_MD;
+  ((lsm6dsv16x_ctrl2_t *)&ctrl[1])->odr_g = LSM6DSV16X_ODR_AT_240Hz;
+  ((lsm6dsv16x_ctrl2_t *)&ctrl[1])->op_mode_g = LSM6DSV16X_GY_HIGH_PERFORMANCE_MD;
+  ((lsm6dsv16x_ctrl6_t *)&ctrl[5])->fs_g = LSM6DSV16X_2000dps;
+  ((lsm6dsv16x_ctrl8_t *)&ctrl[7])->fs_xl = LSM6DSV16X_4g;
+  ((lsm6dsv16x_ctrl8_t *)&ctrl[7])->xl_dualc_en = PROPERTY_DISABLE;
+  ((lsm6dsv16x_ctrl10_t *)&ctrl[9])->st_xl = LSM6DSV16X_XL_ST_DISABLE;
+  ((lsm6dsv16x_ctrl10_t *)&ctrl[9])->st_g = LSM6DSV16X_GY_ST_DISABLE;
 
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_CTRL1, ctrl, 10) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
 
-/**
- * @brief  Set LSM6DSV16X QVAR equivalent input impedance
- * @param  val impedance in MOhm (2400MOhm, 730MOhm, 300MOhm, 255MOhm)
- * @retval 0 in case of success, an error code otherwise
- */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::QVAR_SetImpedance(uint16_t val)
-{
-  LSM6DSV16XStatusTypeDef ret = LSM6DSV16X_OK;
-  lsm6dsv16x_ah_qvar_zin_t imp;
-  switch (val) {
-    case 2400:
-      imp = LSM6DSV16X_2400MOhm;
-      break;
-    case 730:
-      imp = LSM6DSV16X_730MOhm;
-      break;
-    case 300:
-      imp = LSM6DSV16X_300MOhm;
-      break;
-    case 255:
-      imp = LSM6DSV16X_255MOhm;
-      break;
-    default:
+  /* Reference for both sensors */
+  ret = FIFO_Track_Config();
+
+  if (ret == LSM6DSV16X_OK) {
+    ret = Self_Test_Average(Samples, xl_skip, g_skip, xl_nost, g_nost);
+  }
+
+  /* Accelerometer stimulus */
+  if (ret == LSM6DSV16X_OK) {
+    ((lsm6dsv16x_ctrl10_t *)&ctrl[9])->st_xl = LSM6DSV16X_XL_ST_POSITIVE;
+    if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_CTRL10, &ctrl[9], 1) != LSM6DSV16X_OK) {
       ret = LSM6DSV16X_ERROR;
-      break;
+    }
   }
-  if (ret != LSM6DSV16X_ERROR) {
-    if (lsm6dsv16x_ah_qvar_zin_set(&reg_ctx, imp) != LSM6DSV16X_OK) {
+
+  if (ret == LSM6DSV16X_OK) {
+    ret = Self_Test_Average(Samples, xl_skip, 0U, st, NULL);
+  }
+
+  if (ret == LSM6DSV16X_OK) {
+    Result->XLPass = 1U;
+    for (uint8_t i = 0U; i < 3U; i++) {
+      Result->XLDelta[i] = (st[i] > xl_nost[i]) ? st[i] - xl_nost[i] : xl_nost[i] - st[i];
+      if (Result->XLDelta[i] < LSM6DSV16X_XL_SELF_TEST_MIN_MG || Result->XLDelta[i] > LSM6DSV16X_XL_SELF_TEST_MAX_MG) {
+        Result->XLPass = 0U;
+      }
+    }
+  }
+
+  /* Gyroscope stimulus */
+  if (ret == LSM6DSV16X_OK) {
+    ((lsm6dsv16x_ctrl10_t *)&ctrl[9])->st_xl = LSM6DSV16X_XL_ST_DISABLE;
+    ((lsm6dsv16x_ctrl10_t *)&ctrl[9])->st_g = LSM6DSV16X_GY_ST_POSITIVE;
+    if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_CTRL10, &ctrl[9], 1) != LSM6DSV16X_OK) {
       ret = LSM6DSV16X_ERROR;
     }
   }
-  return ret;
+
+  if (ret == LSM6DSV16X_OK) {
+    ret = Self_Test_Average(Samples, 0U, g_skip, NULL, st);
+  }
+
+  if (ret == LSM6DSV16X_OK) {
+    Result->GPass = 1U;
+    for (uint8_t i = 0U; i < 3U; i++) {
+      Result->GDelta[i] = (st[i] > g_nost[i]) ? st[i] - g_nost[i] : g_nost[i] - st[i];
+      if (Result->GDelta[i] < LSM6DSV16X_G_SELF_TEST_MIN_MDPS || Result->GDelta[i] > LSM6DSV16X_G_SELF_TEST_MAX_MDPS) {
+        Result->GPass = 0U;
+      }
+    }
+  }
+
+  /* Stimulus off and previous configuration back, also after an error */
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_CTRL1, saved, 10) != LSM6DSV16X_OK
+      || FIFO_Track_Config() != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (ret != LSM6DSV16X_OK || Result->XLPass == 0U || Result->GPass == 0U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Read LSM6DSV16X QVAR status
- * @param  val pointer where the value is written
+ * @brief  Average the self-test outputs, polling the data-ready flags
+ * @param  Samples number of averaged samples
+ * @param  XLSkip accelerometer samples discarded first (0 to skip the accelerometer)
+ * @param  GSkip gyroscope samples discarded first (0 to skip the gyroscope)
+ * @param  XLAvg pointer where the accelerometer average is written [mg]
+ * @param  GAvg pointer where the gyroscope average is written [mdps]
  * @retval 0 in case of success, an error code otherwise
  */
-
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::QVAR_GetStatus(uint8_t *val)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Self_Test_Average(uint8_t Samples, uint8_t XLSkip, uint8_t GSkip, float *XLAvg, float *GAvg)
 {
   lsm6dsv16x_status_reg_t status;
+  lsm6dsv16x_axis3bit16_t data_raw[2];
+  int32_t xl_sum[3] = {0, 0, 0};
+  int32_t g_sum[3] = {0, 0, 0};
+  uint8_t xl_n = (XLSkip != 0U) ? 0U : Samples;
+  uint8_t g_n = (GSkip != 0U) ? 0U : Samples;
+  uint32_t start = millis();
+
+  while (xl_n < Samples || g_n < Samples) {
+    if (millis() - start > LSM6DSV16X_SELF_TEST_TIMEOUT_MS) {
+      return LSM6DSV16X_ERROR;
+    }
 
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_STATUS_REG, (uint8_t *)&status, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
+    if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_STATUS_REG, (uint8_t *)&status, 1) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+
+    status.xlda &= (xl_n < Samples) ? 1U : 0U;
+    status.gda &= (g_n < Samples) ? 1U : 0U;
+    if (status.xlda == 0U && status.gda == 0U) {
+      continue;
+    }
+
+    /* Gyroscope and accelerometer outputs are contiguous */
+    if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_OUTX_L_G, data_raw[0].u8bit, 12) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+
+    if (status.xlda != 0U) {
+      if (XLSkip > 0U) {
+        XLSkip--;
+      } else {
+        for (uint8_t i = 0U; i < 3U; i++) {
+          xl_sum[i] += data_raw[1].i16bit[i];
+        }
+        xl_n++;
+      }
+    }
+
+    if (status.gda != 0U) {
+      if (GSkip > 0U) {
+        GSkip--;
+      } else {
+        for (uint8_t i = 0U; i < 3U; i++) {
+          g_sum[i] += data_raw[0].i16bit[i];
+        }
+        g_n++;
+      }
+    }
+  }
+
+  for (uint8_t i = 0U; i < 3U; i++) {
+    if (XLAvg != NULL) {
+      XLAvg[i] = (float)xl_sum[i] / (float)Samples * LSM6DSV16X_ACC_SENSITIVITY_FS_4G;
+    }
+    if (GAvg != NULL) {
+      GAvg[i] = (float)g_sum[i] / (float)Samples * LSM6DSV16X_GYRO_SENSITIVITY_FS_2000DPS;
+    }
   }
 
-  *val = status.ah_qvarda;
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Compute the CRC-16/CCITT of a saved state
+ * @param  Buffer pointer to the data
+ * @param  Len number of bytes
+ * @retval CRC value
+ */
+uint16_t LSM6DSV16XSensor::State_Crc(const uint8_t *Buffer, uint16_t Len)
+{
+  uint16_t crc = 0xFFFFU;
+
+  for (uint16_t i = 0U; i < Len; i++) {
+    crc ^= (uint16_t)Buffer[i] << 8;
+    for (uint8_t j = 0U; j < 8U; j++) {
+      crc = (crc & 0x8000U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+    }
+  }
 
-  return LSM6DSV16X_OK;
+  return crc;
 }
 
 /**
- * @brief  Get MLC status
- * @param  status pointer where the MLC status is written
+ * @brief  Enable the LSM6DSV16X timestamp counter
+ * @note   The counter restarts from zero when it is enabled again
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_MLC_Status(lsm6dsv16x_mlc_status_mainpage_t *status)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Timestamp()
 {
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_MLC_STATUS_MAINPAGE, (uint8_t *)status, 1) != LSM6DSV16X_OK) {
+  if (lsm6dsv16x_timestamp_set(&reg_ctx, PROPERTY_ENABLE) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
@@ -3222,13 +6331,12 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_MLC_Status(lsm6dsv16x_mlc_status_m
 }
 
 /**
- * @brief  Get MLC output
- * @param  output pointer where the MLC output is written
+ * @brief  Disable the LSM6DSV16X timestamp counter
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_MLC_Output(lsm6dsv16x_mlc_out_t *output)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Timestamp()
 {
-  if (lsm6dsv16x_mlc_out_get(&reg_ctx, output) != LSM6DSV16X_OK) {
+  if (lsm6dsv16x_timestamp_set(&reg_ctx, PROPERTY_DISABLE) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
@@ -3236,374 +6344,396 @@ LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_MLC_Output(lsm6dsv16x_mlc_out_t *o
 }
 
 /**
- * @brief  Enable Rotation Vector SFLP feature
+ * @brief  Get the LSM6DSV16X timestamp counter
+ * @param  Timestamp pointer where the timestamp is written [LSB, 21.75 us typ.]
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Rotation_Vector()
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_Timestamp(uint32_t *Timestamp)
 {
-  lsm6dsv16x_fifo_sflp_raw_t fifo_sflp;
-
-  /* Set full scale */
-  if (lsm6dsv16x_xl_full_scale_set(&reg_ctx, LSM6DSV16X_4g)) {
-    return LSM6DSV16X_ERROR;
-  }
-  if (lsm6dsv16x_gy_full_scale_set(&reg_ctx, LSM6DSV16X_2000dps)) {
+  if (lsm6dsv16x_timestamp_raw_get(&reg_ctx, Timestamp) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  if (lsm6dsv16x_fifo_sflp_batch_get(&reg_ctx, &fifo_sflp)) {
-    return LSM6DSV16X_ERROR;
-  }
-  /* Enable Rotation Vector SFLP feature */
-  fifo_sflp.game_rotation = 1;
+  return LSM6DSV16X_OK;
+}
 
-  if (lsm6dsv16x_fifo_sflp_batch_set(&reg_ctx, fifo_sflp)) {
-    return LSM6DSV16X_ERROR;
-  }
+/**
+ * @brief  Get the timestamp resolution of this LSM6DSV16X part
+ * @note   The typical 21.75 us is trimmed by the factory frequency deviation in
+ *         INTERNAL_FREQ, 0.13% per LSB, which also applies to the output data rates
+ * @param  Resolution pointer where the duration of one timestamp LSB is written [us]
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_Timestamp_Resolution(float *Resolution)
+{
+  int8_t freq_fine;
 
-  /* Set FIFO mode to Stream mode (aka Continuous Mode) */
-  if (lsm6dsv16x_fifo_mode_set(&reg_ctx, LSM6DSV16X_STREAM_MODE)) {
+  if (lsm6dsv16x_odr_cal_reg_get(&reg_ctx, &freq_fine) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Set Output Data Rate */
-  if (lsm6dsv16x_xl_data_rate_set(&reg_ctx, LSM6DSV16X_ODR_AT_120Hz)) {
-    return LSM6DSV16X_ERROR;
-  }
-  if (lsm6dsv16x_gy_data_rate_set(&reg_ctx, LSM6DSV16X_ODR_AT_120Hz)) {
-    return LSM6DSV16X_ERROR;
-  }
-  if (lsm6dsv16x_sflp_data_rate_set(&reg_ctx, LSM6DSV16X_SFLP_120Hz)) {
-    return LSM6DSV16X_ERROR;
-  }
+  *Resolution = 21.75f / (1.0f + 0.0013f * (float)freq_fine);
 
-  /* Enable SFLP low power */
-  if (lsm6dsv16x_sflp_game_rotation_set(&reg_ctx, PROPERTY_ENABLE)) {
-    return LSM6DSV16X_ERROR;
-  }
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Disable Rotation Vector SFLP feature
+ * @brief  Read the main page configuration of the LSM6DSV16X
+ * @note   The embedded functions, sensor hub and user offset registers are not included
+ * @param  Image pointer where the configuration is written
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Rotation_Vector()
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_Config_Image(LSM6DSV16X_Config_Image_t *Image)
 {
-  lsm6dsv16x_fifo_sflp_raw_t fifo_sflp;
-
-  /* Set full scale */
-  if (lsm6dsv16x_xl_full_scale_set(&reg_ctx, LSM6DSV16X_4g)) {
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FIFO_CTRL1, Image->Fifo, sizeof(Image->Fifo)) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
-  if (lsm6dsv16x_gy_full_scale_set(&reg_ctx, LSM6DSV16X_2000dps)) {
+
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_CTRL1, Image->Ctrl, sizeof(Image->Ctrl)) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  if (lsm6dsv16x_fifo_sflp_batch_get(&reg_ctx, &fifo_sflp)) {
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, Image->Functions, sizeof(Image->Functions)) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
-  /* Disable Rotation Vector SFLP feature */
-  fifo_sflp.game_rotation = 0;
 
-  if (lsm6dsv16x_fifo_sflp_batch_set(&reg_ctx, fifo_sflp)) {
+  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_INACTIVITY_DUR, Image->Interrupts, sizeof(Image->Interrupts)) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Check if all SFLP features are disabled */
-  if (!fifo_sflp.game_rotation && !fifo_sflp.gravity && !fifo_sflp.gbias) {
-    /* Disable SFLP */
-    if (lsm6dsv16x_sflp_game_rotation_set(&reg_ctx, PROPERTY_DISABLE)) {
-      return LSM6DSV16X_ERROR;
-    }
-  }
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Enable Gravity Vector SFLP feature
+ * @brief  Write a main page configuration read with Get_Config_Image, one burst per register block
+ * @note   The output data rates are written last
+ * @param  Image pointer to the configuration
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Gravity_Vector()
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Set_Config_Image(const LSM6DSV16X_Config_Image_t *Image)
 {
-  lsm6dsv16x_fifo_sflp_raw_t fifo_sflp;
+  const lsm6dsv16x_ctrl1_t *ctrl1 = (const lsm6dsv16x_ctrl1_t *)&Image->Ctrl[0];
+  const lsm6dsv16x_ctrl2_t *ctrl2 = (const lsm6dsv16x_ctrl2_t *)&Image->Ctrl[1];
 
-  /* Set full scale */
-  if (lsm6dsv16x_xl_full_scale_set(&reg_ctx, LSM6DSV16X_4g)) {
-    return LSM6DSV16X_ERROR;
-  }
-  if (lsm6dsv16x_gy_full_scale_set(&reg_ctx, LSM6DSV16X_2000dps)) {
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_FIFO_CTRL1, (uint8_t *)Image->Fifo, sizeof(Image->Fifo)) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  if (lsm6dsv16x_fifo_sflp_batch_get(&reg_ctx, &fifo_sflp)) {
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_FUNCTIONS_ENABLE, (uint8_t *)Image->Functions, sizeof(Image->Functions)) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
-  /* Enable Gravity Vector SFLP feature */
-  fifo_sflp.gravity = 1;
 
-  if (lsm6dsv16x_fifo_sflp_batch_set(&reg_ctx, fifo_sflp)) {
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_INACTIVITY_DUR, (uint8_t *)Image->Interrupts, sizeof(Image->Interrupts)) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Set FIFO mode to Stream mode (aka Continuous Mode) */
-  if (lsm6dsv16x_fifo_mode_set(&reg_ctx, LSM6DSV16X_STREAM_MODE)) {
+  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_CTRL1, (uint8_t *)Image->Ctrl, sizeof(Image->Ctrl)) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Set Output Data Rate */
-  if (lsm6dsv16x_xl_data_rate_set(&reg_ctx, LSM6DSV16X_ODR_AT_120Hz)) {
-    return LSM6DSV16X_ERROR;
-  }
-  if (lsm6dsv16x_gy_data_rate_set(&reg_ctx, LSM6DSV16X_ODR_AT_120Hz)) {
-    return LSM6DSV16X_ERROR;
+  /* Keep the cached state consistent with the new configuration */
+  acc_is_enabled = (ctrl1->odr_xl != 0U) ? 1U : 0U;
+  if (acc_is_enabled != 0U) {
+    acc_odr = (lsm6dsv16x_data_rate_t)ctrl1->odr_xl;
   }
-  if (lsm6dsv16x_sflp_data_rate_set(&reg_ctx, LSM6DSV16X_SFLP_120Hz)) {
-    return LSM6DSV16X_ERROR;
+  gyro_is_enabled = (ctrl2->odr_g != 0U) ? 1U : 0U;
+  if (gyro_is_enabled != 0U) {
+    gyro_odr = (lsm6dsv16x_data_rate_t)ctrl2->odr_g;
   }
+  acc_sensitivity = 0.0f;
+  gyro_sensitivity = 0.0f;
 
-  /* Enable SFLP low power */
-  if (lsm6dsv16x_sflp_game_rotation_set(&reg_ctx, PROPERTY_ENABLE)) {
+  if (FIFO_Track_Config() != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
-  return LSM6DSV16X_OK;
+
+  /* The image replaced the interrupt routing */
+  return Sync_Interrupt_Routing();
 }
 
 /**
- * @brief  Disable Gravity Vector SFLP feature
+ * @brief  Get the LSM6DSV16X register value
+ * @param  Reg address to be read
+ * @param  Data pointer where the value is written
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Gravity_Vector()
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Read_Reg(uint8_t Reg, uint8_t *Data)
 {
-  lsm6dsv16x_fifo_sflp_raw_t fifo_sflp;
-
-  /* Set full scale */
-  if (lsm6dsv16x_xl_full_scale_set(&reg_ctx, LSM6DSV16X_4g)) {
-    return LSM6DSV16X_ERROR;
-  }
-  if (lsm6dsv16x_gy_full_scale_set(&reg_ctx, LSM6DSV16X_2000dps)) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  if (lsm6dsv16x_fifo_sflp_batch_get(&reg_ctx, &fifo_sflp)) {
-    return LSM6DSV16X_ERROR;
-  }
-  /* Disable Gravity Vector SFLP feature */
-  fifo_sflp.gravity = 0;
-
-  if (lsm6dsv16x_fifo_sflp_batch_set(&reg_ctx, fifo_sflp)) {
+  if (lsm6dsv16x_read_reg(&reg_ctx, Reg, Data, 1) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Check if all SFLP features are disabled */
-  if (!fifo_sflp.game_rotation && !fifo_sflp.gravity && !fifo_sflp.gbias) {
-    /* Disable SFLP */
-    if (lsm6dsv16x_sflp_game_rotation_set(&reg_ctx, PROPERTY_DISABLE)) {
-      return LSM6DSV16X_ERROR;
-    }
-  }
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Enable Gyroscope Bias SFLP feature
+ * @brief  Get consecutive LSM6DSV16X register values in a single bus transaction
+ * @param  Reg address of the first register to be read
+ * @param  Data pointer where the values are written
+ * @param  Len number of registers to be read
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Enable_Gyroscope_Bias()
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Read_Regs(uint8_t Reg, uint8_t *Data, uint16_t Len)
 {
-  lsm6dsv16x_fifo_sflp_raw_t fifo_sflp;
-
-  /* Set full scale */
-  if (lsm6dsv16x_xl_full_scale_set(&reg_ctx, LSM6DSV16X_4g)) {
-    return LSM6DSV16X_ERROR;
-  }
-  if (lsm6dsv16x_gy_full_scale_set(&reg_ctx, LSM6DSV16X_2000dps)) {
+  if (lsm6dsv16x_read_reg(&reg_ctx, Reg, Data, Len) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  if (lsm6dsv16x_fifo_sflp_batch_get(&reg_ctx, &fifo_sflp)) {
-    return LSM6DSV16X_ERROR;
-  }
-  /* Enable Gyroscope Bias SFLP feature */
-  fifo_sflp.gbias = 1;
+  return LSM6DSV16X_OK;
+}
 
-  if (lsm6dsv16x_fifo_sflp_batch_set(&reg_ctx, fifo_sflp)) {
-    return LSM6DSV16X_ERROR;
+/**
+ * @brief  Set the LSM6DSV16X register value
+ * @param  Reg address to be written
+ * @param  Data value to be written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Write_Reg(uint8_t Reg, uint8_t Data)
+{
+  /* Full scale may change behind the cached sensitivities */
+  if (Reg == LSM6DSV16X_CTRL6) {
+    gyro_sensitivity = 0.0f;
   }
-
-  /* Set FIFO mode to Stream mode (aka Continuous Mode) */
-  if (lsm6dsv16x_fifo_mode_set(&reg_ctx, LSM6DSV16X_STREAM_MODE)) {
-    return LSM6DSV16X_ERROR;
+  if (Reg == LSM6DSV16X_CTRL8) {
+    acc_sensitivity = 0.0f;
   }
 
-  /* Set Output Data Rate */
-  if (lsm6dsv16x_xl_data_rate_set(&reg_ctx, LSM6DSV16X_ODR_AT_120Hz)) {
-    return LSM6DSV16X_ERROR;
-  }
-  if (lsm6dsv16x_gy_data_rate_set(&reg_ctx, LSM6DSV16X_ODR_AT_120Hz)) {
-    return LSM6DSV16X_ERROR;
-  }
-  if (lsm6dsv16x_sflp_data_rate_set(&reg_ctx, LSM6DSV16X_SFLP_120Hz)) {
+  if (lsm6dsv16x_write_reg(&reg_ctx, Reg, &Data, 1) != LSM6DSV16X_OK) {
     return LSM6DSV16X_ERROR;
   }
 
-  /* Enable SFLP low power */
-  if (lsm6dsv16x_sflp_game_rotation_set(&reg_ctx, PROPERTY_ENABLE)) {
-    return LSM6DSV16X_ERROR;
-  }
   return LSM6DSV16X_OK;
 }
 
 /**
- * @brief  Disable Gyroscope Bias SFLP feature
+ * @brief  Open an SPI transaction kept across the following register accesses
+ * @note   Saves the SPISettings setup of every access during bursts of operations.
+ *         The bus must not be used by other devices until End_Bus_Transaction.
+ *         No effect on I2C.
  * @retval 0 in case of success, an error code otherwise
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Disable_Gyroscope_Bias()
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Begin_Bus_Transaction()
 {
-  lsm6dsv16x_fifo_sflp_raw_t fifo_sflp;
-
-  /* Set full scale */
-  if (lsm6dsv16x_xl_full_scale_set(&reg_ctx, LSM6DSV16X_4g)) {
-    return LSM6DSV16X_ERROR;
-  }
-  if (lsm6dsv16x_gy_full_scale_set(&reg_ctx, LSM6DSV16X_2000dps)) {
-    return LSM6DSV16X_ERROR;
+  if (dev_spi && !bus_held) {
+    dev_spi->beginTransaction(SPISettings(spi_speed, MSBFIRST, SPI_MODE3));
+    bus_held = 1U;
   }
 
-  if (lsm6dsv16x_fifo_sflp_batch_get(&reg_ctx, &fifo_sflp)) {
-    return LSM6DSV16X_ERROR;
-  }
-  /* Disable Gyroscope Bias SFLP feature */
-  fifo_sflp.gbias = 0;
-
-  if (lsm6dsv16x_fifo_sflp_batch_set(&reg_ctx, fifo_sflp)) {
-    return LSM6DSV16X_ERROR;
-  }
-
-  /* Check if all SFLP features are disabled */
-  if (!fifo_sflp.game_rotation && !fifo_sflp.gravity && !fifo_sflp.gbias) {
-    /* Disable SFLP */
-    if (lsm6dsv16x_sflp_game_rotation_set(&reg_ctx, PROPERTY_DISABLE)) {
-      return LSM6DSV16X_ERROR;
-    }
-  }
   return LSM6DSV16X_OK;
 }
 
 /**
-  * @brief  Get the Rotation Vector values
-  * @param  rvec pointer where the Rotation Vector values are written
-  * @retval 0 in case of success, an error code otherwise
-  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Rotation_Vector(float *rvec)
+ * @brief  Close the SPI transaction opened by Begin_Bus_Transaction
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::End_Bus_Transaction()
 {
-  lsm6dsv16x_axis3bit16_t data_raw;
-
-  if (FIFO_Get_Data(data_raw.u8bit) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
+  if (dev_spi && bus_held) {
+    dev_spi->endTransaction();
+    bus_held = 0U;
   }
-  sflp2q(rvec, (uint16_t *)&data_raw.i16bit[0]);
 
   return LSM6DSV16X_OK;
 }
 
 /**
-  * @brief  Get the Gravity Vector values
-  * @param  gvec pointer where the Gravity Vector values are written
-  * @retval 0 in case of success, an error code otherwise
-  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Gravity_Vector(float *gvec)
+ * @brief  Get the bus traffic generated since the last counters reset
+ * @param  Stats pointer where the bus counters are written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_Bus_Stats(LSM6DSV16X_Bus_Stats_t *Stats)
 {
-  lsm6dsv16x_axis3bit16_t data_raw;
+  *Stats = bus_stats;
 
-  if (FIFO_Get_Data(data_raw.u8bit) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
+  return LSM6DSV16X_OK;
+}
 
-  gvec[0] = lsm6dsv16x_from_sflp_to_mg(data_raw.i16bit[0]);
-  gvec[1] = lsm6dsv16x_from_sflp_to_mg(data_raw.i16bit[1]);
-  gvec[2] = lsm6dsv16x_from_sflp_to_mg(data_raw.i16bit[2]);
+/**
+ * @brief  Reset the bus traffic counters
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Reset_Bus_Stats()
+{
+  (void)memset((void *)&bus_stats, 0x0, sizeof(LSM6DSV16X_Bus_Stats_t));
 
   return LSM6DSV16X_OK;
 }
 
 /**
-  * @brief  Get the Gravity Bias values
-  * @param  gbias pointer where the Gravity Bias values are written
-  * @retval 0 in case of success, an error code otherwise
-  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::FIFO_Get_Gyroscope_Bias(float *gbias)
+ * @brief  Compute the modeled wire time of a set of bus transactions
+ * @param  Stats bus counters to be converted
+ * @param  Bus bus type used for the model (I2C or SPI)
+ * @param  ClockHz bus clock frequency [Hz]
+ * @param  TimeUs pointer where the wire time [us] is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_Bus_Wire_Time(LSM6DSV16X_Bus_Stats_t *Stats, LSM6DSV16X_Bus_t Bus, uint32_t ClockHz, float *TimeUs)
 {
-  lsm6dsv16x_axis3bit16_t data_raw;
+  float bits;
 
-  if (FIFO_Get_Data(data_raw.u8bit) != LSM6DSV16X_OK) {
+  if (ClockHz == 0U) {
     return LSM6DSV16X_ERROR;
   }
 
-  gbias[0] = lsm6dsv16x_from_fs125_to_mdps(data_raw.i16bit[0]);
-  gbias[1] = lsm6dsv16x_from_fs125_to_mdps(data_raw.i16bit[1]);
-  gbias[2] = lsm6dsv16x_from_fs125_to_mdps(data_raw.i16bit[2]);
+  switch (Bus) {
+    case LSM6DSV16X_I2C_BUS:
+      bits = (float)Stats->ReadTransactions * LSM6DSV16X_I2C_READ_OVERHEAD_BITS
+             + (float)Stats->WriteTransactions * LSM6DSV16X_I2C_WRITE_OVERHEAD_BITS
+             + (float)(Stats->ReadBytes + Stats->WriteBytes) * LSM6DSV16X_I2C_BITS_PER_BYTE;
+      break;
+
+    case LSM6DSV16X_SPI_BUS:
+      bits = (float)(Stats->ReadTransactions + Stats->WriteTransactions) * LSM6DSV16X_SPI_OVERHEAD_BITS
+             + (float)(Stats->ReadBytes + Stats->WriteBytes) * LSM6DSV16X_SPI_BITS_PER_BYTE;
+      break;
+
+    default:
+      return LSM6DSV16X_ERROR;
+  }
+
+  *TimeUs = (bits * 1000000.0f) / (float)ClockHz;
 
   return LSM6DSV16X_OK;
 }
 
 /**
-  * @brief Reset SFLP
-  * @retval 0 in case of success, an error code otherwise
-  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Reset_SFLP(void)
+ * @brief  Get the interrupt-to-consume latency statistics of a trace channel
+ * @param  Channel latency channel (interrupt to bus start, bus transfer, interrupt to end of the FIFO read)
+ * @param  Stats pointer where the latency statistics [us] are written
+ * @retval 0 in case of success, an error code otherwise (also when LSM6DSV16X_LATENCY_TRACE is disabled)
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Get_Latency_Stats(LSM6DSV16X_Latency_Channel_t Channel, LSM6DSV16X_Latency_Stats_t *Stats)
 {
-  lsm6dsv16x_emb_func_init_a_t emb_func_init_a;
+#if LSM6DSV16X_LATENCY_TRACE
+  uint32_t p50_rank;
+  uint32_t p99_rank;
+  uint32_t cumulative = 0;
+  uint8_t i;
 
-  if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_EMBED_FUNC_MEM_BANK) != LSM6DSV16X_OK) {
+  if (Channel >= LSM6DSV16X_LATENCY_CHANNELS) {
     return LSM6DSV16X_ERROR;
   }
 
-  if (lsm6dsv16x_read_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INIT_A, (uint8_t *)&emb_func_init_a, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
+  (void)memset((void *)Stats, 0x0, sizeof(LSM6DSV16X_Latency_Stats_t));
+  Stats->Count = latency_count[Channel];
+
+  if (Stats->Count == 0U) {
+    return LSM6DSV16X_OK;
   }
 
-  emb_func_init_a.sflp_game_init = 1;
+  Stats->MinUs = latency_min[Channel];
+  Stats->MaxUs = latency_max[Channel];
 
-  if (lsm6dsv16x_write_reg(&reg_ctx, LSM6DSV16X_EMB_FUNC_INIT_A, (uint8_t *)&emb_func_init_a, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
+  /* Percentiles are reported as the upper bound of the bucket holding the requested rank */
+  p50_rank = (Stats->Count + 1U) / 2U;
+  p99_rank = Stats->Count - (Stats->Count / 100U);
+
+  for (i = 0; i < LSM6DSV16X_LATENCY_BUCKETS; i++) {
+    cumulative += latency_hist[Channel][i];
+
+    if (Stats->P50Us == 0U && cumulative >= p50_rank) {
+      Stats->P50Us = Latency_Bucket_Bound(i + 1) - 1U;
+    }
+
+    if (cumulative >= p99_rank) {
+      Stats->P99Us = Latency_Bucket_Bound(i + 1) - 1U;
+      break;
+    }
   }
 
-  if (lsm6dsv16x_mem_bank_set(&reg_ctx, LSM6DSV16X_MAIN_MEM_BANK) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
+  if (Stats->P50Us > Stats->MaxUs) {
+    Stats->P50Us = Stats->MaxUs;
+  }
+
+  if (Stats->P99Us > Stats->MaxUs) {
+    Stats->P99Us = Stats->MaxUs;
   }
+
   return LSM6DSV16X_OK;
+#else
+  (void)Channel;
+  (void)Stats;
+
+  return LSM6DSV16X_ERROR;
+#endif
 }
 
 /**
- * @brief  Get the LSM6DSV16X register value
- * @param  Reg address to be read
- * @param  Data pointer where the value is written
- * @retval 0 in case of success, an error code otherwise
+ * @brief  Reset the interrupt-to-consume latency histograms
+ * @retval 0 in case of success, an error code otherwise (also when LSM6DSV16X_LATENCY_TRACE is disabled)
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Read_Reg(uint8_t Reg, uint8_t *Data)
+LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Reset_Latency_Stats()
 {
-  if (lsm6dsv16x_read_reg(&reg_ctx, Reg, Data, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
-  }
+#if LSM6DSV16X_LATENCY_TRACE
+  (void)memset((void *)latency_hist, 0x0, sizeof(latency_hist));
+  (void)memset((void *)latency_count, 0x0, sizeof(latency_count));
+  (void)memset((void *)latency_min, 0xFF, sizeof(latency_min));
+  (void)memset((void *)latency_max, 0x0, sizeof(latency_max));
+  irq_pending = 0;
 
   return LSM6DSV16X_OK;
+#else
+  return LSM6DSV16X_ERROR;
+#endif
 }
 
+#if LSM6DSV16X_LATENCY_TRACE
 /**
- * @brief  Set the LSM6DSV16X register value
- * @param  Reg address to be written
- * @param  Data value to be written
- * @retval 0 in case of success, an error code otherwise
+ * @brief  Add a latency sample to the histogram of a trace channel
+ * @param  Channel latency channel
+ * @param  Us latency [us]
  */
-LSM6DSV16XStatusTypeDef LSM6DSV16XSensor::Write_Reg(uint8_t Reg, uint8_t Data)
+void LSM6DSV16XSensor::Latency_Record(LSM6DSV16X_Latency_Channel_t Channel, uint32_t Us)
 {
-  if (lsm6dsv16x_write_reg(&reg_ctx, Reg, &Data, 1) != LSM6DSV16X_OK) {
-    return LSM6DSV16X_ERROR;
+  uint8_t bucket;
+  uint8_t msb;
+
+  /* Two buckets per octave: the top bit selects the octave, the next one the half */
+  if (Us < 2U) {
+    bucket = (uint8_t)Us;
+  } else {
+    msb = (uint8_t)(31 - __builtin_clz(Us));
+    bucket = (uint8_t)(2U * msb + ((Us >> (msb - 1U)) & 0x01U));
   }
 
-  return LSM6DSV16X_OK;
+  if (bucket >= LSM6DSV16X_LATENCY_BUCKETS) {
+    bucket = LSM6DSV16X_LATENCY_BUCKETS - 1U;
+  }
+
+  latency_hist[Channel][bucket]++;
+  latency_count[Channel]++;
+
+  if (Us < latency_min[Channel]) {
+    latency_min[Channel] = Us;
+  }
+
+  if (Us > latency_max[Channel]) {
+    latency_max[Channel] = Us;
+  }
+}
+
+/**
+ * @brief  Get the lower bound of a latency histogram bucket
+ * @param  Bucket bucket index
+ * @retval lower bound of the bucket [us]
+ */
+uint32_t LSM6DSV16XSensor::Latency_Bucket_Bound(uint8_t Bucket)
+{
+  uint8_t msb;
+
+  if (Bucket < 2U) {
+    return Bucket;
+  }
+
+  if (Bucket >= LSM6DSV16X_LATENCY_BUCKETS) {
+    return 0xFFFFFFFFU;
+  }
+
+  msb = Bucket / 2U;
+
+  return (1UL << msb) | ((uint32_t)(Bucket & 0x01U) << (msb - 1U));
 }
+#endif
 
 int32_t LSM6DSV16X_io_write(void *handle, uint8_t WriteAddr, uint8_t *pBuffer, uint16_t nBytesToWrite)
 {
@@ -3615,6 +6745,11 @@ int32_t LSM6DSV16X_io_read(void *handle, uint8_t ReadAddr, uint8_t *pBuffer, uin
   return ((LSM6DSV16XSensor *)handle)->IO_Read(pBuffer, ReadAddr, nBytesToRead);
 }
 
+void LSM6DSV16X_delay(uint32_t millisec)
+{
+  delay(millisec);
+}
+
 /**
  * @brief  Converts uint16_t half-precision number into a uint32_t single-precision number.
  * @param  h half-precision number
@@ -71,6 +71,91 @@
 
 #define LSM6DSV16X_QVAR_GAIN  78.000f
 
+/* Accelerometer dual channel, the second channel is always at 16 g */
+#define LSM6DSV16X_XL_DUAL_SENSITIVITY  LSM6DSV16X_ACC_SENSITIVITY_FS_16G
+#define LSM6DSV16X_XL_HDR_SWITCH_LSB    32000 /* First channel output where the second one is used */
+
+/* Thermal compensation: operating temperature range and largest sensitivity drift accepted over it */
+#define LSM6DSV16X_THERMAL_MIN_C      -40.0f
+#define LSM6DSV16X_THERMAL_MAX_C       85.0f
+#define LSM6DSV16X_THERMAL_MAX_DRIFT    0.5f /* Relative, the gain stays within 1/1.5 and 1/0.5 */
+
+/* Activity/inactivity power manager defaults, changed with Set_Wake_Up_Threshold and Set_Sleep_Duration */
+#define LSM6DSV16X_ACTIVITY_WAKE_THS   2U /* Wake-up threshold [WAKE_UP_THS LSB] */
+#define LSM6DSV16X_ACTIVITY_SLEEP_DUR  2U /* Inactivity duration before sleep [512 / accelerometer ODR] */
+
+#define LSM6DSV16X_SH_MAX_SLAVES   4U
+#define LSM6DSV16X_SH_TIMEOUT_MS  50U /* Sensor hub single cycle timeout */
+
+/* Serialized SFLP state: magic, version, rate, outputs, reserved, 3 x bias [udps], CRC-16 */
+#define LSM6DSV16X_SFLP_STATE_SIZE     20U
+#define LSM6DSV16X_SFLP_STATE_MAGIC    0x5346U
+#define LSM6DSV16X_SFLP_STATE_VERSION  1U
+
+/* Accelerometer user offset, the weight is selected by CTRL9.USR_OFF_W */
+#define LSM6DSV16X_XL_OFFSET_LSB_LOW    0.9765625f /* 2^-10 g [mg/LSB] */
+#define LSM6DSV16X_XL_OFFSET_LSB_HIGH  15.625f     /* 2^-6 g [mg/LSB] */
+#define LSM6DSV16X_XL_CAL_SAMPLES      64U   /* Static samples needed on each axis */
+#define LSM6DSV16X_XL_CAL_MOTION_MG    20.0f /* Max change between two static samples [mg] */
+#define LSM6DSV16X_XL_OFFSET_STATE_SIZE     10U
+#define LSM6DSV16X_XL_OFFSET_STATE_MAGIC    0x584FU
+#define LSM6DSV16X_XL_OFFSET_STATE_VERSION  1U
+
+/* Self-test, datasheet procedure and limits */
+#define LSM6DSV16X_SELF_TEST_SAMPLES      5U      /* Default number of averaged samples */
+#define LSM6DSV16X_SELF_TEST_SETTLE_MS    100U    /* Settling time after a configuration change */
+#define LSM6DSV16X_SELF_TEST_TIMEOUT_MS   1000U   /* Max time of a single phase */
+#define LSM6DSV16X_XL_SELF_TEST_MIN_MG    50.0f
+#define LSM6DSV16X_XL_SELF_TEST_MAX_MG    1700.0f
+#define LSM6DSV16X_G_SELF_TEST_MIN_MDPS   150000.0f
+#define LSM6DSV16X_G_SELF_TEST_MAX_MDPS   700000.0f
+
+/* Bus cost model: bit times per transaction and per data byte */
+#define LSM6DSV16X_I2C_READ_OVERHEAD_BITS   30U /* START, ADDR+W, REG, RESTART, ADDR+R, STOP */
+#define LSM6DSV16X_I2C_WRITE_OVERHEAD_BITS  20U /* START, ADDR+W, REG, STOP */
+#define LSM6DSV16X_I2C_BITS_PER_BYTE         9U /* 8 data bits + ACK */
+#define LSM6DSV16X_SPI_OVERHEAD_BITS         8U /* Register address byte */
+#define LSM6DSV16X_SPI_BITS_PER_BYTE         8U
+
+/* FIFO words (tag + 6 data bytes) read in a single bus burst */
+#ifndef LSM6DSV16X_FIFO_BURST_WORDS
+  #define LSM6DSV16X_FIFO_BURST_WORDS  4U
+#endif
+#define LSM6DSV16X_FIFO_WORD_SIZE  7U
+
+/* Receive buffer of the Wire library, a longer I2C read would be cut short */
+#ifndef LSM6DSV16X_I2C_BUFFER_SIZE
+  #if defined(I2C_BUFFER_LENGTH)
+    #define LSM6DSV16X_I2C_BUFFER_SIZE  I2C_BUFFER_LENGTH
+  #elif defined(BUFFER_LENGTH)
+    #define LSM6DSV16X_I2C_BUFFER_SIZE  BUFFER_LENGTH
+  #elif defined(SERIAL_BUFFER_SIZE)
+    #define LSM6DSV16X_I2C_BUFFER_SIZE  SERIAL_BUFFER_SIZE
+  #else
+    #define LSM6DSV16X_I2C_BUFFER_SIZE  32U
+  #endif
+#endif
+
+/* Longest FIFO burst on I2C: it must fit the Wire buffer and the 8-bit requestFrom length */
+#define LSM6DSV16X_I2C_BURST_WORDS  ((LSM6DSV16X_I2C_BUFFER_SIZE < 255U ? LSM6DSV16X_I2C_BUFFER_SIZE : 255U) / LSM6DSV16X_FIFO_WORD_SIZE)
+
+/* Configurations kept for the FIFO words still to be decoded, one per CFG_CHANGE word */
+#define LSM6DSV16X_FIFO_CFG_EPOCHS  4U
+
+/* Interrupt routing manager, masks of LSM6DSV16X_Int_Source_t bits */
+#define LSM6DSV16X_INT_ROUTE_EMB_SOURCES    ((1UL << LSM6DSV16X_INT_STEP_DETECTOR) | (1UL << LSM6DSV16X_INT_TILT) \
+                                             | (1UL << LSM6DSV16X_INT_SIG_MOT) | (1UL << LSM6DSV16X_INT_FSM_LC))
+#define LSM6DSV16X_INT_ROUTE_BASIC_SOURCES  ((1UL << LSM6DSV16X_INT_6D) | (1UL << LSM6DSV16X_INT_SINGLE_TAP) \
+                                             | (1UL << LSM6DSV16X_INT_DOUBLE_TAP) | (1UL << LSM6DSV16X_INT_WAKE_UP) \
+                                             | (1UL << LSM6DSV16X_INT_FREE_FALL) | (1UL << LSM6DSV16X_INT_SLEEP_CHANGE))
+#define LSM6DSV16X_INT_ROUTE_EMB_FUNC       (1UL << LSM6DSV16X_INT_SOURCE_NUMBER) /* MDx_CFG.INTx_EMB_FUNC */
+
+/* Interrupt-to-consume latency tracing (must be defined as a global build flag) */
+#ifndef LSM6DSV16X_LATENCY_TRACE
+  #define LSM6DSV16X_LATENCY_TRACE  0
+#endif
+#define LSM6DSV16X_LATENCY_BUCKETS  40U /* Half-octave buckets, 0 us .. ~1 s */
+
 /* Typedefs ------------------------------------------------------------------*/
 
 typedef enum {
@@ -83,6 +168,27 @@ typedef enum {
   LSM6DSV16X_INT2_PIN,
 } LSM6DSV16X_SensorIntPin_t;
 
+/* Interrupt sources shared through the routing manager */
+typedef enum {
+  LSM6DSV16X_INT_DRDY_XL,
+  LSM6DSV16X_INT_DRDY_G,
+  LSM6DSV16X_INT_FIFO_TH,
+  LSM6DSV16X_INT_FIFO_OVR,
+  LSM6DSV16X_INT_FIFO_FULL,
+  LSM6DSV16X_INT_CNT_BDR,
+  LSM6DSV16X_INT_6D,
+  LSM6DSV16X_INT_SINGLE_TAP,
+  LSM6DSV16X_INT_DOUBLE_TAP,
+  LSM6DSV16X_INT_WAKE_UP,
+  LSM6DSV16X_INT_FREE_FALL,
+  LSM6DSV16X_INT_SLEEP_CHANGE,
+  LSM6DSV16X_INT_STEP_DETECTOR,
+  LSM6DSV16X_INT_TILT,
+  LSM6DSV16X_INT_SIG_MOT,
+  LSM6DSV16X_INT_FSM_LC,
+  LSM6DSV16X_INT_SOURCE_NUMBER
+} LSM6DSV16X_Int_Source_t;
+
 typedef struct {
   unsigned int FreeFallStatus : 1;
   unsigned int TapStatus : 1;
@@ -92,6 +198,7 @@ typedef struct {
   unsigned int TiltStatus : 1;
   unsigned int D6DOrientationStatus : 1;
   unsigned int SleepStatus : 1;
+  unsigned int SignificantMotionStatus : 1;
 } LSM6DSV16X_Event_Status_t;
 
 typedef union {
@@ -120,6 +227,108 @@ typedef enum {
   LSM6DSV16X_GYRO_LOW_POWER_MODE
 } LSM6DSV16X_GYRO_Operating_Mode_t;
 
+typedef enum {
+  LSM6DSV16X_I2C_BUS,
+  LSM6DSV16X_SPI_BUS
+} LSM6DSV16X_Bus_t;
+
+typedef struct {
+  uint32_t ReadTransactions;
+  uint32_t WriteTransactions;
+  uint32_t ReadBytes;
+  uint32_t WriteBytes;
+} LSM6DSV16X_Bus_Stats_t;
+
+typedef struct {
+  uint8_t Tag;
+  uint8_t Cnt;
+  uint8_t Data[6];
+  uint8_t Cfg;  /* Configuration the word was produced with, when tracked */
+} LSM6DSV16X_FIFO_Word_t;
+
+typedef enum {
+  LSM6DSV16X_LATENCY_IRQ_TO_BUS,
+  LSM6DSV16X_LATENCY_BUS_TRANSFER,
+  LSM6DSV16X_LATENCY_IRQ_TO_READ_END,
+  LSM6DSV16X_LATENCY_CHANNELS
+} LSM6DSV16X_Latency_Channel_t;
+
+typedef struct {
+  uint32_t Count;
+  uint32_t MinUs;
+  uint32_t P50Us;
+  uint32_t P99Us;
+  uint32_t MaxUs;
+} LSM6DSV16X_Latency_Stats_t;
+
+typedef enum {
+  LSM6DSV16X_CAPTURE_WAKE_UP,
+  LSM6DSV16X_CAPTURE_SINGLE_TAP,
+  LSM6DSV16X_CAPTURE_DOUBLE_TAP,
+  LSM6DSV16X_CAPTURE_FREE_FALL,
+  LSM6DSV16X_CAPTURE_6D_ORIENTATION
+} LSM6DSV16X_Capture_Trigger_t;
+
+typedef enum {
+  LSM6DSV16X_CAPTURE_PRE_TRIGGER,  /* Samples before the event, then after it until the depth is reached (Continuous-to-FIFO) */
+  LSM6DSV16X_CAPTURE_POST_TRIGGER  /* Samples after the event (Bypass-to-FIFO) */
+} LSM6DSV16X_Capture_Window_t;
+
+typedef enum {
+  LSM6DSV16X_ACTIVITY_STATE,
+  LSM6DSV16X_INACTIVITY_STATE
+} LSM6DSV16X_Activity_State_t;
+
+typedef void (*LSM6DSV16X_Activity_Callback_t)(LSM6DSV16X_Activity_State_t State);
+
+typedef struct {
+  uint32_t Words;          /* Words read with FIFO_Get_Words */
+  uint32_t Overruns;       /* Overrun events, from the latched overrun flag */
+  uint32_t FullHits;       /* Times the FIFO was found full */
+  uint32_t WatermarkHits;  /* Times the FIFO was found at or above the watermark */
+  uint32_t LostSamples;    /* Estimated time slots lost, from tag counter gaps and timestamps */
+  uint32_t DroppedConfigs; /* Tracked configurations dropped before their words were decoded */
+  uint16_t MaxLevel;       /* Highest FIFO level observed */
+} LSM6DSV16X_FIFO_Stats_t;
+
+typedef void (*LSM6DSV16X_FIFO_Loss_Callback_t)(uint32_t Lost, const LSM6DSV16X_FIFO_Stats_t *Stats);
+
+/* Main page configuration registers, in register order */
+typedef struct {
+  uint8_t Fifo[8];        /* FIFO_CTRL1 .. INT2_CTRL */
+  uint8_t Ctrl[10];       /* CTRL1 .. CTRL10 */
+  uint8_t Functions[2];   /* FUNCTIONS_ENABLE, DEN */
+  uint8_t Interrupts[12]; /* INACTIVITY_DUR .. MD2_CFG */
+} LSM6DSV16X_Config_Image_t;
+
+typedef struct {
+  float XLDelta[3];  /* Output change with the stimulus [mg] */
+  float GDelta[3];   /* Output change with the stimulus [mdps] */
+  uint8_t XLPass;
+  uint8_t GPass;
+} LSM6DSV16X_Self_Test_Result_t;
+
+typedef enum {
+  LSM6DSV16X_SFLP_OUT_GAME_ROTATION = 0x01,
+  LSM6DSV16X_SFLP_OUT_GRAVITY       = 0x02,
+  LSM6DSV16X_SFLP_OUT_GYRO_BIAS     = 0x04,
+  LSM6DSV16X_SFLP_OUT_ALL           = 0x07
+} LSM6DSV16X_SFLP_Output_t;
+
+typedef struct {
+  float Value;         /* QVAR output [mV] */
+  uint32_t Timestamp;  /* Timestamp of the read [LSB, 21.75 us typ.] */
+} LSM6DSV16X_QVAR_Sample_t;
+
+/* Linear drift of each axis with the temperature, relative to Reference */
+typedef struct {
+  float Reference;         /* Temperature of the zero-drift point [degC] */
+  float XLOffset[3];       /* Accelerometer zero-g drift [mg/degC] */
+  float XLSensitivity[3];  /* Accelerometer relative sensitivity drift [1/degC] */
+  float GOffset[3];        /* Gyroscope zero-rate drift [mdps/degC] */
+  float GSensitivity[3];   /* Gyroscope relative sensitivity drift [1/degC] */
+} LSM6DSV16X_Thermal_Model_t;
+
 
 /* Class Declaration ---------------------------------------------------------*/
 
@@ -148,6 +357,11 @@ class LSM6DSV16XSensor {
     LSM6DSV16XStatusTypeDef Get_X_Event_Status(LSM6DSV16X_Event_Status_t *Status);
     LSM6DSV16XStatusTypeDef Set_X_Power_Mode(uint8_t PowerMode);
     LSM6DSV16XStatusTypeDef Set_X_Filter_Mode(uint8_t LowHighPassFlag, uint8_t FilterMode);
+    LSM6DSV16XStatusTypeDef Enable_X_Dual_Channel();
+    LSM6DSV16XStatusTypeDef Disable_X_Dual_Channel();
+    LSM6DSV16XStatusTypeDef Get_X_Dual_AxesRaw(int16_t *Channel1, int16_t *Channel2);
+    LSM6DSV16XStatusTypeDef Get_X_Dual_Axes(float *Channel1, float *Channel2);
+    LSM6DSV16XStatusTypeDef Get_X_HDR_Axes(float *Acceleration);
 
     LSM6DSV16XStatusTypeDef Enable_G();
     LSM6DSV16XStatusTypeDef Disable_G();
@@ -162,6 +376,22 @@ class LSM6DSV16XSensor {
     LSM6DSV16XStatusTypeDef Set_G_Power_Mode(uint8_t PowerMode);
     LSM6DSV16XStatusTypeDef Set_G_Filter_Mode(uint8_t LowHighPassFlag, uint8_t FilterMode);
 
+    LSM6DSV16XStatusTypeDef Get_XG_AxesRaw(int16_t *AngularRate, int16_t *Acceleration, int16_t *Temperature = NULL);
+    LSM6DSV16XStatusTypeDef Get_XG_Axes(int32_t *AngularRate, int32_t *Acceleration, float *Temperature = NULL);
+
+    LSM6DSV16XStatusTypeDef Get_Temperature_Raw(int16_t *Value);
+    LSM6DSV16XStatusTypeDef Get_Temperature(float *Temperature);
+    LSM6DSV16XStatusTypeDef Enable_Thermal_Compensation(const LSM6DSV16X_Thermal_Model_t *Model);
+    LSM6DSV16XStatusTypeDef Disable_Thermal_Compensation();
+    static LSM6DSV16XStatusTypeDef Check_Thermal_Model(const LSM6DSV16X_Thermal_Model_t *Model);
+    static void Get_Thermal_Correction(const LSM6DSV16X_Thermal_Model_t *Model, float Temperature, float XLOffset[3], float XLGain[3], float GOffset[3], float GGain[3]);
+
+    LSM6DSV16XStatusTypeDef Route_Interrupt(LSM6DSV16X_SensorIntPin_t IntPin, LSM6DSV16X_Int_Source_t Source);
+    LSM6DSV16XStatusTypeDef Unroute_Interrupt(LSM6DSV16X_SensorIntPin_t IntPin, LSM6DSV16X_Int_Source_t Source);
+    LSM6DSV16XStatusTypeDef Begin_Interrupt_Routing();
+    LSM6DSV16XStatusTypeDef End_Interrupt_Routing();
+    LSM6DSV16XStatusTypeDef Get_Interrupt_Routing(LSM6DSV16X_SensorIntPin_t IntPin, uint32_t *Sources);
+
     LSM6DSV16XStatusTypeDef Enable_6D_Orientation(LSM6DSV16X_SensorIntPin_t IntPin);
     LSM6DSV16XStatusTypeDef Disable_6D_Orientation();
     LSM6DSV16XStatusTypeDef Set_6D_Orientation_Threshold(uint8_t Threshold);
@@ -182,6 +412,13 @@ class LSM6DSV16XSensor {
     LSM6DSV16XStatusTypeDef Set_Wake_Up_Threshold(uint32_t Threshold);
     LSM6DSV16XStatusTypeDef Set_Wake_Up_Duration(uint8_t Duration);
 
+    LSM6DSV16XStatusTypeDef Enable_Activity_Power_Manager(LSM6DSV16X_SensorIntPin_t IntPin, float ActiveOdr, float SleepOdr, lsm6dsv16x_act_mode_t Mode = LSM6DSV16X_XL_LOW_POWER_GY_SLEEP);
+    LSM6DSV16XStatusTypeDef Disable_Activity_Power_Manager();
+    LSM6DSV16XStatusTypeDef Set_Sleep_Duration(uint8_t Duration);
+    LSM6DSV16XStatusTypeDef Set_Activity_Callback(LSM6DSV16X_Activity_Callback_t Callback);
+    LSM6DSV16XStatusTypeDef Service_Activity_Power_Manager();
+    LSM6DSV16XStatusTypeDef Get_Activity_State(LSM6DSV16X_Activity_State_t *State);
+
     LSM6DSV16XStatusTypeDef Enable_Single_Tap_Detection(LSM6DSV16X_SensorIntPin_t IntPin);
     LSM6DSV16XStatusTypeDef Disable_Single_Tap_Detection();
     LSM6DSV16XStatusTypeDef Enable_Double_Tap_Detection(LSM6DSV16X_SensorIntPin_t IntPin);
@@ -199,10 +436,18 @@ class LSM6DSV16XSensor {
     LSM6DSV16XStatusTypeDef Enable_Tilt_Detection(LSM6DSV16X_SensorIntPin_t IntPin);
     LSM6DSV16XStatusTypeDef Disable_Tilt_Detection();
 
+    LSM6DSV16XStatusTypeDef Enable_Significant_Motion(LSM6DSV16X_SensorIntPin_t IntPin);
+    LSM6DSV16XStatusTypeDef Disable_Significant_Motion();
+
     LSM6DSV16XStatusTypeDef FIFO_Get_Num_Samples(uint16_t *NumSamples);
     LSM6DSV16XStatusTypeDef FIFO_Get_Full_Status(uint8_t *Status);
     LSM6DSV16XStatusTypeDef FIFO_Set_INT1_FIFO_Full(uint8_t Status);
     LSM6DSV16XStatusTypeDef FIFO_Set_INT2_FIFO_Full(uint8_t Status);
+    LSM6DSV16XStatusTypeDef FIFO_Set_INT1_FIFO_Threshold(uint8_t Status);
+    LSM6DSV16XStatusTypeDef FIFO_Set_INT2_FIFO_Threshold(uint8_t Status);
+    LSM6DSV16XStatusTypeDef FIFO_Set_Batch_Counter(lsm6dsv16x_fifo_batch_cnt_event_t Event, uint16_t Threshold);
+    LSM6DSV16XStatusTypeDef FIFO_Set_INT1_Batch_Counter(uint8_t Status);
+    LSM6DSV16XStatusTypeDef FIFO_Set_INT2_Batch_Counter(uint8_t Status);
     LSM6DSV16XStatusTypeDef FIFO_Set_Watermark_Level(uint8_t Watermark);
     LSM6DSV16XStatusTypeDef FIFO_Set_Stop_On_Fth(uint8_t Status);
     LSM6DSV16XStatusTypeDef FIFO_Set_Mode(uint8_t Mode);
@@ -212,6 +457,29 @@ class LSM6DSV16XSensor {
     LSM6DSV16XStatusTypeDef FIFO_Set_X_BDR(float Bdr);
     LSM6DSV16XStatusTypeDef FIFO_Get_G_Axes(int32_t *AngularVelocity);
     LSM6DSV16XStatusTypeDef FIFO_Set_G_BDR(float Bdr);
+    LSM6DSV16XStatusTypeDef FIFO_Set_Temperature_BDR(float Bdr);
+    LSM6DSV16XStatusTypeDef FIFO_Set_X_Dual_Batch(uint8_t Status);
+    LSM6DSV16XStatusTypeDef FIFO_Get_Words(LSM6DSV16X_FIFO_Word_t *Words, uint16_t MaxWords, uint16_t *NumWords);
+    LSM6DSV16XStatusTypeDef FIFO_Get_Batch_Frame(LSM6DSV16X_FIFO_Word_t *Words, uint16_t MaxWords, uint16_t *NumWords, uint8_t *Complete);
+    LSM6DSV16XStatusTypeDef FIFO_Decode_X_Axes(const LSM6DSV16X_FIFO_Word_t *Word, float *Acceleration);
+    LSM6DSV16XStatusTypeDef FIFO_Decode_G_Axes(const LSM6DSV16X_FIFO_Word_t *Word, float *AngularRate);
+    LSM6DSV16XStatusTypeDef FIFO_Decode_Temperature(const LSM6DSV16X_FIFO_Word_t *Word, float *Temperature);
+    LSM6DSV16XStatusTypeDef FIFO_Decode_X_Dual_Axes(const LSM6DSV16X_FIFO_Word_t *Word, float *Acceleration);
+    LSM6DSV16XStatusTypeDef FIFO_Decode_X_HDR(const LSM6DSV16X_FIFO_Word_t *Words, uint16_t NumWords, float *Acceleration, uint16_t MaxSamples, uint16_t *NumSamples);
+    LSM6DSV16XStatusTypeDef FIFO_Enable_Config_Tracking();
+    LSM6DSV16XStatusTypeDef FIFO_Disable_Config_Tracking();
+    LSM6DSV16XStatusTypeDef FIFO_Get_Config_Sensitivity(uint8_t Cfg, float *AccSensitivity, float *GyroSensitivity);
+    LSM6DSV16XStatusTypeDef FIFO_Get_Status(uint16_t *Level, uint8_t *Overrun);
+    LSM6DSV16XStatusTypeDef FIFO_Get_Status_Regs(uint8_t *Status);
+    LSM6DSV16XStatusTypeDef FIFO_Set_Timestamp_Batch(uint8_t Decimation);
+    LSM6DSV16XStatusTypeDef FIFO_Decode_Timestamp(const LSM6DSV16X_FIFO_Word_t *Word, uint32_t *Timestamp);
+    LSM6DSV16XStatusTypeDef FIFO_Get_Stats(LSM6DSV16X_FIFO_Stats_t *Stats);
+    LSM6DSV16XStatusTypeDef FIFO_Reset_Stats();
+    LSM6DSV16XStatusTypeDef FIFO_Set_Loss_Callback(LSM6DSV16X_FIFO_Loss_Callback_t Callback);
+    LSM6DSV16XStatusTypeDef FIFO_Arm_Capture(LSM6DSV16X_Capture_Trigger_t Trigger, LSM6DSV16X_SensorIntPin_t IntPin, LSM6DSV16X_Capture_Window_t Window, uint8_t Depth);
+    LSM6DSV16XStatusTypeDef FIFO_Disarm_Capture();
+    LSM6DSV16XStatusTypeDef FIFO_Get_Capture_Status(uint8_t *Status);
+    LSM6DSV16XStatusTypeDef FIFO_Read_Capture(LSM6DSV16X_FIFO_Word_t *Words, uint16_t MaxWords, uint16_t *NumWords);
 
     LSM6DSV16XStatusTypeDef QVAR_Enable();
     LSM6DSV16XStatusTypeDef QVAR_Disable();
@@ -219,10 +487,24 @@ class LSM6DSV16XSensor {
     LSM6DSV16XStatusTypeDef QVAR_GetImpedance(uint16_t *val);
     LSM6DSV16XStatusTypeDef QVAR_SetImpedance(uint16_t val);
     LSM6DSV16XStatusTypeDef QVAR_GetData(float *Data);
+    LSM6DSV16XStatusTypeDef QVAR_Get_Sample(LSM6DSV16X_QVAR_Sample_t *Sample);
 
     LSM6DSV16XStatusTypeDef Get_MLC_Status(lsm6dsv16x_mlc_status_mainpage_t *status);
     LSM6DSV16XStatusTypeDef Get_MLC_Output(lsm6dsv16x_mlc_out_t *output);
 
+    LSM6DSV16XStatusTypeDef SH_Set_Slave(uint8_t Slave, uint8_t Address, uint8_t Reg, uint8_t Len);
+    LSM6DSV16XStatusTypeDef SH_Write_Reg(uint8_t Address, uint8_t Reg, uint8_t Data);
+    LSM6DSV16XStatusTypeDef SH_Read_Reg(uint8_t Address, uint8_t Reg, uint8_t *Data, uint8_t Len);
+    LSM6DSV16XStatusTypeDef SH_Set_Pull_Up(uint8_t Status);
+    LSM6DSV16XStatusTypeDef SH_Enable(float Rate, uint8_t NumSlaves);
+    LSM6DSV16XStatusTypeDef SH_Disable();
+    LSM6DSV16XStatusTypeDef SH_Get_Data(uint8_t *Data, uint8_t Len);
+    LSM6DSV16XStatusTypeDef FIFO_SH_Set_Batch(uint8_t Slave, uint8_t Status);
+    LSM6DSV16XStatusTypeDef FIFO_Get_SH_Slave(uint8_t Tag, uint8_t *Slave);
+
+    LSM6DSV16XStatusTypeDef Enable_SFLP(float Rate, uint8_t Outputs, lsm6dsv16x_fifo_mode_t Mode = LSM6DSV16X_STREAM_MODE);
+    LSM6DSV16XStatusTypeDef Disable_SFLP();
+    LSM6DSV16XStatusTypeDef Get_SFLP_Outputs(uint8_t *Outputs);
     LSM6DSV16XStatusTypeDef Enable_Rotation_Vector();
     LSM6DSV16XStatusTypeDef Disable_Rotation_Vector();
     LSM6DSV16XStatusTypeDef Enable_Gravity_Vector();
@@ -230,13 +512,60 @@ class LSM6DSV16XSensor {
     LSM6DSV16XStatusTypeDef Enable_Gyroscope_Bias();
     LSM6DSV16XStatusTypeDef Disable_Gyroscope_Bias();
     LSM6DSV16XStatusTypeDef FIFO_Get_Rotation_Vector(float *rvec);
+    LSM6DSV16XStatusTypeDef FIFO_Decode_Rotation_Vector(const LSM6DSV16X_FIFO_Word_t *Word, float *rvec);
     LSM6DSV16XStatusTypeDef FIFO_Get_Gravity_Vector(float *gvec);
+    LSM6DSV16XStatusTypeDef FIFO_Decode_Gravity_Vector(const LSM6DSV16X_FIFO_Word_t *Word, float *gvec);
     LSM6DSV16XStatusTypeDef FIFO_Get_Gyroscope_Bias(float *gbias);
+    LSM6DSV16XStatusTypeDef FIFO_Decode_Gyroscope_Bias(const LSM6DSV16X_FIFO_Word_t *Word, float *gbias);
     LSM6DSV16XStatusTypeDef Reset_SFLP();
+    LSM6DSV16XStatusTypeDef Get_SFLP_Gyroscope_Bias(float *gbias);
+    LSM6DSV16XStatusTypeDef Set_SFLP_Gyroscope_Bias(const float *gbias);
+    LSM6DSV16XStatusTypeDef Restore_SFLP_Gyroscope_Bias();
+    LSM6DSV16XStatusTypeDef Get_SFLP_State(uint8_t *Buffer, uint16_t Size);
+    LSM6DSV16XStatusTypeDef Restore_SFLP_State(const uint8_t *Buffer, uint16_t Size);
+    LSM6DSV16XStatusTypeDef Set_X_User_Offset(const float *Offset);
+    LSM6DSV16XStatusTypeDef Get_X_User_Offset(float *Offset);
+    LSM6DSV16XStatusTypeDef Start_X_Offset_Calibration();
+    LSM6DSV16XStatusTypeDef Service_X_Offset_Calibration(uint8_t *Done);
+    LSM6DSV16XStatusTypeDef Stop_X_Offset_Calibration();
+    LSM6DSV16XStatusTypeDef Get_X_Offset_State(uint8_t *Buffer, uint16_t Size);
+    LSM6DSV16XStatusTypeDef Restore_X_Offset_State(const uint8_t *Buffer, uint16_t Size);
+    LSM6DSV16XStatusTypeDef Run_Self_Test(LSM6DSV16X_Self_Test_Result_t *Result, uint8_t Samples = LSM6DSV16X_SELF_TEST_SAMPLES);
+
+    LSM6DSV16XStatusTypeDef Enable_Timestamp();
+    LSM6DSV16XStatusTypeDef Disable_Timestamp();
+    LSM6DSV16XStatusTypeDef Get_Timestamp(uint32_t *Timestamp);
+    LSM6DSV16XStatusTypeDef Get_Timestamp_Resolution(float *Resolution);
+
+    LSM6DSV16XStatusTypeDef Get_Config_Image(LSM6DSV16X_Config_Image_t *Image);
+    LSM6DSV16XStatusTypeDef Set_Config_Image(const LSM6DSV16X_Config_Image_t *Image);
 
     LSM6DSV16XStatusTypeDef Read_Reg(uint8_t Reg, uint8_t *Data);
+    LSM6DSV16XStatusTypeDef Read_Regs(uint8_t Reg, uint8_t *Data, uint16_t Len);
     LSM6DSV16XStatusTypeDef Write_Reg(uint8_t Reg, uint8_t Data);
 
+    LSM6DSV16XStatusTypeDef Begin_Bus_Transaction();
+    LSM6DSV16XStatusTypeDef End_Bus_Transaction();
+
+    LSM6DSV16XStatusTypeDef Get_Bus_Stats(LSM6DSV16X_Bus_Stats_t *Stats);
+    LSM6DSV16XStatusTypeDef Reset_Bus_Stats();
+    LSM6DSV16XStatusTypeDef Get_Bus_Wire_Time(LSM6DSV16X_Bus_Stats_t *Stats, LSM6DSV16X_Bus_t Bus, uint32_t ClockHz, float *TimeUs);
+
+    LSM6DSV16XStatusTypeDef Get_Latency_Stats(LSM6DSV16X_Latency_Channel_t Channel, LSM6DSV16X_Latency_Stats_t *Stats);
+    LSM6DSV16XStatusTypeDef Reset_Latency_Stats();
+
+    /**
+     * @brief Record the arrival of the FIFO interrupt, to be called from the ISR.
+     * @note  Compiles to nothing unless LSM6DSV16X_LATENCY_TRACE is enabled.
+     */
+    void FIFO_Mark_Interrupt()
+    {
+#if LSM6DSV16X_LATENCY_TRACE
+      irq_time_us = micros();
+      irq_pending = 1;
+#endif
+    }
+
     /**
      * @brief Utility function to read data.
      * @param  pBuffer: pointer to data to be read.
@@ -246,8 +575,13 @@ class LSM6DSV16XSensor {
      */
     uint8_t IO_Read(uint8_t *pBuffer, uint8_t RegisterAddr, uint16_t NumByteToRead)
     {
+      bus_stats.ReadTransactions++;
+      bus_stats.ReadBytes += NumByteToRead;
+
       if (dev_spi) {
-        dev_spi->beginTransaction(SPISettings(spi_speed, MSBFIRST, SPI_MODE3));
+        if (!bus_held) {
+          dev_spi->beginTransaction(SPISettings(spi_speed, MSBFIRST, SPI_MODE3));
+        }
 
         digitalWrite(cs_pin, LOW);
 
@@ -260,7 +594,9 @@ class LSM6DSV16XSensor {
 
         digitalWrite(cs_pin, HIGH);
 
-        dev_spi->endTransaction();
+        if (!bus_held) {
+          dev_spi->endTransaction();
+        }
 
         return 0;
       }
@@ -293,8 +629,13 @@ class LSM6DSV16XSensor {
      */
     uint8_t IO_Write(uint8_t *pBuffer, uint8_t RegisterAddr, uint16_t NumByteToWrite)
     {
+      bus_stats.WriteTransactions++;
+      bus_stats.WriteBytes += NumByteToWrite;
+
       if (dev_spi) {
-        dev_spi->beginTransaction(SPISettings(spi_speed, MSBFIRST, SPI_MODE3));
+        if (!bus_held) {
+          dev_spi->beginTransaction(SPISettings(spi_speed, MSBFIRST, SPI_MODE3));
+        }
 
         digitalWrite(cs_pin, LOW);
 
@@ -307,7 +648,9 @@ class LSM6DSV16XSensor {
 
         digitalWrite(cs_pin, HIGH);
 
-        dev_spi->endTransaction();
+        if (!bus_held) {
+          dev_spi->endTransaction();
+        }
 
         return 0;
       }
@@ -336,6 +679,30 @@ class LSM6DSV16XSensor {
     LSM6DSV16XStatusTypeDef npy_halfbits_to_floatbits(uint16_t h, uint32_t *f);
     LSM6DSV16XStatusTypeDef npy_half_to_float(uint16_t h, float *f);
     LSM6DSV16XStatusTypeDef sflp2q(float quat[4], uint16_t sflp[3]);
+    LSM6DSV16XStatusTypeDef SH_Run_Cycle(uint8_t WriteOnce);
+    LSM6DSV16XStatusTypeDef SFLP_Add_Output(uint8_t Output);
+    LSM6DSV16XStatusTypeDef SFLP_Remove_Output(uint8_t Output);
+    uint16_t State_Crc(const uint8_t *Buffer, uint16_t Len);
+    LSM6DSV16XStatusTypeDef Self_Test_Average(uint8_t Samples, uint8_t XLSkip, uint8_t GSkip, float *XLAvg, float *GAvg);
+    LSM6DSV16XStatusTypeDef FIFO_Read_Status(uint16_t *Level, lsm6dsv16x_fifo_status2_t *Status2);
+    void FIFO_Account_Status(uint16_t Level, const lsm6dsv16x_fifo_status2_t *Status2);
+    uint32_t FIFO_Account_Word(const LSM6DSV16X_FIFO_Word_t *Word);
+    LSM6DSV16XStatusTypeDef FIFO_Read_Burst(LSM6DSV16X_FIFO_Word_t *Words, uint16_t Count, uint32_t *Lost);
+    void FIFO_Account_Drain(uint16_t Count, uint32_t Lost);
+    LSM6DSV16XStatusTypeDef FIFO_Track_Config();
+    void FIFO_Track_Word(uint8_t Tag);
+    LSM6DSV16XStatusTypeDef FIFO_Sensitivity(uint8_t Cfg, uint8_t Gyro, float *Sensitivity);
+    void Thermal_Update(float Temperature);
+    void FIFO_Merge_X_HDR(float *Acceleration, const int16_t *Channel1, const int16_t *Channel2);
+    LSM6DSV16XStatusTypeDef Hold_Interrupt(LSM6DSV16X_SensorIntPin_t IntPin, LSM6DSV16X_Int_Source_t Source, uint8_t Status);
+    LSM6DSV16XStatusTypeDef Release_Interrupt(LSM6DSV16X_Int_Source_t Source);
+    LSM6DSV16XStatusTypeDef Restore_Activity_Rates();
+    LSM6DSV16XStatusTypeDef Commit_Interrupt_Routing();
+    LSM6DSV16XStatusTypeDef Sync_Interrupt_Routing();
+#if LSM6DSV16X_LATENCY_TRACE
+    void Latency_Record(LSM6DSV16X_Latency_Channel_t Channel, uint32_t Us);
+    uint32_t Latency_Bucket_Bound(uint8_t Bucket);
+#endif
 
     /* Helper classes. */
     TwoWire *dev_i2c;
@@ -345,13 +712,112 @@ class LSM6DSV16XSensor {
     uint8_t address;
     int cs_pin;
     uint32_t spi_speed;
+    uint8_t bus_held; /* SPI transaction opened by Begin_Bus_Transaction */
+    uint16_t fifo_burst_words; /* LSM6DSV16X_FIFO_BURST_WORDS, limited by the Wire buffer on I2C */
 
     lsm6dsv16x_data_rate_t acc_odr;
     lsm6dsv16x_data_rate_t gyro_odr;
     uint8_t acc_is_enabled;
     uint8_t gyro_is_enabled;
+    uint8_t acc_dual_enabled;
+    float acc_sensitivity;  /* Cached, 0.0f when unknown */
+    float gyro_sensitivity; /* Cached, 0.0f when unknown */
     uint8_t initialized;
     lsm6dsv16x_ctx_t reg_ctx;
+
+    /* Interrupt routing manager */
+    uint8_t int_route_count[2][LSM6DSV16X_INT_SOURCE_NUMBER]; /* References per pin and source */
+    uint32_t int_route_held[2];      /* Sources referenced by the Enable_ functions */
+    uint32_t int_route_committed[2]; /* Routing last written to the device */
+    uint8_t int_route_deferred;      /* Between Begin_ and End_Interrupt_Routing */
+    uint8_t int_route_irq_enable;    /* FUNCTIONS_ENABLE.INTERRUPTS_ENABLE set by the manager */
+    uint8_t int_route_irq_hold;      /* Users of INTERRUPTS_ENABLE without routed sources */
+
+    /* Event-triggered FIFO capture */
+    LSM6DSV16X_Capture_Trigger_t capture_trigger;
+    lsm6dsv16x_fifo_mode_t capture_mode;
+    uint8_t capture_depth;
+    uint8_t capture_lir;
+    uint8_t capture_armed;
+    uint8_t capture_triggered;
+    /* FIFO configuration restored when the capture is disarmed */
+    lsm6dsv16x_fifo_mode_t capture_saved_mode;
+    uint8_t capture_saved_wtm;
+    uint8_t capture_saved_stop;
+
+    /* Activity/inactivity power manager */
+    LSM6DSV16X_Activity_Callback_t activity_cb;
+    LSM6DSV16X_Activity_State_t activity_state;
+    float activity_odr;
+    float sleep_odr;
+    lsm6dsv16x_act_mode_t activity_mode;
+    lsm6dsv16x_fifo_xl_batch_t activity_xl_bdr; /* FIFO batch rates saved when going to sleep */
+    lsm6dsv16x_fifo_gy_batch_t activity_gy_bdr;
+    uint8_t activity_enabled;
+
+    /* Last SFLP gyroscope bias estimate [mdps] */
+    float sflp_gbias[3];
+    uint8_t sflp_gbias_valid;
+
+    /* Accelerometer offset calibration, residuals of the static samples [mg] */
+    float xl_cal_sum[3];
+    uint16_t xl_cal_count[3];
+    int16_t xl_cal_prev[3];
+    uint8_t xl_cal_prev_valid;
+    uint8_t xl_cal_running;
+    uint8_t xl_cal_on_out;      /* CTRL9.USR_OFF_ON_OUT before the calibration */
+
+    /* Sensor hub slaves read configuration */
+    lsm6dsv16x_sh_cfg_read_t sh_slave[LSM6DSV16X_SH_MAX_SLAVES];
+    uint8_t sh_enabled;
+
+    /* FIFO loss accounting */
+    LSM6DSV16X_FIFO_Stats_t fifo_stats;
+    LSM6DSV16X_FIFO_Loss_Callback_t fifo_loss_cb;
+    uint8_t fifo_wtm_armed;   /* The next watermark flag is counted as a hit */
+    uint8_t fifo_full_armed;  /* The next full flag is counted as a hit */
+    uint8_t fifo_last_cnt;    /* Tag counter of the last word read, 0xFF when unknown */
+    uint8_t fifo_ovr_seen;    /* Overrun since the last timestamp word */
+    uint16_t fifo_slots;      /* Time slots since the last timestamp word */
+    uint32_t fifo_last_ts;
+    uint8_t fifo_ts_valid;
+    float fifo_slot_ticks;    /* Timestamp LSBs per time slot, 0.0f when unknown */
+
+    /* FIFO batch counter frames */
+    uint16_t batch_cnt_threshold; /* 0 when the batch counter is not set */
+    uint16_t batch_cnt_counted;   /* Counted samples already read in the current frame */
+    uint8_t batch_cnt_tag;
+
+    /* Configuration of the FIFO words, advanced by CFG_CHANGE words */
+    uint8_t cfg_track;
+    uint8_t cfg_regs[5];     /* ODR, BDR and full scale fields of the latest configuration */
+    uint8_t cfg_decode;      /* Configuration of the words read now */
+    uint8_t cfg_latest;      /* Configuration written last */
+    uint32_t cfg_words;      /* FIFO words read since the tracking started */
+    uint32_t cfg_start[LSM6DSV16X_FIFO_CFG_EPOCHS]; /* First FIFO word of each configuration */
+    float cfg_xl_sens[LSM6DSV16X_FIFO_CFG_EPOCHS];
+    float cfg_g_sens[LSM6DSV16X_FIFO_CFG_EPOCHS];
+
+    /* Thermal compensation of the FIFO samples, at the last temperature read */
+    LSM6DSV16X_Thermal_Model_t thermal_model;
+    uint8_t thermal_enabled;
+    float thermal_xl_offset[3];  /* [mg] */
+    float thermal_xl_gain[3];
+    float thermal_g_offset[3];   /* [mdps] */
+    float thermal_g_gain[3];
+
+    /* Bus traffic counters */
+    LSM6DSV16X_Bus_Stats_t bus_stats;
+
+#if LSM6DSV16X_LATENCY_TRACE
+    /* Interrupt-to-consume latency histograms */
+    volatile uint32_t irq_time_us;
+    volatile uint8_t irq_pending;
+    uint32_t latency_hist[LSM6DSV16X_LATENCY_CHANNELS][LSM6DSV16X_LATENCY_BUCKETS];
+    uint32_t latency_count[LSM6DSV16X_LATENCY_CHANNELS];
+    uint32_t latency_min[LSM6DSV16X_LATENCY_CHANNELS];
+    uint32_t latency_max[LSM6DSV16X_LATENCY_CHANNELS];
+#endif
 };
 
 #ifdef __cplusplus
@@ -359,6 +825,7 @@ extern "C" {
 #endif
 int32_t LSM6DSV16X_io_write(void *handle, uint8_t WriteAddr, uint8_t *pBuffer, uint16_t nBytesToWrite);
 int32_t LSM6DSV16X_io_read(void *handle, uint8_t ReadAddr, uint8_t *pBuffer, uint16_t nBytesToRead);
+void LSM6DSV16X_delay(uint32_t millisec);
 #ifdef __cplusplus
 }
 #endif
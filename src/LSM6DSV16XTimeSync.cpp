@@ -0,0 +1,334 @@
+/**
+ ******************************************************************************
+ * @file    LSM6DSV16XTimeSync.cpp
+ * @author  LSM6DSV16X library contributors
+ * @version V1.0.0
+ * @date    October 2026
+ * @brief   Synchronization of LSM6DSV16X timestamps with the host clock.
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; COPYRIGHT(c) 2026 LSM6DSV16X library contributors</center></h2>
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of the copyright holder nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************
+ */
+
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "LSM6DSV16XTimeSync.h"
+#include <math.h>
+
+
+/* Class Implementation ------------------------------------------------------*/
+
+/** Constructor
+ */
+LSM6DSV16XTimeSync::LSM6DSV16XTimeSync()
+{
+  num_sensors = 0U;
+  max_bracket_us = 0U;
+  (void)memset((void *)min_bracket_us, 0xFF, sizeof(min_bracket_us));
+  (void)memset((void *)point_head, 0x0, sizeof(point_head));
+  (void)memset((void *)point_count, 0x0, sizeof(point_count));
+  (void)memset((void *)rejected, 0x0, sizeof(rejected));
+  (void)memset((void *)resets, 0x0, sizeof(resets));
+}
+
+/**
+ * @brief  Add a sensor to the synchronizer, the sensor must already be initialized with
+ *         begin() and its timestamp counter enabled
+ * @param  Sensor pointer to the sensor
+ * @param  Index pointer where the index of the sensor is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XTimeSync::Add_Sensor(LSM6DSV16XSensor *Sensor, uint8_t *Index)
+{
+  float resolution;
+
+  if (Sensor == NULL || num_sensors >= LSM6DSV16X_TIME_SYNC_MAX_SENSORS) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (Sensor->Get_Timestamp_Resolution(&resolution) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  sensor[num_sensors] = Sensor;
+  tick_ns[num_sensors] = (uint32_t)(resolution * 1000.0f + 0.5f);
+  *Index = num_sensors;
+  num_sensors++;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Take a sync point: read the timestamp counter of one sensor between two
+ *         reads of the host clock and update the fit
+ * @note   Call it periodically, e.g. once a second; points taken during a slow bus read
+ *         are counted as rejected and do not change the fit
+ * @param  Index index of the sensor
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XTimeSync::Sample(uint8_t Index)
+{
+  uint32_t best_bracket = 0xFFFFFFFFU;
+  uint32_t max_bracket;
+  uint32_t ticks = 0U;
+  uint32_t host = 0U;
+  uint8_t head;
+
+  if (Index >= num_sensors) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  for (uint8_t i = 0U; i < LSM6DSV16X_TIME_SYNC_TRIES; i++) {
+    uint32_t before;
+    uint32_t after;
+    uint32_t value;
+
+    before = micros();
+    if (sensor[Index]->Get_Timestamp(&value) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+    after = micros();
+
+    if (after - before < best_bracket) {
+      best_bracket = after - before;
+      ticks = value;
+      host = before + best_bracket / 2U;
+    }
+  }
+
+  /* The bus read time depends on the bus and its clock, so by default the limit follows
+     the shortest bracket seen */
+  if (best_bracket < min_bracket_us[Index]) {
+    min_bracket_us[Index] = best_bracket;
+  }
+  max_bracket = max_bracket_us;
+  if (max_bracket == 0U) {
+    max_bracket = min_bracket_us[Index] + LSM6DSV16X_TIME_SYNC_BRACKET_SLACK_US;
+  }
+
+  if (best_bracket > max_bracket) {
+    rejected[Index]++;
+    return LSM6DSV16X_OK;
+  }
+
+  /* A point far from the prediction means that the counter was restarted */
+  if (point_count[Index] > 0U) {
+    int32_t error = (int32_t)(host - anchor_host[Index] - (uint32_t)Model_Us(Index, (int32_t)(ticks - anchor_ticks[Index])));
+
+    if (error > (int32_t)LSM6DSV16X_TIME_SYNC_RESET_US || error < -(int32_t)LSM6DSV16X_TIME_SYNC_RESET_US) {
+      point_count[Index] = 0U;
+      resets[Index]++;
+    }
+  }
+
+  head = point_head[Index];
+  point_ticks[Index][head] = ticks;
+  point_host[Index][head] = host;
+  point_head[Index] = (uint8_t)((head + 1U) % LSM6DSV16X_TIME_SYNC_POINTS);
+  if (point_count[Index] < LSM6DSV16X_TIME_SYNC_POINTS) {
+    point_count[Index]++;
+  }
+
+  Fit(Index);
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Take a sync point on every sensor
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XTimeSync::Sample_All()
+{
+  for (uint8_t i = 0U; i < num_sensors; i++) {
+    if (Sample(i) != LSM6DSV16X_OK) {
+      return LSM6DSV16X_ERROR;
+    }
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Convert a timestamp of one sensor, read from the register or from a FIFO
+ *         timestamp word, to the host clock
+ * @note   The timestamp is unwrapped around the newest sync point, so it must be
+ *         within about 13 hours of it. The result wraps like micros().
+ * @param  Index index of the sensor
+ * @param  Timestamp timestamp of the sensor [LSB]
+ * @param  HostUs pointer where the host time is written [us]
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XTimeSync::To_Host_Time(uint8_t Index, uint32_t Timestamp, uint32_t *HostUs)
+{
+  if (Index >= num_sensors || point_count[Index] == 0U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  *HostUs = anchor_host[Index] + (uint32_t)Model_Us(Index, (int32_t)(Timestamp - anchor_ticks[Index]));
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Get the state of the fit of one sensor
+ * @param  Index index of the sensor
+ * @param  Info pointer where the state is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XTimeSync::Get_Info(uint8_t Index, LSM6DSV16X_Time_Sync_Info_t *Info)
+{
+  float nominal;
+
+  if (Index >= num_sensors) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  nominal = (float)tick_ns[Index] / 1000.0f;
+
+  Info->Points = point_count[Index];
+  Info->Rejected = rejected[Index];
+  Info->Resets = resets[Index];
+  if (point_count[Index] > 0U) {
+    Info->Resolution = nominal + skew_us[Index];
+    Info->SkewPpm = skew_us[Index] / nominal * 1000000.0f;
+    Info->ResidualUs = residual_us[Index];
+  } else {
+    Info->Resolution = nominal;
+    Info->SkewPpm = 0.0f;
+    Info->ResidualUs = 0.0f;
+  }
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Discard the sync points of one sensor, e.g. after its timestamp counter was reset
+ * @param  Index index of the sensor
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XTimeSync::Reset(uint8_t Index)
+{
+  if (Index >= num_sensors) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  point_count[Index] = 0U;
+  rejected[Index] = 0U;
+  resets[Index] = 0U;
+  min_bracket_us[Index] = 0xFFFFFFFFU;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Set the longest host bracket of a sync point, longer ones are rejected
+ * @note   With 0, the default, the limit is the shortest bracket seen on each sensor plus
+ *         LSM6DSV16X_TIME_SYNC_BRACKET_SLACK_US, which suits both SPI and I2C
+ * @param  MaxBracketUs longest host bracket, 0 to derive it from the bus [us]
+ * @retval None
+ */
+void LSM6DSV16XTimeSync::Set_Max_Bracket(uint32_t MaxBracketUs)
+{
+  max_bracket_us = MaxBracketUs;
+}
+
+/**
+ * @brief  Fit offset and skew of one sensor on its sync points
+ * @note   The fit is done on the error of each point against the trimmed resolution,
+ *         relative to the newest point, so that float precision is enough
+ * @param  Index index of the sensor
+ * @retval None
+ */
+void LSM6DSV16XTimeSync::Fit(uint8_t Index)
+{
+  uint8_t count = point_count[Index];
+  uint8_t newest = (uint8_t)((point_head[Index] + LSM6DSV16X_TIME_SYNC_POINTS - 1U) % LSM6DSV16X_TIME_SYNC_POINTS);
+  uint8_t oldest = (uint8_t)((point_head[Index] + LSM6DSV16X_TIME_SYNC_POINTS - count) % LSM6DSV16X_TIME_SYNC_POINTS);
+  float x[LSM6DSV16X_TIME_SYNC_POINTS];
+  float e[LSM6DSV16X_TIME_SYNC_POINTS];
+  float mean_x = 0.0f;
+  float mean_e = 0.0f;
+  float sxx = 0.0f;
+  float sxe = 0.0f;
+  float see = 0.0f;
+  float skew = 0.0f;
+  uint32_t span_us;
+
+  anchor_ticks[Index] = point_ticks[Index][newest];
+  anchor_host[Index] = point_host[Index][newest];
+
+  for (uint8_t i = 0U; i < count; i++) {
+    uint8_t p = (uint8_t)((oldest + i) % LSM6DSV16X_TIME_SYNC_POINTS);
+    int32_t ticks = (int32_t)(point_ticks[Index][p] - anchor_ticks[Index]);
+    uint32_t host = point_host[Index][p] - anchor_host[Index];
+
+    /* The error is small, so it is taken modulo 2^32 like the host clock */
+    x[i] = (float)ticks;
+    e[i] = (float)(int32_t)(host - (uint32_t)(((int64_t)ticks * (int64_t)tick_ns[Index]) / 1000));
+    mean_x += x[i];
+    mean_e += e[i];
+  }
+  mean_x /= (float)count;
+  mean_e /= (float)count;
+
+  for (uint8_t i = 0U; i < count; i++) {
+    sxx += (x[i] - mean_x) * (x[i] - mean_x);
+    sxe += (x[i] - mean_x) * (e[i] - mean_e);
+  }
+
+  /* Points close in time only give the offset, the skew would be mostly read jitter */
+  span_us = (uint32_t)(-x[0] * (float)tick_ns[Index] / 1000.0f);
+  if (span_us >= LSM6DSV16X_TIME_SYNC_MIN_SPAN_US && sxx > 0.0f) {
+    skew = sxe / sxx;
+  }
+
+  skew_us[Index] = skew;
+  offset_us[Index] = mean_e - skew * mean_x;
+
+  for (uint8_t i = 0U; i < count; i++) {
+    float r = e[i] - offset_us[Index] - skew * x[i];
+    see += r * r;
+  }
+  residual_us[Index] = sqrtf(see / (float)count);
+}
+
+/**
+ * @brief  Evaluate the fit of one sensor
+ * @param  Index index of the sensor
+ * @param  Ticks timestamp relative to the newest sync point [LSB]
+ * @retval Host time relative to the newest sync point [us]
+ */
+int64_t LSM6DSV16XTimeSync::Model_Us(uint8_t Index, int32_t Ticks)
+{
+  float correction = offset_us[Index] + skew_us[Index] * (float)Ticks;
+
+  return ((int64_t)Ticks * (int64_t)tick_ns[Index]) / 1000
+         + (int64_t)(correction >= 0.0f ? correction + 0.5f : correction - 0.5f);
+}
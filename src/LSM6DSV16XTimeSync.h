@@ -0,0 +1,137 @@
+/**
+ ******************************************************************************
+ * @file    LSM6DSV16XTimeSync.h
+ * @author  LSM6DSV16X library contributors
+ * @version V1.0.0
+ * @date    October 2026
+ * @brief   Synchronization of LSM6DSV16X timestamps with the host clock.
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; COPYRIGHT(c) 2026 LSM6DSV16X library contributors</center></h2>
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of the copyright holder nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************
+ */
+
+
+/* Prevent recursive inclusion -----------------------------------------------*/
+
+#ifndef __LSM6DSV16XTimeSync_H__
+#define __LSM6DSV16XTimeSync_H__
+
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "LSM6DSV16XSensor.h"
+
+
+/* Defines -------------------------------------------------------------------*/
+
+/* Sensors managed by a time synchronizer */
+#ifndef LSM6DSV16X_TIME_SYNC_MAX_SENSORS
+  #define LSM6DSV16X_TIME_SYNC_MAX_SENSORS  8U
+#endif
+
+/* Sync points kept per sensor for the fit */
+#ifndef LSM6DSV16X_TIME_SYNC_POINTS
+  #define LSM6DSV16X_TIME_SYNC_POINTS  16U
+#endif
+
+/* Timestamp reads per sync point, the one with the shortest host bracket is kept */
+#define LSM6DSV16X_TIME_SYNC_TRIES  3U
+
+/* Sync points whose host bracket exceeds the shortest one seen by more than this are rejected [us] */
+#define LSM6DSV16X_TIME_SYNC_BRACKET_SLACK_US  200U
+
+/* Span of sync points needed before the skew is fitted [us] */
+#define LSM6DSV16X_TIME_SYNC_MIN_SPAN_US  1000000U
+
+/* Prediction error that is taken as a restart of the timestamp counter [us] */
+#define LSM6DSV16X_TIME_SYNC_RESET_US  5000U
+
+
+/* Typedefs ------------------------------------------------------------------*/
+
+typedef struct {
+  uint8_t Points;     /* Sync points in the fit */
+  uint32_t Rejected;  /* Sync points rejected because of a slow bus read */
+  uint32_t Resets;    /* Restarts of the timestamp counter detected */
+  float Resolution;   /* Timestamp LSB after the fit [us] */
+  float SkewPpm;      /* Drift of the sensor clock against the trimmed resolution [ppm] */
+  float ResidualUs;   /* RMS error of the sync points against the fit [us] */
+} LSM6DSV16X_Time_Sync_Info_t;
+
+
+/* Class Declaration ---------------------------------------------------------*/
+
+/**
+ * Maps the timestamps of several LSM6DSV16X sensors on the host clock (micros()).
+ * Each sensor timestamp counter is sampled against the host clock and an offset
+ * and skew are fitted by least squares over the last sync points, starting from
+ * the factory trimmed timestamp resolution of the part.
+ */
+class LSM6DSV16XTimeSync {
+  public:
+    LSM6DSV16XTimeSync();
+    LSM6DSV16XStatusTypeDef Add_Sensor(LSM6DSV16XSensor *Sensor, uint8_t *Index);
+    LSM6DSV16XStatusTypeDef Sample(uint8_t Index);
+    LSM6DSV16XStatusTypeDef Sample_All();
+    LSM6DSV16XStatusTypeDef To_Host_Time(uint8_t Index, uint32_t Timestamp, uint32_t *HostUs);
+    LSM6DSV16XStatusTypeDef Get_Info(uint8_t Index, LSM6DSV16X_Time_Sync_Info_t *Info);
+    LSM6DSV16XStatusTypeDef Reset(uint8_t Index);
+    void Set_Max_Bracket(uint32_t MaxBracketUs);
+
+  private:
+    void Fit(uint8_t Index);
+    int64_t Model_Us(uint8_t Index, int32_t Ticks);
+
+    LSM6DSV16XSensor *sensor[LSM6DSV16X_TIME_SYNC_MAX_SENSORS];
+    uint8_t num_sensors;
+
+    /* Trimmed timestamp resolution [ns] */
+    uint32_t tick_ns[LSM6DSV16X_TIME_SYNC_MAX_SENSORS];
+
+    /* Ring of sync points: timestamp and host time at the middle of the read */
+    uint32_t point_ticks[LSM6DSV16X_TIME_SYNC_MAX_SENSORS][LSM6DSV16X_TIME_SYNC_POINTS];
+    uint32_t point_host[LSM6DSV16X_TIME_SYNC_MAX_SENSORS][LSM6DSV16X_TIME_SYNC_POINTS];
+    uint8_t point_head[LSM6DSV16X_TIME_SYNC_MAX_SENSORS];
+    uint8_t point_count[LSM6DSV16X_TIME_SYNC_MAX_SENSORS];
+
+    /* Fit around the newest sync point: host = anchor + ticks * tick_ns + offset + skew * ticks */
+    uint32_t anchor_ticks[LSM6DSV16X_TIME_SYNC_MAX_SENSORS];
+    uint32_t anchor_host[LSM6DSV16X_TIME_SYNC_MAX_SENSORS];
+    float offset_us[LSM6DSV16X_TIME_SYNC_MAX_SENSORS];
+    float skew_us[LSM6DSV16X_TIME_SYNC_MAX_SENSORS];
+    float residual_us[LSM6DSV16X_TIME_SYNC_MAX_SENSORS];
+
+    /* Host bracket above which sync points are rejected, 0 to derive it from the shortest one [us] */
+    uint32_t max_bracket_us;
+    uint32_t min_bracket_us[LSM6DSV16X_TIME_SYNC_MAX_SENSORS];
+
+    uint32_t rejected[LSM6DSV16X_TIME_SYNC_MAX_SENSORS];
+    uint32_t resets[LSM6DSV16X_TIME_SYNC_MAX_SENSORS];
+};
+
+#endif /* __LSM6DSV16XTimeSync_H__ */
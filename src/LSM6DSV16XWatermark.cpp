@@ -0,0 +1,276 @@
+/**
+ ******************************************************************************
+ * @file    LSM6DSV16XWatermark.cpp
+ * @author  LSM6DSV16X library contributors
+ * @version V1.0.0
+ * @date    October 2026
+ * @brief   Adaptive FIFO watermark controller for the LSM6DSV16X.
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; COPYRIGHT(c) 2026 LSM6DSV16X library contributors</center></h2>
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of the copyright holder nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************
+ */
+
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "LSM6DSV16XWatermark.h"
+
+
+/* Class Implementation ------------------------------------------------------*/
+
+/** Constructor
+ * @param Sensor pointer to the sensor, already initialized with begin()
+ */
+LSM6DSV16XWatermark::LSM6DSV16XWatermark(LSM6DSV16XSensor *Sensor) : sensor(Sensor)
+{
+  max_latency_us = 100000U;
+  min_watermark = 1U;
+  max_watermark = LSM6DSV16X_WATERMARK_MAX;
+  irq_time_us = 0U;
+  irq_pending = 0U;
+  last_start_valid = 0U;
+  word_rate = 0.0f;
+  bus_us_per_word = 0.0f;
+  wake_peak_us = 0U;
+  overruns = 0U;
+  watermark = 1U;
+  hold = 0U;
+}
+
+/**
+ * @brief  Set the longest time a sample may wait in the FIFO before it is drained
+ * @param  MaxUs latency bound from sample to drain completion [us]
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XWatermark::Set_Latency_Bound(uint32_t MaxUs)
+{
+  if (MaxUs == 0U) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  max_latency_us = MaxUs;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Limit the watermark chosen by the controller
+ * @param  Min smallest watermark [words]
+ * @param  Max largest watermark [words]
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XWatermark::Set_Watermark_Range(uint8_t Min, uint8_t Max)
+{
+  if (Min == 0U || Min > Max) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  min_watermark = Min;
+  max_watermark = Max;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Program the initial watermark and reset the measurements
+ * @note   The FIFO threshold interrupt must be routed to a pin and the FIFO must not
+ *         stop on the watermark, otherwise the FIFO level cannot be measured
+ * @param  Watermark initial watermark [words]
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XWatermark::Start(uint8_t Watermark)
+{
+  LSM6DSV16X_FIFO_Stats_t stats;
+
+  if (Watermark < min_watermark) {
+    Watermark = min_watermark;
+  }
+  if (Watermark > max_watermark) {
+    Watermark = max_watermark;
+  }
+
+  if (sensor->FIFO_Set_Watermark_Level(Watermark) != LSM6DSV16X_OK
+      || sensor->FIFO_Get_Stats(&stats) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  watermark = Watermark;
+  overruns = stats.Overruns;
+  last_start_valid = 0U;
+  word_rate = 0.0f;
+  bus_us_per_word = 0.0f;
+  wake_peak_us = 0U;
+  hold = 0U;
+  irq_pending = 0U;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Drain the FIFO and adapt the watermark
+ * @note   The threshold interrupt is a level: the FIFO must be drained below the
+ *         watermark, so MaxWords should exceed the largest watermark
+ * @param  Words array where the FIFO words are written
+ * @param  MaxWords size of the Words array
+ * @param  NumWords pointer where the number of words read is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XWatermark::Drain(LSM6DSV16X_FIFO_Word_t *Words, uint16_t MaxWords, uint16_t *NumWords)
+{
+  uint32_t irq_us;
+  uint8_t pending;
+  uint32_t start_us;
+  uint32_t end_us;
+
+  noInterrupts();
+  irq_us = irq_time_us;
+  pending = irq_pending;
+  irq_pending = 0;
+  interrupts();
+
+  start_us = micros();
+  if (sensor->FIFO_Get_Words(Words, MaxWords, NumWords) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+  end_us = micros();
+
+  return Adapt(start_us, (pending != 0U) ? start_us - irq_us : 0U, *NumWords, end_us - start_us);
+}
+
+/**
+ * @brief  Get the measurements and the current watermark
+ * @param  Info pointer where the state of the controller is written
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XWatermark::Get_Info(LSM6DSV16X_Watermark_Info_t *Info)
+{
+  Info->Watermark = watermark;
+  Info->WordRate = word_rate * 1000000.0f;
+  Info->InterruptRate = word_rate * 1000000.0f / (float)watermark;
+  Info->WakeLatencyUs = wake_peak_us;
+  Info->BusUsPerWord = bus_us_per_word;
+  Info->Overruns = overruns;
+
+  return LSM6DSV16X_OK;
+}
+
+/**
+ * @brief  Update the measurements with one drain and program the new watermark
+ * @note   A sample waits W / rate to reach the watermark, then the wake latency and
+ *         the bus time of W words, so W <= rate * (bound - latency) / (1 + rate * bus).
+ *         The FIFO must also absorb twice the peak latency above the watermark.
+ * @param  StartUs host time at the start of the drain [us]
+ * @param  WakeUs interrupt-to-drain latency, 0 when unknown [us]
+ * @param  NumWords words read
+ * @param  BusUs bus time of the drain [us]
+ * @retval 0 in case of success, an error code otherwise
+ */
+LSM6DSV16XStatusTypeDef LSM6DSV16XWatermark::Adapt(uint32_t StartUs, uint32_t WakeUs, uint16_t NumWords, uint32_t BusUs)
+{
+  LSM6DSV16X_FIFO_Stats_t stats;
+  float target;
+  float bound;
+  uint8_t next;
+
+  /* Decaying peak, so that a single late wake-up is remembered for a while */
+  wake_peak_us -= wake_peak_us / 256U;
+  if (WakeUs > wake_peak_us) {
+    wake_peak_us = WakeUs;
+  }
+
+  if (NumWords > 0U) {
+    float per_word = (float)BusUs / (float)NumWords;
+    bus_us_per_word = (bus_us_per_word == 0.0f) ? per_word : bus_us_per_word + (per_word - bus_us_per_word) * 0.25f;
+  }
+
+  if (last_start_valid != 0U && StartUs != last_start_us) {
+    float rate = (float)NumWords / (float)(StartUs - last_start_us);
+    word_rate = (word_rate == 0.0f) ? rate : word_rate + (rate - word_rate) * 0.25f;
+  }
+  last_start_us = StartUs;
+  last_start_valid = 1U;
+
+  if (sensor->FIFO_Get_Stats(&stats) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+
+  if (stats.Overruns != overruns) {
+    /* Back off at once and keep the watermark low until the latency settles */
+    overruns = stats.Overruns;
+    hold = LSM6DSV16X_WATERMARK_HOLD;
+    target = (float)watermark / 2.0f;
+  } else if (word_rate == 0.0f) {
+    return LSM6DSV16X_OK;
+  } else {
+    target = (float)LSM6DSV16X_WATERMARK_MAX;
+
+    if (max_latency_us > wake_peak_us) {
+      bound = word_rate * (float)(max_latency_us - wake_peak_us) / (1.0f + word_rate * bus_us_per_word);
+    } else {
+      bound = 0.0f;
+    }
+    if (bound < target) {
+      target = bound;
+    }
+
+    bound = (float)LSM6DSV16X_WATERMARK_CAPACITY - 2.0f * word_rate * (float)wake_peak_us;
+    if (bound < target) {
+      target = bound;
+    }
+
+    /* Grow slowly, shrink at once */
+    if (hold > 0U) {
+      hold--;
+      if (target > (float)watermark) {
+        target = (float)watermark;
+      }
+    } else if (target > (float)watermark * 1.25f + 1.0f) {
+      target = (float)watermark * 1.25f + 1.0f;
+    }
+  }
+
+  if (target < (float)min_watermark) {
+    target = (float)min_watermark;
+  }
+  if (target > (float)max_watermark) {
+    target = (float)max_watermark;
+  }
+  next = (uint8_t)target;
+
+  /* Skip the register write for small increases */
+  if (next == watermark || (next > watermark && (uint8_t)(next - watermark) < watermark / 8U)) {
+    return LSM6DSV16X_OK;
+  }
+
+  if (sensor->FIFO_Set_Watermark_Level(next) != LSM6DSV16X_OK) {
+    return LSM6DSV16X_ERROR;
+  }
+  watermark = next;
+
+  return LSM6DSV16X_OK;
+}
@@ -0,0 +1,124 @@
+/**
+ ******************************************************************************
+ * @file    LSM6DSV16XWatermark.h
+ * @author  LSM6DSV16X library contributors
+ * @version V1.0.0
+ * @date    October 2026
+ * @brief   Adaptive FIFO watermark controller for the LSM6DSV16X.
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; COPYRIGHT(c) 2026 LSM6DSV16X library contributors</center></h2>
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *   3. Neither the name of the copyright holder nor the names of its contributors
+ *      may be used to endorse or promote products derived from this software
+ *      without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************
+ */
+
+
+/* Prevent recursive inclusion -----------------------------------------------*/
+
+#ifndef __LSM6DSV16XWatermark_H__
+#define __LSM6DSV16XWatermark_H__
+
+
+/* Includes ------------------------------------------------------------------*/
+
+#include "LSM6DSV16XSensor.h"
+
+
+/* Defines -------------------------------------------------------------------*/
+
+/* FIFO_CTRL1.WTM is 8 bits wide */
+#define LSM6DSV16X_WATERMARK_MAX  255U
+
+/* Highest level reported by FIFO_STATUS, used as the FIFO capacity [words] */
+#define LSM6DSV16X_WATERMARK_CAPACITY  511U
+
+/* Drains without growth of the watermark after an overrun */
+#define LSM6DSV16X_WATERMARK_HOLD  8U
+
+
+/* Typedefs ------------------------------------------------------------------*/
+
+typedef struct {
+  uint8_t Watermark;          /* Watermark currently programmed [words] */
+  float WordRate;             /* Words entering the FIFO [words/s] */
+  float InterruptRate;        /* Drains per second at the current watermark */
+  uint32_t WakeLatencyUs;     /* Decaying peak of interrupt-to-drain latency [us] */
+  float BusUsPerWord;         /* Bus time to read one FIFO word [us] */
+  uint32_t Overruns;          /* Overruns seen since Start */
+} LSM6DSV16X_Watermark_Info_t;
+
+
+/* Class Declaration ---------------------------------------------------------*/
+
+/**
+ * Drains the FIFO of an LSM6DSV16X on its threshold interrupt and moves the
+ * watermark to the largest value that keeps every sample within the latency
+ * bound and the FIFO away from overrun, from the measured word rate, consumer
+ * latency and bus throughput.
+ */
+class LSM6DSV16XWatermark {
+  public:
+    LSM6DSV16XWatermark(LSM6DSV16XSensor *Sensor);
+    LSM6DSV16XStatusTypeDef Set_Latency_Bound(uint32_t MaxUs);
+    LSM6DSV16XStatusTypeDef Set_Watermark_Range(uint8_t Min, uint8_t Max);
+    LSM6DSV16XStatusTypeDef Start(uint8_t Watermark);
+    LSM6DSV16XStatusTypeDef Drain(LSM6DSV16X_FIFO_Word_t *Words, uint16_t MaxWords, uint16_t *NumWords);
+    LSM6DSV16XStatusTypeDef Get_Info(LSM6DSV16X_Watermark_Info_t *Info);
+
+    /**
+     * @brief Record the arrival of the FIFO threshold interrupt, to be called from the ISR.
+     */
+    void Mark_Interrupt()
+    {
+      irq_time_us = micros();
+      irq_pending = 1;
+    }
+
+  private:
+    LSM6DSV16XStatusTypeDef Adapt(uint32_t StartUs, uint32_t WakeUs, uint16_t NumWords, uint32_t BusUs);
+
+    LSM6DSV16XSensor *sensor;
+
+    /* Configuration */
+    uint32_t max_latency_us;
+    uint8_t min_watermark;
+    uint8_t max_watermark;
+
+    /* Measurements */
+    volatile uint32_t irq_time_us;
+    volatile uint8_t irq_pending;
+    uint32_t last_start_us;
+    uint8_t last_start_valid;
+    float word_rate;        /* [words/us], 0.0f when unknown */
+    float bus_us_per_word;
+    uint32_t wake_peak_us;
+    uint32_t overruns;
+
+    uint8_t watermark;
+    uint8_t hold;
+};
+
+#endif /* __LSM6DSV16XWatermark_H__ */